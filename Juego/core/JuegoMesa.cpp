@@ -10,7 +10,6 @@
 #include <iostream>
 #include <string>
 #include <vector>
-#include <random>
 #include <tuple>
 #include <utility>
 #include <queue>
@@ -40,9 +39,10 @@ namespace juego
 
     /* 
     * \brief Genera de forma aleatoria la disposición de muros en el tablero.
+    * \param gen Generador de la partida.
     * \return Referencia a un GraficoMuros con la nueva distribución.
     */
-    ActorTablero::GraficoMuros &generaMurosAleatorios()
+    ActorTablero::GraficoMuros &generaMurosAleatorios(GeneradorAzar &gen)
     {
         static char buf[51][146];
         constexpr int ROWS = 51;
@@ -100,24 +100,19 @@ namespace juego
             {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 3}, {2, 0}, {2, 3}}};
         constexpr int NUM_SHAPES = sizeof(shapes) / sizeof(shapes[0]);
 
-        std::mt19937 gen{std::random_device{}()};
-        std::uniform_int_distribution<> islandCount(1, 2);
-        std::uniform_int_distribution<> shapeIdx(0, NUM_SHAPES - 1);
-
         for (int block = 0; block < ROWS / BLOCK_H; ++block)
         {
-            int count = islandCount(gen);
+            int count = 1 + (int)gen.entero(2);
             int baseRow = block * BLOCK_H;
             for (int i = 0; i < count; ++i)
             {
-                auto const &shape = shapes[shapeIdx(gen)];
+                auto const &shape = shapes[gen.entero(NUM_SHAPES)];
                 int maxdc = 0;
                 for (auto &d : shape)
                     maxdc = std::max(maxdc, d.second);
                 int w = maxdc + 1;
-                std::uniform_int_distribution<> colOff(0, HALF - w);
-                int obc = colOff(gen);
-                int obr = baseRow + (gen() % BLOCK_H);
+                int obc = (int)gen.entero(HALF - w + 1);
+                int obr = baseRow + (int)gen.entero(BLOCK_H);
                 int mirror = TOKENS - w - obc;
 
                 bool valid = true;
@@ -178,7 +173,7 @@ namespace juego
         tablero()->ponArchivoBaldosas(carpeta_activos_juego + "estampas_fondo.png");
         tablero()->equipa(LadoTablero::Izquierda, L"Granujas", carpeta_activos_juego + "granujas.png");
         tablero()->equipa(LadoTablero::Derecha, L"Bribones", carpeta_activos_juego + "bribones.png");
-        tablero()->situaMuros(generaMurosAleatorios());
+        tablero()->situaMuros(generaMurosAleatorios(azar().partida()));
     }
 
     void JuegoMesa::preparaPersonajes()
@@ -567,9 +562,7 @@ namespace juego
         agregaNombreAlumno(L"Oriol Zabala Martínez");
         indicaCursoAcademico(L"2024 - 2025");
 
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_int_distribution<> tipoDist(0, 1);
+        GeneradorAzar &gen = azar().partida();
         for (int i = 0; i < 10; ++i)
         {
             tesoros[i] = new ActorObjetoRecolectable(
@@ -577,7 +570,7 @@ namespace juego
                 posiciones[i],
                 carpeta_activos_juego + "suerte.png");
 
-            bool esCuracion = tipoDist(gen);
+            bool esCuracion = gen.entero(2) == 1;
 
             if (esCuracion)
             {
@@ -592,6 +585,11 @@ namespace juego
         }
     }
 
+    bool JuegoMesa::murosAleatorios() const
+    {
+        return true;
+    }
+
     void JuegoMesa::despuesDeMover(ActorPersonaje *personaje)
     {
         verificaRecoleccion(personaje);
@@ -633,6 +631,7 @@ namespace juego
 
                 tablero()->indicador().desindica();
 
+                obj->ponRecogido(true);
                 obj->termina();
                 tesoros[i] = nullptr;
 
@@ -34,6 +34,11 @@ namespace juego
          */
         void despuesDeMover(ActorPersonaje *personaje) override;
 
+        /**
+         * @brief Los muros se generan al azar en cada partida (generaMurosAleatorios).
+         */
+        bool murosAleatorios() const override;
+
     private:
         //---------------------------------------------------------------------
         /**
@@ -2,10 +2,15 @@
 // archivo:   principal.cpp
 // versión:   2.3  (Mayo-2025)
 
-#include <cstdlib>   // std::exit, _set_abort_behavior
-#include <exception> // std::set_terminate
-#include <locale>    // std::setlocale
-#include "juego.h"   // tu cabecera del juego
+#include <algorithm>  // std::sort
+#include <cstdlib>    // std::exit, std::system, _set_abort_behavior
+#include <exception>  // std::set_terminate
+#include <filesystem> // std::filesystem
+#include <iostream>   // std::cout
+#include <locale>     // std::setlocale
+#include <string>     // std::string
+#include <vector>     // std::vector
+#include "juego.h"    // tu cabecera del juego
 
 #ifdef _WIN32
 // para evitar que windows.h meta demasiadas cosas que compliquen el build
@@ -37,31 +42,151 @@ static void disableCrtDebugReport()
 #endif
 }
 #else
+#include <sys/wait.h> // WIFEXITED, WEXITSTATUS
+
 // Stubs vacíos en no-Windows para que compile sin errores
 static void disableWin32Errors() {}
 static void disableCrtAbortMsg() {}
 static void disableCrtDebugReport() {}
 #endif
 
-int main()
+// Al comprobar diarios, un error no debe pasar por un diario que coincide
+static bool comprobacion_diarios = false;
+static constexpr int codigoErrorComprobacion = 2;
+
+// Recoge los diarios de las opciones --comprueba; de una carpeta, todos sus archivos por orden
+static std::vector<std::string> recogeDiarios(int argc, char *argv[], bool &con_opcion)
+{
+    std::vector<std::string> diarios;
+    con_opcion = false;
+    for (int indc = 1; indc + 1 < argc; ++indc)
+    {
+        if (std::string{argv[indc]} != "--comprueba")
+            continue;
+        con_opcion = true;
+        std::filesystem::path ruta{argv[++indc]};
+        if (!std::filesystem::is_directory(ruta))
+        {
+            diarios.push_back(ruta.string());
+            continue;
+        }
+        std::vector<std::string> de_carpeta;
+        for (const std::filesystem::directory_entry &entrada : std::filesystem::directory_iterator{ruta})
+        {
+            if (entrada.is_regular_file())
+                de_carpeta.push_back(entrada.path().string());
+        }
+        std::sort(de_carpeta.begin(), de_carpeta.end());
+        diarios.insert(diarios.end(), de_carpeta.begin(), de_carpeta.end());
+    }
+    return diarios;
+}
+
+// Comprueba cada diario en un proceso del propio juego con --comprueba, porque cada uno necesita
+// una partida nueva y UNIR-2D no permite terminar la partida desde el juego
+static int compruebaDiarios(const char *programa, const std::vector<std::string> &diarios)
+{
+    int distintos = 0;
+    for (const std::string &diario : diarios)
+    {
+        std::string orden = "\"" + std::string{programa} + "\" --comprueba \"" + diario + "\"";
+#ifdef _WIN32
+        // cmd /c quita las comillas exteriores de la orden
+        orden = "\"" + orden + "\"";
+#endif
+        std::cout << diario << std::endl;
+        int estado = std::system(orden.c_str());
+#ifndef _WIN32
+        estado = WIFEXITED(estado) ? WEXITSTATUS(estado) : codigoErrorComprobacion;
+#endif
+        if (estado == 0)
+            std::cout << "  coincide" << std::endl;
+        else if (estado == 1)
+            std::cout << "  NO coincide" << std::endl;
+        else
+            std::cout << "  error al reproducir (código " << estado << ")" << std::endl;
+        if (estado != 0)
+            ++distintos;
+    }
+    std::cout << diarios.size() << " diarios, " << distintos << " sin coincidir" << std::endl;
+    return distintos == 0 ? 0 : 1;
+}
+
+// Opciones de la línea de órdenes:
+//   --graba <archivo>       graba el diario de cada partida en el archivo
+//   --reproduce <archivo>   reproduce el diario de una partida al iniciar el juego (con ventana;
+//                           el Simulador no reproduce diarios, ver DiarioPartida)
+//   --comprueba <ruta>      reproduce un diario, o todos los de una carpeta, y termina con código 0
+//                           si todos coinciden con el estado grabado y 1 si no; se puede repetir
+//   --automatico <lado>     el ordenador juega por izquierda, derecha o ambos
+//   --presupuesto <seg>     tiempo de búsqueda de cada jugada del ordenador (1)
+//   --elenco <archivo>      escribe el elenco de la partida para el Simulador (Simulador/elenco.txt)
+static void configuraOpciones(juego::JuegoMesa *juego, int argc, char *argv[])
+{
+    for (int indc = 1; indc + 1 < argc; ++indc)
+    {
+        std::string opcion{argv[indc]};
+        if (opcion == "--graba")
+            juego->diario().graba(argv[++indc]);
+        else if (opcion == "--reproduce")
+            juego->diario().reproduce(argv[++indc]);
+        else if (opcion == "--comprueba")
+            ++indc; // ver recogeDiarios
+        else if (opcion == "--automatico")
+        {
+            std::string lado{argv[++indc]};
+            juego->jugadorAutomatico().asignaLado(tapete::LadoTablero::Izquierda, lado == "izquierda" || lado == "ambos");
+            juego->jugadorAutomatico().asignaLado(tapete::LadoTablero::Derecha, lado == "derecha" || lado == "ambos");
+        }
+        else if (opcion == "--presupuesto")
+            juego->jugadorAutomatico().indicaPresupuesto(std::stod(argv[++indc]));
+        else if (opcion == "--elenco")
+            juego->exportaElenco(argv[++indc]);
+    }
+}
+
+int main(int argc, char *argv[])
 {
     // Primero anular todo lo posible de Win32 y CRT
     disableWin32Errors();
     disableCrtAbortMsg();
     disableCrtDebugReport();
 
-    // Excepciones no capturadas harán exit(0) silencioso
+    // Excepciones no capturadas harán exit(0) silencioso, salvo al comprobar diarios
     std::set_terminate([]()
-                       { std::exit(0); });
+                       { std::exit(comprobacion_diarios ? codigoErrorComprobacion : 0); });
 
     // Configuración regional para tildes, etc.
     std::setlocale(LC_ALL, "es_ES.utf8");
 
+    bool con_comprobacion = false;
+    std::vector<std::string> diarios;
+    try
+    {
+        diarios = recogeDiarios(argc, argv, con_comprobacion);
+    }
+    catch (const std::exception &excepcion)
+    {
+        std::cout << excepcion.what() << std::endl;
+        return codigoErrorComprobacion;
+    }
+    if (con_comprobacion && diarios.empty())
+    {
+        std::cout << "No hay diarios que comprobar." << std::endl;
+        return codigoErrorComprobacion;
+    }
+    if (diarios.size() > 1)
+        return compruebaDiarios(argv[0], diarios);
+    comprobacion_diarios = con_comprobacion;
+
     try
     {
         // Inicialización de juego y motor
         juego::JuegoMesa *juego = new juego::JuegoMesa{};
         unir2d::Motor *motor = new unir2d::Motor{};
+        configuraOpciones(juego, argc, argv);
+        if (comprobacion_diarios)
+            juego->diario().comprueba(diarios.front());
 
         // Bucle principal
         while (true)
@@ -80,6 +205,8 @@ int main()
     catch (...)
     {
         // No imprimir errores en versión entregable
+        if (comprobacion_diarios)
+            return codigoErrorComprobacion;
     }
 
     return 0;
@@ -0,0 +1,262 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo   PruebaBusquedaCamino.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "pruebas.h"
+
+namespace pruebas {
+
+    using namespace reglas;
+
+    namespace {
+
+        constexpr std::array <CeldaReglas, 6> pasosVecinos {
+                CeldaReglas {-2,  0}, CeldaReglas {-1,  1}, CeldaReglas { 1,  1},
+                CeldaReglas { 2,  0}, CeldaReglas { 1, -1}, CeldaReglas {-1, -1}  };
+
+        CeldaReglas desplaza (CeldaReglas celda, CeldaReglas paso) {
+            return CeldaReglas {
+                    static_cast <int16_t> (celda.fila + paso.fila),
+                    static_cast <int16_t> (celda.coln + paso.coln) };
+        }
+
+        bool libre (const TableroReglas & tablero, const TableroReglas::PlanoCeldas & plano_camino, CeldaReglas celda) {
+            int indc = TableroReglas::indiceCelda (celda);
+            return indc >= 0 && ! tablero.ocupada (celda) && ! plano_camino.test (indc);
+        }
+
+        // Dijkstra sin heurística sobre el mismo grafo: los pasos verticales y los diagonales no
+        // miden lo mismo, así que un recorrido en anchura solo sirve para saber si hay camino.
+        bool costeMinimo (
+                const TableroReglas &               tablero,
+                const TableroReglas::PlanoCeldas &  plano_camino,
+                CeldaReglas                         celda_origen,
+                CeldaReglas                         celda_destino,
+                double &                            coste         ) {
+            using Nodo = std::pair <double, int>;
+            std::vector <double> costes (TableroReglas::celdas, std::numeric_limits <double>::infinity ());
+            std::priority_queue <Nodo, std::vector <Nodo>, std::greater <Nodo>> abiertos;
+            int indc_origen  = TableroReglas::indiceCelda (celda_origen);
+            int indc_destino = TableroReglas::indiceCelda (celda_destino);
+            costes [indc_origen] = 0.0;
+            abiertos.push (Nodo {0.0, indc_origen});
+            while (! abiertos.empty ()) {
+                auto [coste_celda, indc_celda] = abiertos.top ();
+                abiertos.pop ();
+                if (coste_celda > costes [indc_celda]) {
+                    continue;
+                }
+                if (indc_celda == indc_destino) {
+                    coste = coste_celda;
+                    return true;
+                }
+                CeldaReglas celda {
+                        static_cast <int16_t> (indc_celda / TableroReglas::columnas + 1),
+                        static_cast <int16_t> (indc_celda % TableroReglas::columnas + 1) };
+                for (CeldaReglas paso : pasosVecinos) {
+                    CeldaReglas vecina = desplaza (celda, paso);
+                    if (! libre (tablero, plano_camino, vecina)) {
+                        continue;
+                    }
+                    int indc_vecina = TableroReglas::indiceCelda (vecina);
+                    double coste_vecina = coste_celda + TableroReglas::distancia (CeldaReglas {0, 0}, paso);
+                    if (coste_vecina < costes [indc_vecina]) {
+                        costes [indc_vecina] = coste_vecina;
+                        abiertos.push (Nodo {coste_vecina, indc_vecina});
+                    }
+                }
+            }
+            return false;
+        }
+
+        bool hayCamino (
+                const TableroReglas &               tablero,
+                const TableroReglas::PlanoCeldas &  plano_camino,
+                CeldaReglas                         celda_origen,
+                CeldaReglas                         celda_destino ) {
+            TableroReglas::PlanoCeldas vistas {};
+            std::vector <CeldaReglas> frente {celda_origen};
+            vistas.set (TableroReglas::indiceCelda (celda_origen));
+            for (int indc = 0; indc < static_cast <int> (frente.size ()); ++ indc) {
+                for (CeldaReglas paso : pasosVecinos) {
+                    CeldaReglas vecina = desplaza (frente [indc], paso);
+                    if (! libre (tablero, plano_camino, vecina) || vistas.test (TableroReglas::indiceCelda (vecina))) {
+                        continue;
+                    }
+                    if (vecina == celda_destino) {
+                        return true;
+                    }
+                    vistas.set (TableroReglas::indiceCelda (vecina));
+                    frente.push_back (vecina);
+                }
+            }
+            return false;
+        }
+
+        // los pasos van de vecina en vecina por celdas libres y las etapas son válidas una tras otra
+        bool caminoCoherente (
+                const TableroReglas &               tablero,
+                const TableroReglas::PlanoCeldas &  plano_camino,
+                const BusquedaCamino &              busqueda,
+                CeldaReglas                         celda_origen,
+                CeldaReglas                         celda_destino,
+                const std::vector <CeldaReglas> &   etapas        ) {
+            const std::vector <CeldaReglas> & pasos = busqueda.pasos ();
+            if (pasos.front () != celda_origen || pasos.back () != celda_destino) {
+                return false;
+            }
+            double coste = 0.0;
+            for (int indc = 1; indc < static_cast <int> (pasos.size ()); ++ indc) {
+                CeldaReglas paso {
+                        static_cast <int16_t> (pasos [indc].fila - pasos [indc - 1].fila),
+                        static_cast <int16_t> (pasos [indc].coln - pasos [indc - 1].coln) };
+                if (std::find (pasosVecinos.begin (), pasosVecinos.end (), paso) == pasosVecinos.end ()) {
+                    return false;
+                }
+                if (! libre (tablero, plano_camino, pasos [indc])) {
+                    return false;
+                }
+                coste += TableroReglas::distancia (pasos [indc - 1], pasos [indc]);
+            }
+            if (std::fabs (coste - busqueda.coste ()) > 0.01) {
+                return false;
+            }
+
+            if (etapas.front () != celda_origen || etapas.back () != celda_destino) {
+                return false;
+            }
+            TableroReglas::PlanoCeldas plano_etapas = plano_camino;
+            plano_etapas.set (TableroReglas::indiceCelda (etapas.front ()));
+            for (int indc = 1; indc < static_cast <int> (etapas.size ()); ++ indc) {
+                if (! tablero.segmentoValido (etapas [indc - 1], etapas [indc], plano_etapas)) {
+                    return false;
+                }
+                plano_etapas.set (TableroReglas::indiceCelda (etapas [indc]));
+            }
+            return busqueda.longitud () <= busqueda.coste () + 0.01f;
+        }
+
+        CeldaReglas celdaLibre (
+                const TableroReglas &               tablero,
+                const TableroReglas::PlanoCeldas &  plano_camino,
+                std::mt19937 &                      generador     ) {
+            std::uniform_int_distribution <int> reparto_fila {1, TableroReglas::filas};
+            std::uniform_int_distribution <int> reparto_coln {1, TableroReglas::columnas};
+            while (true) {
+                CeldaReglas celda {static_cast <int16_t> (reparto_fila (generador)),
+                                   static_cast <int16_t> (reparto_coln (generador))};
+                if ((celda.fila + celda.coln) % 2 == 0 && libre (tablero, plano_camino, celda)) {
+                    return celda;
+                }
+            }
+        }
+
+        void disposicionAzar (
+                int                           densidad,
+                std::mt19937 &                generador,
+                TableroReglas &               tablero,
+                TableroReglas::PlanoCeldas &  plano_camino ) {
+            tablero.vacia ();
+            plano_camino.reset ();
+            for (int fila = 1; fila <= TableroReglas::filas; ++ fila) {
+                for (int coln = 1; coln <= TableroReglas::columnas; ++ coln) {
+                    CeldaReglas celda {static_cast <int16_t> (fila), static_cast <int16_t> (coln)};
+                    if (! TableroReglas::celdaEnTablero (celda)) {
+                        continue;
+                    }
+                    unsigned int sorteo = generador () % (densidad * 8);
+                    if (sorteo < 8) {
+                        tablero.ponMuro (celda);
+                    } else if (sorteo == 8) {
+                        plano_camino.set (TableroReglas::indiceCelda (celda));
+                    }
+                }
+            }
+        }
+
+    }
+
+    bool pruebaBusquedaCamino () {
+        constexpr int consultas = 1000;
+
+        // muros al azar, de escasos a casi un tercio del tablero, y algunas etapas de camino; con
+        // semilla fija para que los fallos se puedan reproducir
+        std::mt19937 generador {20250401u};
+        BusquedaCamino busqueda;
+        std::vector <CeldaReglas> etapas;
+        TableroReglas tablero;
+        TableroReglas::PlanoCeldas plano_camino;
+        long total_fallos = 0;
+        for (int densidad : {12, 6, 3}) {
+            disposicionAzar (densidad, generador, tablero, plano_camino);
+            int  con_camino = 0;
+            long fallos     = 0;
+            for (int indc = 0; indc < consultas; ++ indc) {
+                CeldaReglas origen  = celdaLibre (tablero, plano_camino, generador);
+                CeldaReglas destino = celdaLibre (tablero, plano_camino, generador);
+                if (origen == destino) {
+                    continue;
+                }
+                bool   encontrado = busqueda.busca (tablero, plano_camino, origen, destino, etapas);
+                double coste_minimo = 0.0;
+                bool   existe     = costeMinimo (tablero, plano_camino, origen, destino, coste_minimo);
+                if (encontrado != existe || existe != hayCamino (tablero, plano_camino, origen, destino)) {
+                    fallos ++;
+                    continue;
+                }
+                if (! encontrado) {
+                    continue;
+                }
+                con_camino ++;
+                if (std::fabs (busqueda.coste () - coste_minimo) > 0.01 ||
+                    ! caminoCoherente (tablero, plano_camino, busqueda, origen, destino, etapas)) {
+                    fallos ++;
+                }
+            }
+            std::cout << "    muros 1 de " << std::left << std::setw (2) << densidad << std::right << ": "
+                      << consultas << " consultas, " << con_camino << " con camino, " << fallos << " distintas"
+                      << std::endl;
+            total_fallos += fallos;
+        }
+        return total_fallos == 0;
+    }
+
+    void medidaBusquedaCamino () {
+        constexpr int consultas = 20000;
+
+        std::mt19937 generador {20250401u};
+        BusquedaCamino busqueda;
+        std::vector <CeldaReglas> etapas;
+        TableroReglas tablero;
+        TableroReglas::PlanoCeldas plano_camino;
+        for (int densidad : {12, 6, 3}) {
+            disposicionAzar (densidad, generador, tablero, plano_camino);
+            std::vector <std::pair <CeldaReglas, CeldaReglas>> pares (consultas);
+            for (auto & par : pares) {
+                par.first  = celdaLibre (tablero, plano_camino, generador);
+                par.second = celdaLibre (tablero, plano_camino, generador);
+            }
+            std::vector <double> tiempos;
+            tiempos.reserve (consultas);
+            long suma = 0;
+            for (const auto & par : pares) {
+                auto inicio = std::chrono::steady_clock::now ();
+                suma += busqueda.busca (tablero, plano_camino, par.first, par.second, etapas) ? etapas.size () : 0;
+                std::chrono::duration <double, std::micro> duracion = std::chrono::steady_clock::now () - inicio;
+                tiempos.push_back (duracion.count ());
+            }
+            // el máximo recoge las interrupciones del sistema; el percentil 99 es más estable
+            std::sort (tiempos.begin (), tiempos.end ());
+            double media = 0.0;
+            for (double tiempo : tiempos) {
+                media += tiempo;
+            }
+            media /= consultas;
+            std::cout << "    muros 1 de " << std::left << std::setw (2) << densidad << std::right << ": "
+                      << std::fixed << std::setprecision (1) << media << " us por consulta, percentil 99 "
+                      << tiempos [consultas * 99 / 100] << " us, máximo " << tiempos.back ()
+                      << " us   (control " << suma << ")" << std::endl;
+        }
+    }
+
+}
@@ -0,0 +1,78 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo   PruebaDistanciaCamino.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "pruebas.h"
+
+namespace pruebas {
+
+    using namespace reglas;
+
+    namespace {
+
+        // ModoJuegoBase::puntosEnJuegoCamino original: vuelve a sumar todas las etapas del camino más
+        // la próxima celda, y redondea la distancia en puntos de acción.
+        int puntosOriginal (
+                const std::vector <CeldaReglas> & etapas,
+                CeldaReglas                       proxima_celda,
+                float                             puntos_accion_de_desplaza ) {
+            float distn = 0.0f;
+            for (int indc = 0; indc < etapas.size (); ++ indc) {
+                CeldaReglas previa = etapas [indc];
+                CeldaReglas etapa  = indc == etapas.size () - 1 ? proxima_celda : etapas [indc + 1];
+                distn += TableroReglas::distancia (previa, etapa);
+            }
+            return static_cast <int> (std::round (distn / puntos_accion_de_desplaza));
+        }
+
+        CeldaReglas celdaAlAzar (std::mt19937 & generador, CeldaReglas centro, int radio) {
+            std::uniform_int_distribution <int> reparto {- radio, radio};
+            while (true) {
+                int fila = centro.fila + 2 * reparto (generador);
+                int coln = centro.coln + reparto (generador);
+                CeldaReglas celda {static_cast <int16_t> (fila), static_cast <int16_t> ((fila + coln) % 2 == 0 ? coln : coln + 1)};
+                if (TableroReglas::celdaEnTablero (celda) && celda != centro) {
+                    return celda;
+                }
+            }
+        }
+
+    }
+
+    bool pruebaDistanciaCamino () {
+        constexpr int caminos    = 1000;
+        constexpr int etapas     = 20;
+        constexpr int candidatas = 50;
+
+        std::mt19937 generador {20250401u};
+        long consultas = 0;
+        long fallos    = 0;
+        // la del juego (la distancia entre celdas vecinas) y otras que cambian dónde caen los redondeos
+        for (float puntos_accion_de_desplaza : {34.0f, 17.0f, 25.5f, 40.0f}) {
+            for (int camino = 0; camino < caminos; ++ camino) {
+                std::vector <CeldaReglas> etapas_camino;
+                etapas_camino.push_back (celdaAlAzar (generador, CeldaReglas {26, 25}, 12));
+                DistanciaCamino distancia_camino;
+                distancia_camino.agrega (etapas_camino.back ());
+                for (int etapa = 0; etapa < etapas; ++ etapa) {
+                    for (int candidata = 0; candidata < candidatas; ++ candidata) {
+                        CeldaReglas proxima_celda = celdaAlAzar (generador, etapas_camino.back (), 8);
+                        // lo que llaman ModoJuegoBase::puntosEnJuegoCamino y AlcanceMovimiento::calcula
+                        int puntos = distancia_camino.puntosHasta (proxima_celda, puntos_accion_de_desplaza);
+                        consultas ++;
+                        if (puntos != puntosOriginal (etapas_camino, proxima_celda, puntos_accion_de_desplaza)) {
+                            fallos ++;
+                        }
+                    }
+                    // lo que llama ModoJuegoBase::agregaEtapa
+                    CeldaReglas celda = celdaAlAzar (generador, etapas_camino.back (), 8);
+                    distancia_camino.agrega (celda);
+                    etapas_camino.push_back (celda);
+                }
+            }
+        }
+        std::cout << "    " << consultas << " consultas, " << fallos << " distintas" << std::endl;
+        return fallos == 0;
+    }
+
+}
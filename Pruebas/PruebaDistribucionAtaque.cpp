@@ -0,0 +1,98 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo   PruebaDistribucionAtaque.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "pruebas.h"
+
+namespace pruebas {
+
+    using namespace reglas;
+
+    namespace {
+
+        // La distribución sumando resuelveAtaque sobre cada uno de los cien valores aleatorios.
+        void distribucionSumada (
+                const GradoReglas *  grados,
+                int                  cuenta_grados,
+                int                  valor_ataque,
+                int                  valor_defensa,
+                int                  valor_dano,
+                int                  valor_reduce_dano,
+                int                  vitalidad,
+                DistribucionAtaque & distribucion  ) {
+            distribucion = DistribucionAtaque {};
+            distribucion.ventaja = valor_ataque - valor_defensa;
+            AtaqueReglas ataque {};
+            for (int aleatorio_100 = 0; aleatorio_100 < 100; ++ aleatorio_100) {
+                ReglasJuego::resuelveAtaque (
+                        grados, cuenta_grados, valor_ataque, valor_defensa, aleatorio_100,
+                        valor_dano, valor_reduce_dano, vitalidad, ataque);
+                if (ataque.grado >= 0) {
+                    distribucion.probabilidad_grado [ataque.grado] += 0.01f;
+                } else {
+                    distribucion.probabilidad_fallo += 0.01f;
+                }
+                distribucion.dano_esperado += 0.01f * (ataque.vitalidad_origen - ataque.vitalidad_final);
+                if (ataque.vitalidad_origen > 0 && ataque.vitalidad_final == 0) {
+                    distribucion.probabilidad_derriba += 0.01f;
+                }
+            }
+        }
+
+        bool iguales (const DistribucionAtaque & una, const DistribucionAtaque & otra, int cuenta_grados) {
+            auto cerca = [] (float valor, float otro_valor) {
+                return std::abs (valor - otro_valor) <= 1e-4f * std::max (1.0f, std::abs (otro_valor));
+            };
+            for (int indc = 0; indc < cuenta_grados; ++ indc) {
+                if (! cerca (una.probabilidad_grado [indc], otra.probabilidad_grado [indc])) {
+                    return false;
+                }
+            }
+            return una.ventaja == otra.ventaja &&
+                   cerca (una.probabilidad_fallo,   otra.probabilidad_fallo)   &&
+                   cerca (una.dano_esperado,        otra.dano_esperado)        &&
+                   cerca (una.probabilidad_derriba, otra.probabilidad_derriba);
+        }
+
+    }
+
+    bool pruebaDistribucionAtaque () {
+        // los grados del juego, con el último hasta INT_MAX, y unos cuyo último grado deja ataques sin grado
+        const std::vector <std::vector <GradoReglas>> tablas {
+                {{9, 0}, {49, 50}, {89, 100}, {INT_MAX, 150}},
+                {{-20, 0}, {30, 75}, {120, 125}} };
+        struct Golpe {
+            int valor_dano;
+            int valor_reduce_dano;
+            int vitalidad;
+        };
+        const std::vector <Golpe> golpes {{50, 5, 30}, {25, 0, 100}, {55, 20, 0}, {29, 12, 7}};
+
+        long comparadas = 0;
+        long fallos     = 0;
+        for (const std::vector <GradoReglas> & grados : tablas) {
+            int cuenta_grados = static_cast <int> (grados.size ());
+            for (const Golpe & golpe : golpes) {
+                for (int ventaja = -250; ventaja <= 250; ++ ventaja) {
+                    int valor_defensa = 60;
+                    int valor_ataque  = valor_defensa + ventaja;
+                    DistribucionAtaque cerrada;
+                    DistribucionAtaque sumada;
+                    ReglasJuego::distribuyeAtaque (
+                            grados.data (), cuenta_grados, valor_ataque, valor_defensa,
+                            golpe.valor_dano, golpe.valor_reduce_dano, golpe.vitalidad, cerrada);
+                    distribucionSumada (
+                            grados.data (), cuenta_grados, valor_ataque, valor_defensa,
+                            golpe.valor_dano, golpe.valor_reduce_dano, golpe.vitalidad, sumada);
+                    comparadas ++;
+                    if (! iguales (cerrada, sumada, cuenta_grados)) {
+                        fallos ++;
+                    }
+                }
+            }
+        }
+        std::cout << "    " << comparadas << " distribuciones, " << fallos << " distintas" << std::endl;
+        return fallos == 0;
+    }
+
+}
@@ -0,0 +1,226 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo   PruebaLocalizacion.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "pruebas.h"
+
+namespace pruebas {
+
+    using namespace reglas;
+
+    namespace {
+
+        constexpr float anchuraRejilla = (1.5f * TableroReglas::columnas + 0.5f) * TableroReglas::ladoHexagono;
+        constexpr float alturaRejilla  = (TableroReglas::filas + 1) * TableroReglas::seno60 * TableroReglas::ladoHexagono;
+        constexpr float pasoBarrido    = 0.25f;
+
+        void centroHexagono (CeldaReglas celda, float & x, float & y) {
+            x = 1.5f * celda.coln - 0.5f;
+            y = TableroReglas::seno60 * celda.fila;
+            x *= TableroReglas::ladoHexagono;
+            y *= TableroReglas::ladoHexagono;
+        }
+
+        CeldaReglas celda (int fila, int coln) {
+            return CeldaReglas {static_cast <int16_t> (fila), static_cast <int16_t> (coln)};
+        }
+
+        // RejillaTablero::localizaCelda original: dos columnas y dos filas candidatas, y entre las dos
+        // celdas que forman, la de centro más cercano.
+        CeldaReglas localizaCeldaOriginal (float x_punto, float y_punto) {
+            constexpr int filas    = TableroReglas::filas;
+            constexpr int columnas = TableroReglas::columnas;
+
+            float x = x_punto;
+            float y = y_punto;
+            if (x < 0.0f || y < 0.0f) {
+                return celda (0, 0);
+            }
+
+            x /= TableroReglas::ladoHexagono;
+            x -= 0.5f;
+
+            int coln_1;
+            if (x < 0.0f) {
+                coln_1 = 1;
+            } else {
+                coln_1 = static_cast <int> (x / 1.5f);
+                coln_1 += 1;
+            }
+            if (coln_1 > columnas) {
+                return celda (0, 0);
+            }
+
+            int coln_2;
+            if (x < 0.0f) {
+                coln_2 = 0;
+            } else {
+                float m = std::fmod (x, 1.5f);
+                if (m <= 1.0f) {
+                    coln_2 = 0;
+                } else {
+                    if (coln_1 + 1 > columnas) {
+                        coln_2 = 0;
+                    } else {
+                        coln_2 = coln_1 + 1;
+                    }
+                }
+            }
+
+            y /= TableroReglas::ladoHexagono;
+            y /= TableroReglas::seno60;
+            int fila_1;
+            int fila_2;
+            fila_1 = static_cast <int> (y);
+            fila_2 = fila_1;
+            if (fila_1 % 2 == 0) {
+                fila_1 ++;
+            } else {
+                fila_2 ++;
+            }
+            if (fila_1 > filas) {
+                return celda (0, 0);
+            }
+            if (fila_2 > filas - 1) {
+                fila_2 = 0;
+            }
+
+            if (fila_2 == 0 && coln_2 == 0) {
+                if (coln_1 % 2 == 0) {
+                    return celda (0, 0);
+                }
+                return celda (fila_1, coln_1);
+            }
+            if (fila_2 == 0) {
+                return coln_1 % 2 == 0 ? celda (fila_1, coln_2) : celda (fila_1, coln_1);
+            }
+            if (coln_2 == 0) {
+                return coln_1 % 2 == 0 ? celda (fila_2, coln_1) : celda (fila_1, coln_1);
+            }
+
+            CeldaReglas celda_1 = coln_1 % 2 == 0 ? celda (fila_1, coln_2) : celda (fila_1, coln_1);
+            CeldaReglas celda_2 = coln_1 % 2 == 0 ? celda (fila_2, coln_1) : celda (fila_2, coln_2);
+            float x_1, y_1, x_2, y_2;
+            centroHexagono (celda_1, x_1, y_1);
+            centroHexagono (celda_2, x_2, y_2);
+            float norma_1 = std::sqrt ((x_1 - x_punto) * (x_1 - x_punto) + (y_1 - y_punto) * (y_1 - y_punto));
+            float norma_2 = std::sqrt ((x_2 - x_punto) * (x_2 - x_punto) + (y_2 - y_punto) * (y_2 - y_punto));
+            return norma_1 < norma_2 ? celda_1 : celda_2;
+        }
+
+        // Distancia del punto al centro de la celda en la rejilla regular de la que la dibujada es
+        // imagen afín (las filas avanzan seno60 lados en lugar de sqrt(3)/2): la celda que contiene
+        // un punto es la de centro más cercano con esta distancia.
+        double distanciaRegular (CeldaReglas celda, float x_punto, float y_punto) {
+            double x = x_punto / TableroReglas::ladoHexagono + 0.5 - 1.5 * celda.coln;
+            double y = (y_punto / (TableroReglas::ladoHexagono * TableroReglas::seno60) - celda.fila) * std::sqrt (3.0) / 2.0;
+            return std::sqrt (x * x + y * y);
+        }
+
+        // Distancia a la celda del tablero más cercana, buscando alrededor de la columna y la fila
+        // aproximadas del punto.
+        double distanciaMinima (float x_punto, float y_punto) {
+            int coln_aprox = static_cast <int> (std::lround ((x_punto / TableroReglas::ladoHexagono + 0.5) / 1.5));
+            int fila_aprox = static_cast <int> (std::lround (y_punto / (TableroReglas::ladoHexagono * TableroReglas::seno60)));
+            double minima = 1.0e9;
+            for (int coln = coln_aprox - 2; coln <= coln_aprox + 2; ++ coln) {
+                for (int fila = fila_aprox - 3; fila <= fila_aprox + 3; ++ fila) {
+                    CeldaReglas candidata = celda (fila, coln);
+                    if ((fila + coln) % 2 != 0 || ! TableroReglas::celdaEnTablero (candidata)) {
+                        continue;
+                    }
+                    minima = std::min (minima, distanciaRegular (candidata, x_punto, y_punto));
+                }
+            }
+            return minima;
+        }
+
+        bool celdaBorde (CeldaReglas celda) {
+            return celda.fila <= 2 || celda.fila >= TableroReglas::filas - 1 ||
+                   celda.coln <= 1 || celda.coln >= TableroReglas::columnas;
+        }
+
+    }
+
+    bool pruebaLocalizacionCelda () {
+        // margen para los puntos que están sobre la costura entre dos hexágonos
+        constexpr double margenCostura = 1.0e-4;
+
+        long puntos   = 0;
+        long iguales  = 0;
+        long costuras = 0;
+        long margenes = 0;
+        long fallos   = 0;
+        for (float y = 0.0f; y < alturaRejilla; y += pasoBarrido) {
+            for (float x = 0.0f; x < anchuraRejilla; x += pasoBarrido) {
+                puntos ++;
+                CeldaReglas localizada = TableroReglas::localizaCelda (x, y);
+                CeldaReglas original   = localizaCeldaOriginal (x, y);
+                if (localizada == CeldaReglas {0, 0}) {
+                    // la nueva versión no puede perder puntos que la original localizaba
+                    if (original != CeldaReglas {0, 0}) {
+                        fallos ++;
+                    }
+                    iguales ++;
+                    continue;
+                }
+                if (localizada == original) {
+                    iguales ++;
+                } else if (original == CeldaReglas {0, 0}) {
+                    // muescas del margen entre los hexágonos del borde: ahora dan una celda del borde
+                    if (celdaBorde (localizada)) {
+                        margenes ++;
+                    } else {
+                        fallos ++;
+                    }
+                } else {
+                    // costuras: la nueva versión debe dar la celda que contiene el punto
+                    if (distanciaRegular (localizada, x, y) <= distanciaMinima (x, y) + margenCostura) {
+                        costuras ++;
+                    } else {
+                        fallos ++;
+                    }
+                }
+            }
+        }
+        std::cout << "    " << puntos << " puntos cada " << pasoBarrido << " px: "
+                  << iguales << " iguales, " << costuras << " corregidos en las costuras, "
+                  << margenes << " en el margen que antes no daban celda" << std::endl;
+        std::cout << "    " << fallos << " diferencias no documentadas" << std::endl;
+        return fallos == 0;
+    }
+
+    void medidaLocalizacionCelda () {
+        constexpr int cuentaPuntos = 1 << 16;
+        constexpr int repeticiones = 200;
+
+        std::mt19937 generador {20250401u};
+        std::uniform_real_distribution <float> reparto_x {0.0f, anchuraRejilla};
+        std::uniform_real_distribution <float> reparto_y {0.0f, alturaRejilla};
+        std::vector <float> xs (cuentaPuntos);
+        std::vector <float> ys (cuentaPuntos);
+        for (int indc = 0; indc < cuentaPuntos; ++ indc) {
+            xs [indc] = reparto_x (generador);
+            ys [indc] = reparto_y (generador);
+        }
+
+        auto mide = [&] (const std::string & nombre, CeldaReglas (* localiza) (float, float)) {
+            long suma = 0;
+            auto inicio = std::chrono::steady_clock::now ();
+            for (int repet = 0; repet < repeticiones; ++ repet) {
+                for (int indc = 0; indc < cuentaPuntos; ++ indc) {
+                    CeldaReglas localizada = localiza (xs [indc], ys [indc]);
+                    suma += localizada.fila + localizada.coln;
+                }
+            }
+            std::chrono::duration <double, std::nano> duracion = std::chrono::steady_clock::now () - inicio;
+            double por_llamada = duracion.count () / (static_cast <double> (cuentaPuntos) * repeticiones);
+            std::cout << "    " << std::left << std::setw (10) << nombre << std::right << std::fixed
+                      << std::setprecision (1) << por_llamada << " ns por llamada   (control " << suma << ")"
+                      << std::endl;
+        };
+        mide ("original", localizaCeldaOriginal);
+        mide ("actual",   TableroReglas::localizaCelda);
+    }
+
+}
@@ -0,0 +1,118 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo   PruebaOcupacion.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "pruebas.h"
+
+namespace pruebas {
+
+    using namespace reglas;
+
+    namespace {
+
+        // Los datos que recorrían CalculoCaminos::celdaEnMuro y celdaOcupada originales: los sitios
+        // de los muros, de los personajes y de las etapas del camino, en listas.
+        struct ListasOriginales {
+            std::vector <CeldaReglas> muros;
+            std::vector <CeldaReglas> fichas;
+            std::vector <CeldaReglas> etapas;
+        };
+
+        bool enMuroOriginal (const ListasOriginales & listas, CeldaReglas celda) {
+            for (const CeldaReglas & muro : listas.muros) {
+                if (muro == celda) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool ocupadaOriginal (const ListasOriginales & listas, CeldaReglas celda) {
+            for (const CeldaReglas & ficha : listas.fichas) {
+                if (ficha == celda) {
+                    return true;
+                }
+            }
+            if (enMuroOriginal (listas, celda)) {
+                return true;
+            }
+            for (const CeldaReglas & etapa : listas.etapas) {
+                if (etapa == celda) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        CeldaReglas celdaDelTablero (std::mt19937 & generador) {
+            std::uniform_int_distribution <int> reparto_fila {1, TableroReglas::filas};
+            std::uniform_int_distribution <int> reparto_coln {1, TableroReglas::columnas};
+            while (true) {
+                CeldaReglas celda {static_cast <int16_t> (reparto_fila (generador)),
+                                   static_cast <int16_t> (reparto_coln (generador))};
+                if (TableroReglas::celdaEnTablero (celda)) {
+                    return celda;
+                }
+            }
+        }
+
+    }
+
+    void medidaOcupacionCeldas () {
+        // unos 180 muros, como los que genera JuegoMesa, seis personajes y un camino de diez etapas
+        constexpr int cuentaMuros   = 180;
+        constexpr int cuentaFichas  = 6;
+        constexpr int cuentaEtapas  = 10;
+        constexpr int cuentaCeldas  = 1 << 16;
+        constexpr int repeticiones  = 100;
+
+        std::mt19937 generador {20250401u};
+        ListasOriginales listas;
+        TableroReglas tablero;
+        TableroReglas::PlanoCeldas plano_camino;
+        tablero.vacia ();
+        for (int indc = 0; indc < cuentaMuros; ++ indc) {
+            CeldaReglas celda = celdaDelTablero (generador);
+            listas.muros.push_back (celda);
+            tablero.ponMuro (celda);
+        }
+        for (int indc = 0; indc < cuentaFichas; ++ indc) {
+            CeldaReglas celda = celdaDelTablero (generador);
+            listas.fichas.push_back (celda);
+            tablero.mueveFicha (CeldaReglas {0, 0}, celda);
+        }
+        for (int indc = 0; indc < cuentaEtapas; ++ indc) {
+            CeldaReglas celda = celdaDelTablero (generador);
+            listas.etapas.push_back (celda);
+            plano_camino.set (TableroReglas::indiceCelda (celda));
+        }
+        std::vector <CeldaReglas> celdas (cuentaCeldas);
+        for (CeldaReglas & celda : celdas) {
+            celda = celdaDelTablero (generador);
+        }
+
+        auto mide = [&] (const std::string & nombre, const std::function <bool (CeldaReglas)> & consulta) {
+            long suma = 0;
+            auto inicio = std::chrono::steady_clock::now ();
+            for (int repet = 0; repet < repeticiones; ++ repet) {
+                for (CeldaReglas celda : celdas) {
+                    suma += consulta (celda) ? 1 : 0;
+                }
+            }
+            std::chrono::duration <double, std::nano> duracion = std::chrono::steady_clock::now () - inicio;
+            double por_llamada = duracion.count () / (static_cast <double> (cuentaCeldas) * repeticiones);
+            std::cout << "    " << std::left << std::setw (20) << nombre << std::right << std::fixed
+                      << std::setprecision (1) << por_llamada << " ns por llamada   (control " << suma << ")"
+                      << std::endl;
+        };
+        // como OcupacionTablero::enMuro y OcupacionTablero::ocupada
+        mide ("enMuro original",  [&] (CeldaReglas celda) { return enMuroOriginal (listas, celda); });
+        mide ("enMuro actual",    [&] (CeldaReglas celda) { return tablero.enMuro (celda); });
+        mide ("ocupada original", [&] (CeldaReglas celda) { return ocupadaOriginal (listas, celda); });
+        mide ("ocupada actual",   [&] (CeldaReglas celda) {
+            int indc = TableroReglas::indiceCelda (celda);
+            return indc >= 0 && (tablero.ocupada (celda) || plano_camino.test (indc));
+        });
+    }
+
+}
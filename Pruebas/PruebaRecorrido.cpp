@@ -0,0 +1,234 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo   PruebaRecorrido.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "pruebas.h"
+
+namespace pruebas {
+
+    using namespace reglas;
+
+    namespace {
+
+        // Recorrido original de CalculoCaminos, con las mismas operaciones en coma flotante: en los
+        // cuadrantes se elige en cada paso la candidata cuyo centro queda más cerca de la recta.
+
+        struct EcuacionRecta {
+            float a;
+            float b;
+            float c;
+            float d;
+        };
+
+        void centroHexagono (CeldaReglas celda, float & x, float & y) {
+            x = 1.5f * celda.coln - 0.5f;
+            y = TableroReglas::seno60 * celda.fila;
+            x *= TableroReglas::ladoHexagono;
+            y *= TableroReglas::ladoHexagono;
+        }
+
+        void calculoDireccion (
+                CeldaReglas celda_origen, CeldaReglas celda_destino,
+                int & direccion_exacta, int & direccion_cuadrante ) {
+            direccion_exacta    = 0;
+            direccion_cuadrante = 0;
+            int filas = celda_destino.fila - celda_origen.fila;
+            int colns = celda_destino.coln - celda_origen.coln;
+            if (filas == 0) {
+                direccion_cuadrante = colns > 0 ? 2 : 5;
+            } else if (colns == 0) {
+                direccion_exacta = filas > 0 ? 4 : 1;
+            } else if (filas > 0 && colns > 0) {
+                if (filas == colns) {
+                    direccion_exacta = 3;
+                } else {
+                    direccion_cuadrante = filas < colns ? 2 : 3;
+                }
+            } else if (filas > 0 && colns < 0) {
+                if (filas == - colns) {
+                    direccion_exacta = 5;
+                } else {
+                    direccion_cuadrante = filas < - colns ? 5 : 4;
+                }
+            } else if (filas < 0 && colns > 0) {
+                if (- filas == colns) {
+                    direccion_exacta = 2;
+                } else {
+                    direccion_cuadrante = - filas < colns ? 2 : 1;
+                }
+            } else {
+                if (filas == colns) {
+                    direccion_exacta = 6;
+                } else {
+                    direccion_cuadrante = - filas < - colns ? 5 : 6;
+                }
+            }
+        }
+
+        CeldaReglas desplaza (CeldaReglas celda, int filas, int colns) {
+            return CeldaReglas {static_cast <int16_t> (celda.fila + filas), static_cast <int16_t> (celda.coln + colns)};
+        }
+
+        CeldaReglas celdaProximaExacta (CeldaReglas celda_sale, int direccion_exacta) {
+            switch (direccion_exacta) {
+            case 1:  return desplaza (celda_sale, -2,  0);
+            case 2:  return desplaza (celda_sale, -1,  1);
+            case 3:  return desplaza (celda_sale,  1,  1);
+            case 4:  return desplaza (celda_sale,  2,  0);
+            case 5:  return desplaza (celda_sale,  1, -1);
+            default: return desplaza (celda_sale, -1, -1);
+            }
+        }
+
+        CeldaReglas celdaProximaCuadrante (
+                CeldaReglas celda_sale, int direccion_cuadrante, const EcuacionRecta & recta) {
+            std::array <CeldaReglas, 2> celda_proxm {};
+            switch (direccion_cuadrante) {
+            case 1:
+                celda_proxm [0] = desplaza (celda_sale, -2,  0);
+                celda_proxm [1] = desplaza (celda_sale, -1,  1);
+                break;
+            case 2:
+                celda_proxm [0] = desplaza (celda_sale, -1,  1);
+                celda_proxm [1] = desplaza (celda_sale,  1,  1);
+                break;
+            case 3:
+                celda_proxm [0] = desplaza (celda_sale,  1,  1);
+                celda_proxm [1] = desplaza (celda_sale,  2,  0);
+                break;
+            case 4:
+                celda_proxm [0] = desplaza (celda_sale,  2,  0);
+                celda_proxm [1] = desplaza (celda_sale,  1, -1);
+                break;
+            case 5:
+                celda_proxm [0] = desplaza (celda_sale,  1, -1);
+                celda_proxm [1] = desplaza (celda_sale, -1, -1);
+                break;
+            case 6:
+                celda_proxm [0] = desplaza (celda_sale, -1, -1);
+                celda_proxm [1] = desplaza (celda_sale, -2,  0);
+                break;
+            }
+            for (CeldaReglas & celda : celda_proxm) {
+                if (! TableroReglas::celdaEnTablero (celda)) {
+                    celda = CeldaReglas {0, 0};
+                }
+            }
+            if (celda_proxm [0] == CeldaReglas {0, 0}) {
+                return celda_proxm [1];
+            }
+            if (celda_proxm [1] == CeldaReglas {0, 0}) {
+                return celda_proxm [0];
+            }
+            std::array <float, 2> distn_proxm {};
+            for (int indc = 0; indc < celda_proxm.size (); ++ indc) {
+                float x, y;
+                centroHexagono (celda_proxm [indc], x, y);
+                distn_proxm [indc] = std::fabs (recta.a * x + recta.b * y + recta.c) / recta.d;
+            }
+            return distn_proxm [0] < distn_proxm [1] ? celda_proxm [0] : celda_proxm [1];
+        }
+
+        bool recorridoOriginal (
+                const TableroReglas &       tablero,
+                CeldaReglas                 celda_origen,
+                CeldaReglas                 celda_destino,
+                std::vector <CeldaReglas> & recorrido     ) {
+            recorrido.clear ();
+            int direccion_exacta;
+            int direccion_cuadrante;
+            calculoDireccion (celda_origen, celda_destino, direccion_exacta, direccion_cuadrante);
+
+            EcuacionRecta recta {};
+            if (direccion_exacta == 0) {
+                float x_origen, y_origen, x_destino, y_destino;
+                centroHexagono (celda_origen,  x_origen,  y_origen);
+                centroHexagono (celda_destino, x_destino, y_destino);
+                recta.a = y_destino - y_origen;
+                recta.b = - (x_destino - x_origen);
+                recta.c = - recta.a * x_origen - recta.b * y_origen;
+                recta.d = std::sqrt (recta.a * recta.a + recta.b * recta.b);
+            }
+
+            CeldaReglas celda_sale = celda_origen;
+            while (true) {
+                CeldaReglas celda_llega = direccion_exacta != 0 ?
+                        celdaProximaExacta    (celda_sale, direccion_exacta) :
+                        celdaProximaCuadrante (celda_sale, direccion_cuadrante, recta);
+                if (celda_llega == celda_destino) {
+                    return true;
+                }
+                if (! TableroReglas::celdaEnTablero (celda_llega) || tablero.ocupada (celda_llega)) {
+                    return false;
+                }
+                recorrido.push_back (celda_llega);
+                celda_sale = celda_llega;
+            }
+        }
+
+        std::vector <CeldaReglas> celdasTablero () {
+            std::vector <CeldaReglas> celdas;
+            for (int fila = 1; fila <= TableroReglas::filas; ++ fila) {
+                for (int coln = 1; coln <= TableroReglas::columnas; ++ coln) {
+                    CeldaReglas celda {static_cast <int16_t> (fila), static_cast <int16_t> (coln)};
+                    if (TableroReglas::celdaEnTablero (celda)) {
+                        celdas.push_back (celda);
+                    }
+                }
+            }
+            return celdas;
+        }
+
+    }
+
+    bool pruebaRecorridoSegmento () {
+        const std::vector <CeldaReglas> celdas = celdasTablero ();
+        std::vector <CeldaReglas> recorrido;
+        std::vector <CeldaReglas> recorrido_original;
+
+        TableroReglas tablero {};
+        long pares   = 0;
+        long fallos  = 0;
+        for (CeldaReglas origen : celdas) {
+            for (CeldaReglas destino : celdas) {
+                if (origen == destino) {
+                    continue;
+                }
+                pares ++;
+                bool valido          = tablero.recorridoSegmento (origen, destino, recorrido);
+                bool valido_original = recorridoOriginal (tablero, origen, destino, recorrido_original);
+                if (valido != valido_original || recorrido != recorrido_original) {
+                    fallos ++;
+                }
+            }
+        }
+        std::cout << "    tablero vacío: " << pares << " pares, " << fallos << " distintos" << std::endl;
+
+        // un muro de cada diez celdas, con semilla fija para que los fallos se puedan reproducir
+        std::mt19937 generador {20250401u};
+        for (CeldaReglas celda : celdas) {
+            if (generador () % 10 == 0) {
+                tablero.ponMuro (celda);
+            }
+        }
+        long pares_muros  = 0;
+        long fallos_muros = 0;
+        for (CeldaReglas origen : celdas) {
+            for (CeldaReglas destino : celdas) {
+                if (origen == destino) {
+                    continue;
+                }
+                pares_muros ++;
+                bool valido          = tablero.segmentoValido (origen, destino);
+                bool valido_original = recorridoOriginal (tablero, origen, destino, recorrido_original);
+                if (valido != valido_original) {
+                    fallos_muros ++;
+                }
+            }
+        }
+        std::cout << "    con muros:     " << pares_muros << " pares, " << fallos_muros << " distintos" << std::endl;
+
+        return fallos == 0 && fallos_muros == 0;
+    }
+
+}
@@ -0,0 +1,88 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo   PruebaVisibilidad.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "pruebas.h"
+
+namespace pruebas {
+
+    using namespace reglas;
+
+    namespace {
+
+        std::vector <CeldaReglas> celdasTablero () {
+            std::vector <CeldaReglas> celdas;
+            for (int fila = 1; fila <= TableroReglas::filas; ++ fila) {
+                for (int coln = 1; coln <= TableroReglas::columnas; ++ coln) {
+                    CeldaReglas celda {static_cast <int16_t> (fila), static_cast <int16_t> (coln)};
+                    if (TableroReglas::celdaEnTablero (celda)) {
+                        celdas.push_back (celda);
+                    }
+                }
+            }
+            return celdas;
+        }
+
+        // cuenta los destinos en los que el mapa de visibilidad y segmentoValido no coinciden
+        long comparaVisibilidad (
+                const TableroReglas &                tablero,
+                const TableroReglas::PlanoCeldas &   plano_camino,
+                const std::vector <CeldaReglas> &    celdas,
+                long &                               pares         ) {
+            TableroReglas::PlanoCeldas celdas_visibles;
+            long fallos = 0;
+            for (CeldaReglas origen : celdas) {
+                tablero.celdasVisibles (origen, plano_camino, celdas_visibles);
+                for (CeldaReglas destino : celdas) {
+                    if (origen == destino) {
+                        continue;
+                    }
+                    pares ++;
+                    bool visible = celdas_visibles.test (TableroReglas::indiceCelda (destino));
+                    if (visible != tablero.segmentoValido (origen, destino, plano_camino)) {
+                        fallos ++;
+                    }
+                }
+            }
+            return fallos;
+        }
+
+    }
+
+    bool pruebaCeldasVisibles () {
+        const std::vector <CeldaReglas> celdas = celdasTablero ();
+        TableroReglas tablero {};
+        TableroReglas::PlanoCeldas plano_camino {};
+
+        long pares  = 0;
+        long fallos = comparaVisibilidad (tablero, plano_camino, celdas, pares);
+        std::cout << "    tablero vacío:  " << pares << " pares, " << fallos << " distintos" << std::endl;
+
+        // muros, fichas y etapas de camino al azar, con semilla fija para que los fallos se puedan
+        // reproducir; la segunda disposición es más densa para que abunden los recorridos cortados
+        std::mt19937 generador {20250401u};
+        long total_fallos = fallos;
+        for (int densidad : {10, 4}) {
+            tablero.vacia ();
+            plano_camino.reset ();
+            for (CeldaReglas celda : celdas) {
+                unsigned int sorteo = generador () % (densidad * 4);
+                if (sorteo < 4) {
+                    tablero.ponMuro (celda);
+                } else if (sorteo == 4) {
+                    tablero.mueveFicha (CeldaReglas {0, 0}, celda);
+                } else if (sorteo == 5) {
+                    plano_camino.set (TableroReglas::indiceCelda (celda));
+                }
+            }
+            pares  = 0;
+            fallos = comparaVisibilidad (tablero, plano_camino, celdas, pares);
+            std::cout << "    ocupada 1 de " << std::left << std::setw (2) << densidad << std::right << ": "
+                      << pares << " pares, " << fallos << " distintos" << std::endl;
+            total_fallos += fallos;
+        }
+
+        return total_fallos == 0;
+    }
+
+}
@@ -0,0 +1,87 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo:  PruebasReglas.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace pruebas {
+
+
+    /*!
+     * \brief Compara TableroReglas::recorridoSegmento y segmentoValido con el recorrido en coma
+     *        flotante al que sustituyen, para todos los pares de celdas del tablero.
+     *
+     * Primero sobre el tablero vacío, comparando las celdas recorridas, y después con muros al azar,
+     * comparando la validez de cada segmento.
+     * \return true si coinciden en todos los pares.
+     */
+    bool pruebaRecorridoSegmento ();
+
+    /*!
+     * \brief Compara el mapa de TableroReglas::celdasVisibles desde cada celda del tablero con
+     *        TableroReglas::segmentoValido hacia todas las demás.
+     *
+     * Sobre el tablero vacío y con dos disposiciones al azar de muros, fichas y etapas de camino.
+     * \return true si coinciden en todos los pares.
+     */
+    bool pruebaCeldasVisibles ();
+
+    /*!
+     * \brief Compara TableroReglas::localizaCelda con el RejillaTablero::localizaCelda original en
+     *        un barrido de toda la rejilla cada cuarto de píxel.
+     *
+     * Solo se admiten las diferencias documentadas: en las costuras entre hexágonos, donde la nueva
+     * versión da la celda que contiene el punto, y en las muescas del margen donde la original no
+     * daba celda y ahora se obtiene una celda del borde.
+     * \return true si no hay otras diferencias.
+     */
+    bool pruebaLocalizacionCelda ();
+
+    /*!
+     * \brief Compara los puntos en juego de un camino calculados con reglas::DistanciaCamino, la
+     *        distancia acumulada etapa a etapa que usan ModoJuegoBase, AlcanceMovimiento y las reglas,
+     *        con los de volver a sumar todo el camino, en caminos al azar y con varios valores de los
+     *        píxeles por punto de acción.
+     * \return true si el redondeo coincide en todas las consultas.
+     */
+    bool pruebaDistanciaCamino ();
+
+    /*!
+     * \brief Compara el coste de los caminos de BusquedaCamino (A*) con el mínimo que da Dijkstra
+     *        sobre el mismo grafo, en consultas al azar sobre disposiciones de muros y etapas al azar.
+     *
+     * Comprueba también que hay camino si y solo si lo encuentra un recorrido en anchura, que los
+     * pasos van de vecina en vecina por celdas libres y que las etapas agrupadas son válidas al
+     * agregarlas una tras otra y no son más largas que los pasos.
+     * \return true si coinciden todas las consultas.
+     */
+    bool pruebaBusquedaCamino ();
+
+    /*!
+     * \brief Compara ReglasJuego::distribuyeAtaque con la suma de ReglasJuego::resuelveAtaque sobre
+     *        los cien valores aleatorios, para ventajas de -250 a 250 con varias tablas de grados.
+     * \return true si coinciden las probabilidades, el daño esperado y la probabilidad de derribar.
+     */
+    bool pruebaDistribucionAtaque ();
+
+    /*!
+     * \brief Mide el tiempo por llamada de TableroReglas::localizaCelda y de la versión original.
+     */
+    void medidaLocalizacionCelda ();
+
+    /*!
+     * \brief Mide el tiempo por llamada de las consultas de muro y de ocupación sobre los planos de
+     *        bits, como las hace OcupacionTablero, y de los recorridos de listas a los que sustituyen.
+     */
+    void medidaOcupacionCeldas ();
+
+    /*!
+     * \brief Mide el tiempo medio, el percentil 99 y el máximo por consulta de BusquedaCamino, con
+     *        tres densidades de muros.
+     */
+    void medidaBusquedaCamino ();
+
+
+}
@@ -0,0 +1,5 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo:  pch.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "pruebas.h"
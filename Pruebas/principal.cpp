@@ -0,0 +1,70 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo:  principal.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "pruebas.h"
+
+using namespace pruebas;
+
+
+struct Prueba {
+    std::string            nombre;
+    std::function <bool()> ejecuta;
+};
+
+
+struct Medida {
+    std::string            nombre;
+    std::function <void()> ejecuta;
+};
+
+
+int main (int argc, char * argv []) {
+    const std::vector <Prueba> pruebas {
+            Prueba {"recorrido de segmentos", pruebaRecorridoSegmento},
+            Prueba {"celdas visibles", pruebaCeldasVisibles},
+            Prueba {"localización de celdas", pruebaLocalizacionCelda},
+            Prueba {"distancia de los caminos", pruebaDistanciaCamino},
+            Prueba {"búsqueda de caminos", pruebaBusquedaCamino},
+            Prueba {"distribución de los ataques", pruebaDistribucionAtaque} };
+    const std::vector <Medida> medidas {
+            Medida {"localización de celdas", medidaLocalizacionCelda},
+            Medida {"ocupación de celdas", medidaOcupacionCeldas},
+            Medida {"búsqueda de caminos", medidaBusquedaCamino} };
+
+    bool con_medidas = false;
+    for (int indc = 1; indc < argc; ++ indc) {
+        std::string opcion {argv [indc]};
+        if (opcion == "--medidas") {
+            con_medidas = true;
+        } else {
+            std::cerr << "Uso: Pruebas [--medidas]" << std::endl;
+            return 1;
+        }
+    }
+
+    int fallidas = 0;
+    for (const Prueba & prueba : pruebas) {
+        std::cout << prueba.nombre << std::endl;
+        bool correcta;
+        try {
+            correcta = prueba.ejecuta ();
+        } catch (const std::exception & excepcion) {
+            std::cout << "    excepción: " << excepcion.what () << std::endl;
+            correcta = false;
+        }
+        std::cout << (correcta ? "    correcta" : "    FALLIDA") << std::endl;
+        if (! correcta) {
+            fallidas ++;
+        }
+    }
+    std::cout << std::endl << pruebas.size () - fallidas << " de " << pruebas.size () << " pruebas correctas" << std::endl;
+
+    if (con_medidas) {
+        for (const Medida & medida : medidas) {
+            std::cout << std::endl << "medida: " << medida.nombre << std::endl;
+            medida.ejecuta ();
+        }
+    }
+    return fallidas == 0 ? 0 : 1;
+}
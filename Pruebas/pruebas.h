@@ -0,0 +1,24 @@
+﻿// proyecto: Grupal/Pruebas
+// archivo:  pruebas.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+// Pruebas de la biblioteca de reglas. Comparan de forma exhaustiva las versiones optimizadas de la
+// geometría y de los cálculos con las implementaciones a las que sustituyen, sin ventana ni
+// recursos gráficos. El programa termina con código 1 si falla alguna prueba.
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <reglas.h>
+
+#include "PruebasReglas.h"
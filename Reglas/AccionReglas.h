@@ -0,0 +1,44 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  AccionReglas.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace reglas {
+
+
+    enum class TipoAccionReglas : uint8_t {
+        desplaza,
+        habilidad
+    };
+
+
+    /*!
+     * \brief Número máximo de etapas de un desplazamiento: cada etapa cuesta al menos un punto.
+     */
+    constexpr int maximoEtapas = maximoPuntosAccion;
+
+
+    /*
+     * \struct AccionReglas
+     * \brief Acción de un personaje: desplazarse por un camino o usar una habilidad.
+     *
+     * Para un desplazamiento se indican las etapas del camino, sin la celda de partida. Para una
+     * habilidad se indica el personaje objetivo (enfoque en personaje) o la celda central del área
+     * (enfoque en área), y el valor aleatorio entre 0 y 99 que decide la efectividad del ataque.
+     */
+    struct AccionReglas {
+        TipoAccionReglas tipo;
+        int8_t           personaje;
+        int8_t           habilidad;
+        int8_t           objetivo;
+        CeldaReglas      celda_area;
+        int8_t           aleatorio_100;
+        int8_t           cuenta_etapas;
+        std::array <CeldaReglas, maximoEtapas> etapas;
+    };
+
+
+}
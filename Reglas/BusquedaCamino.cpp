@@ -0,0 +1,169 @@
+﻿// proyecto: Grupal/Reglas
+// archivo   BusquedaCamino.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "reglas.h"
+
+namespace reglas {
+
+    namespace {
+        CeldaReglas desplaza (CeldaReglas celda, CeldaReglas paso) {
+            return CeldaReglas {
+                    static_cast <int16_t> (celda.fila + paso.fila),
+                    static_cast <int16_t> (celda.coln + paso.coln) };
+        }
+    }
+
+    BusquedaCamino::BusquedaCamino () {
+        constexpr int celdas = TableroReglas::celdas;
+        coste_celdas      .resize (celdas);
+        celdas_previas    .resize (celdas);
+        generacion_vista  .resize (celdas);
+        generacion_cerrada.resize (celdas);
+        nodos_abiertos    .reserve (celdas * pasosVecinos.size ());
+        pasos_camino      .reserve (celdas);
+        for (int indc = 0; indc < static_cast <int> (pasosVecinos.size ()); ++ indc) {
+            coste_pasos [indc] = TableroReglas::distancia (CeldaReglas {0, 0}, pasosVecinos [indc]);
+        }
+    }
+
+    bool BusquedaCamino::busca (
+            const TableroReglas &               tablero,
+            const TableroReglas::PlanoCeldas &  plano_camino,
+            CeldaReglas                         celda_origen,
+            CeldaReglas                         celda_destino,
+            std::vector <CeldaReglas> &         etapas        ) {
+        etapas.clear ();
+        pasos_camino.clear ();
+        coste_    = 0.0f;
+        longitud_ = 0.0f;
+        if (celda_origen == celda_destino) {
+            return false;
+        }
+        int indc_origen  = TableroReglas::indiceCelda (celda_origen);
+        int indc_destino = TableroReglas::indiceCelda (celda_destino);
+        if (indc_origen < 0 || indc_destino < 0) {
+            return false;
+        }
+        if (tablero.ocupada (celda_destino) || plano_camino.test (indc_destino)) {
+            return false;
+        }
+
+        avanzaGeneracion ();
+        auto mayor = [] (const NodoAbierto & uno, const NodoAbierto & otro) {
+            return uno.estimacion > otro.estimacion;
+        };
+
+        coste_celdas     [indc_origen] = 0.0f;
+        celdas_previas   [indc_origen] = -1;
+        generacion_vista [indc_origen] = generacion_;
+        nodos_abiertos.clear ();
+        nodos_abiertos.push_back (NodoAbierto {
+                TableroReglas::distancia (celda_origen, celda_destino), indc_origen });
+
+        while (! nodos_abiertos.empty ()) {
+            std::pop_heap (nodos_abiertos.begin (), nodos_abiertos.end (), mayor);
+            int indc_celda = nodos_abiertos.back ().indice;
+            nodos_abiertos.pop_back ();
+            if (generacion_cerrada [indc_celda] == generacion_) {
+                continue;
+            }
+            generacion_cerrada [indc_celda] = generacion_;
+            if (indc_celda == indc_destino) {
+                coste_ = coste_celdas [indc_destino];
+                reconstruyePasos (indc_origen, indc_destino);
+                agrupaEtapas (tablero, plano_camino, etapas);
+                return true;
+            }
+
+            CeldaReglas celda = celdaIndice (indc_celda);
+            for (int indc_paso = 0; indc_paso < static_cast <int> (pasosVecinos.size ()); ++ indc_paso) {
+                CeldaReglas vecina = desplaza (celda, pasosVecinos [indc_paso]);
+                int indc_vecina = TableroReglas::indiceCelda (vecina);
+                if (indc_vecina < 0) {
+                    continue;
+                }
+                if (generacion_cerrada [indc_vecina] == generacion_) {
+                    continue;
+                }
+                if (tablero.ocupada (vecina) || plano_camino.test (indc_vecina)) {
+                    continue;
+                }
+                float coste = coste_celdas [indc_celda] + coste_pasos [indc_paso];
+                if (generacion_vista [indc_vecina] == generacion_ && coste >= coste_celdas [indc_vecina]) {
+                    continue;
+                }
+                coste_celdas     [indc_vecina] = coste;
+                celdas_previas   [indc_vecina] = indc_celda;
+                generacion_vista [indc_vecina] = generacion_;
+                float estimacion = coste + TableroReglas::distancia (vecina, celda_destino);
+                nodos_abiertos.push_back (NodoAbierto {estimacion, indc_vecina});
+                std::push_heap (nodos_abiertos.begin (), nodos_abiertos.end (), mayor);
+            }
+        }
+        return false;
+    }
+
+    const std::vector <CeldaReglas> & BusquedaCamino::pasos () const {
+        return pasos_camino;
+    }
+
+    float BusquedaCamino::coste () const {
+        return coste_;
+    }
+
+    float BusquedaCamino::longitud () const {
+        return longitud_;
+    }
+
+    CeldaReglas BusquedaCamino::celdaIndice (int indice) {
+        return CeldaReglas {
+                static_cast <int16_t> (indice / TableroReglas::columnas + 1),
+                static_cast <int16_t> (indice % TableroReglas::columnas + 1) };
+    }
+
+    void BusquedaCamino::avanzaGeneracion () {
+        ++ generacion_;
+        if (generacion_ == 0) {
+            std::fill (generacion_vista  .begin (), generacion_vista  .end (), 0u);
+            std::fill (generacion_cerrada.begin (), generacion_cerrada.end (), 0u);
+            generacion_ = 1;
+        }
+    }
+
+    void BusquedaCamino::reconstruyePasos (int indice_origen, int indice_destino) {
+        pasos_camino.clear ();
+        for (int indc = indice_destino; indc != indice_origen; indc = celdas_previas [indc]) {
+            pasos_camino.push_back (celdaIndice (indc));
+        }
+        pasos_camino.push_back (celdaIndice (indice_origen));
+        std::reverse (pasos_camino.begin (), pasos_camino.end ());
+    }
+
+    void BusquedaCamino::agrupaEtapas (
+            const TableroReglas &               tablero,
+            const TableroReglas::PlanoCeldas &  plano_camino,
+            std::vector <CeldaReglas> &         etapas        ) {
+        // Cada etapa se alarga mientras el segmento recto desde su inicio siga siendo válido; así se
+        // funden los pasos alineados y se atajan los quiebros, sin que el coste supere al de A*.
+        // Las etapas ya puestas, del camino en curso y de este, cuentan como ocupadas, igual que al
+        // agregarlas en el juego; un paso entre vecinas no tiene celdas intermedias y siempre vale.
+        plano_etapas = plano_camino;
+        int ultimo = static_cast <int> (pasos_camino.size ()) - 1;
+        int inicio = 0;
+        etapas.push_back (pasos_camino [inicio]);
+        plano_etapas.set (TableroReglas::indiceCelda (pasos_camino [inicio]));
+        while (inicio < ultimo) {
+            int extremo = inicio + 1;
+            while (extremo < ultimo &&
+                   tablero.segmentoValido (pasos_camino [inicio], pasos_camino [extremo + 1], plano_etapas)) {
+                ++ extremo;
+            }
+            etapas.push_back (pasos_camino [extremo]);
+            plano_etapas.set (TableroReglas::indiceCelda (pasos_camino [extremo]));
+            longitud_ += TableroReglas::distancia (pasos_camino [inicio], pasos_camino [extremo]);
+            inicio = extremo;
+        }
+    }
+
+}
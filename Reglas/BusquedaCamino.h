@@ -0,0 +1,100 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  BusquedaCamino.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace reglas {
+
+
+    /*
+     * \class BusquedaCamino
+     * \brief Busca el camino más corto entre dos celdas de la rejilla.
+     *
+     * Aplica A* sobre el grafo de celdas vecinas. El coste de cada paso es la distancia entre los
+     * centros de los hexágonos y la heurística es la distancia en línea recta hasta el destino, que
+     * es consistente con ese coste y con el cálculo de puntos de acción de DistanciaCamino. Los pasos
+     * obtenidos se agrupan después en etapas rectas que serían válidas al agregarlas una tras otra:
+     * igual que en el juego, cada segmento no puede cruzar ni las etapas del camino en curso ni las
+     * que ya se han puesto en el camino calculado.
+     * Los búferes de la búsqueda se reservan una sola vez y se reutilizan en cada consulta.
+     */
+    class BusquedaCamino {
+    public:
+
+        /*!
+         * \brief Constructor. Reserva los búferes de la búsqueda.
+         */
+        BusquedaCamino ();
+
+        /*!
+         * \brief Busca el camino más corto entre dos celdas.
+         * \param tablero Muros y fichas.
+         * \param plano_camino Etapas del camino en curso, que cuentan como ocupadas.
+         * \param celda_origen Celda de partida (puede estar ocupada por la ficha que se mueve).
+         * \param celda_destino Celda de llegada.
+         * \param etapas Etapas del camino, empezando por la celda de origen.
+         * \return true si existe un camino, false en caso contrario.
+         */
+        bool busca (
+                const TableroReglas &               tablero,
+                const TableroReglas::PlanoCeldas &  plano_camino,
+                CeldaReglas                         celda_origen,
+                CeldaReglas                         celda_destino,
+                std::vector <CeldaReglas> &         etapas        );
+
+        /*!
+         * \brief Devuelve los pasos entre celdas vecinas del último camino encontrado, empezando por
+         *        la celda de origen.
+         */
+        const std::vector <CeldaReglas> & pasos () const;
+
+        /*!
+         * \brief Devuelve el coste de los pasos del último camino encontrado, en píxeles.
+         */
+        float coste () const;
+
+        /*!
+         * \brief Devuelve la longitud de las etapas del último camino encontrado, en píxeles.
+         */
+        float longitud () const;
+
+    private:
+
+        struct NodoAbierto {
+            float estimacion;
+            int   indice;
+        };
+
+        static constexpr std::array <CeldaReglas, 6> pasosVecinos {
+                CeldaReglas {-2,  0}, CeldaReglas {-1,  1}, CeldaReglas { 1,  1},
+                CeldaReglas { 2,  0}, CeldaReglas { 1, -1}, CeldaReglas {-1, -1}  };
+
+        std::array <float, 6> coste_pasos {};
+
+        std::vector <float>          coste_celdas {};
+        std::vector <int>            celdas_previas {};
+        std::vector <unsigned int>   generacion_vista {};
+        std::vector <unsigned int>   generacion_cerrada {};
+        unsigned int                 generacion_ {};
+        std::vector <NodoAbierto>    nodos_abiertos {};
+        std::vector <CeldaReglas>    pasos_camino {};
+        TableroReglas::PlanoCeldas   plano_etapas {};
+        float                        coste_ {};
+        float                        longitud_ {};
+
+        static CeldaReglas celdaIndice (int indice);
+
+        void avanzaGeneracion ();
+        void reconstruyePasos (int indice_origen, int indice_destino);
+        void agrupaEtapas (
+                const TableroReglas &               tablero,
+                const TableroReglas::PlanoCeldas &  plano_camino,
+                std::vector <CeldaReglas> &         etapas        );
+
+    };
+
+
+}
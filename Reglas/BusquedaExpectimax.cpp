@@ -0,0 +1,364 @@
+﻿// proyecto: Grupal/Reglas
+// archivo   BusquedaExpectimax.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "reglas.h"
+
+namespace reglas {
+
+    BusquedaExpectimax::BusquedaExpectimax (GeneradorAcciones & acciones) :
+            acciones_      {acciones},
+            transposicion (std::size_t {1} << bitsTransposicion) {
+    }
+
+    bool BusquedaExpectimax::busca (
+            const EstadoReglas &            estado,
+            const TurnoReglas &             turno,
+            int                             profundidad,
+            const std::function <bool ()> & agotado,
+            ResultadoBusqueda &             resultado   ) {
+        resultado = ResultadoBusqueda {};
+        std::vector <AccionReglas> & raiz = jugadas [0];
+        if (! generaJugadas (estado, turno, 0, raiz)) {
+            return false;
+        }
+
+        const CatalogoReglas & catalogo = acciones_.reglas ().catalogo ();
+        int propios = 0;
+        int ajenos  = 0;
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            if (catalogo.fichas [indc].lado == turno.lado) {
+                ++ propios;
+            } else {
+                ++ ajenos;
+            }
+        }
+        lado_raiz     = turno.lado;
+        cota_superior =   propios * (maximaVitalidad + bonoVivo + bonoAmenaza) + bonoVictoria + aproximacion;
+        cota_inferior = - ajenos  * (maximaVitalidad + bonoVivo + bonoAmenaza) - bonoVictoria;
+        std::fill (transposicion.begin (), transposicion.end (), EntradaTransposicion {});
+        nodos      = 0;
+        abandonada = false;
+        agotado_   = & agotado;
+
+        // La profundidad crece de dos en dos: si la última jugada es del contrario, la valoración no
+        // ve la respuesta del lado que busca y resulta demasiado pesimista.
+        resultado.accion = raiz [0];
+        resultado.valor  = cota_inferior;
+        profundidad = std::clamp (profundidad, 1, profundidadMaxima);
+        for (int iteracion = 1; iteracion <= profundidad; iteracion += 2) {
+            // la mejor acción de la iteración anterior se prueba primero
+            generaJugadas (estado, turno, firma (resultado.accion), raiz);
+            AccionReglas mejor = raiz [0];
+            float        alfa  = cota_inferior;
+            for (const AccionReglas & accion : raiz) {
+                float valor = promedia (estado, turno, accion, iteracion - 1, alfa, cota_superior, 1);
+                if (abandonada) {
+                    break;
+                }
+                if (valor > alfa) {
+                    alfa  = valor;
+                    mejor = accion;
+                }
+            }
+            if (abandonada) {
+                break;
+            }
+            resultado.accion      = mejor;
+            resultado.valor       = alfa;
+            resultado.profundidad = iteracion;
+        }
+        resultado.nodos = nodos;
+        agotado_ = nullptr;
+        return true;
+    }
+
+    uint64_t BusquedaExpectimax::clave (const EstadoReglas & estado, const TurnoReglas & turno) {
+        // FNV-1a por palabras de 16 bits; los muros no cambian durante la partida y no intervienen
+        uint64_t valor = 0xcbf29ce484222325ull;
+        auto mezcla = [& valor] (int dato) {
+            valor ^= static_cast <uint16_t> (dato);
+            valor *= 0x100000001b3ull;
+        };
+        mezcla (static_cast <int> (turno.modo));
+        mezcla (static_cast <int> (turno.lado));
+        mezcla (turno.acciones);
+        mezcla (turno.elegidos [0]);
+        mezcla (turno.elegidos [1]);
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            const PersonajeReglas & persj = estado.personajes [indc];
+            mezcla (persj.sitio.fila);
+            mezcla (persj.sitio.coln);
+            mezcla (persj.vitalidad);
+            mezcla (persj.puntos_accion);
+            for (int indc_estad = 0; indc_estad < maximoEstadisticas; ++ indc_estad) {
+                mezcla (persj.cambio_ataque  [indc_estad]);
+                mezcla (persj.cambio_defensa [indc_estad]);
+            }
+        }
+        return valor;
+    }
+
+    float BusquedaExpectimax::valora (
+            const EstadoReglas & estado,
+            TurnoReglas          turno,
+            int                  profundidad,
+            float                alfa,
+            float                beta,
+            int                  nivel       ) {
+        if (mide ()) {
+            return 0.0f;
+        }
+        if (profundidad == 0 || terminada (estado)) {
+            return evalua (estado);
+        }
+
+        uint64_t clave_estado = clave (estado, turno);
+        EntradaTransposicion & entrada = transposicion [clave_estado & ((std::size_t {1} << bitsTransposicion) - 1)];
+        uint32_t firma_primera = 0;
+        if (entrada.cota != CotaTransposicion::vacia && entrada.clave == clave_estado) {
+            firma_primera = entrada.firma;
+            if (entrada.profundidad >= profundidad) {
+                if (entrada.cota == CotaTransposicion::exacta) {
+                    return entrada.valor;
+                }
+                if (entrada.cota == CotaTransposicion::inferior && entrada.valor >= beta) {
+                    return entrada.valor;
+                }
+                if (entrada.cota == CotaTransposicion::superior && entrada.valor <= alfa) {
+                    return entrada.valor;
+                }
+            }
+        }
+
+        // si el lado no puede actuar empieza el turno del otro, y si tampoco puede se ha acabado la ronda
+        std::vector <AccionReglas> & lista = jugadas [nivel];
+        if (! generaJugadas (estado, turno, firma_primera, lista)) {
+            turno = ReglasJuego::cedeTurno (turno);
+            if (! generaJugadas (estado, turno, firma_primera, lista)) {
+                return evalua (estado);
+            }
+        }
+
+        bool  maximiza    = turno.lado == lado_raiz;
+        float alfa_origen = alfa;
+        float beta_origen = beta;
+        float mejor       = maximiza ? cota_inferior - 1.0f : cota_superior + 1.0f;
+        uint32_t firma_mejor = 0;
+        for (const AccionReglas & accion : lista) {
+            float valor = promedia (estado, turno, accion, profundidad - 1, alfa, beta, nivel + 1);
+            if (abandonada) {
+                return 0.0f;
+            }
+            if (maximiza ? valor > mejor : valor < mejor) {
+                mejor       = valor;
+                firma_mejor = firma (accion);
+            }
+            if (maximiza) {
+                alfa = std::max (alfa, valor);
+            } else {
+                beta = std::min (beta, valor);
+            }
+            if (alfa >= beta) {
+                break;
+            }
+        }
+
+        entrada.clave       = clave_estado;
+        entrada.valor       = mejor;
+        entrada.firma       = firma_mejor;
+        entrada.profundidad = static_cast <int8_t> (profundidad);
+        if (mejor <= alfa_origen) {
+            entrada.cota = CotaTransposicion::superior;
+        } else if (mejor >= beta_origen) {
+            entrada.cota = CotaTransposicion::inferior;
+        } else {
+            entrada.cota = CotaTransposicion::exacta;
+        }
+        return mejor;
+    }
+
+    float BusquedaExpectimax::promedia (
+            const EstadoReglas & estado,
+            const TurnoReglas &  turno,
+            const AccionReglas & accion,
+            int                  profundidad,
+            float                alfa,
+            float                beta,
+            int                  nivel       ) {
+        ReglasJuego & reglas = acciones_.reglas ();
+
+        std::array <int8_t, 101> inicios;
+        int tramos = 1;
+        if (accion.tipo == TipoAccionReglas::habilidad) {
+            tramos = reglas.tramosAleatorio (estado, accion, inicios);
+        } else {
+            inicios [0] = 0;
+            inicios [1] = 100;
+        }
+
+        EstadoReglas hijo   = estado;
+        AccionReglas tirada = accion;
+        if (tramos == 1) {
+            tirada.aleatorio_100 = inicios [0];
+            reglas.aplica (hijo, tirada);
+            return valora (hijo, reglas.sigueTurno (hijo, turno, accion.personaje), profundidad, alfa, beta, nivel);
+        }
+
+        // Star1: con las cotas de la valoración, la media parcial de los tramos ya vistos acota la
+        // media total y permite cortar sin ver el resto; cada tramo se busca con la ventana que aún
+        // puede cambiar el resultado.
+        float suma  = 0.0f;
+        float resto = 1.0f;
+        for (int tramo = 0; tramo < tramos; ++ tramo) {
+            float probabilidad = (inicios [tramo + 1] - inicios [tramo]) / 100.0f;
+            resto -= probabilidad;
+            float alfa_tramo = std::max (cota_inferior, (alfa - suma - cota_superior * resto) / probabilidad);
+            float beta_tramo = std::min (cota_superior, (beta - suma - cota_inferior * resto) / probabilidad);
+
+            if (tramo > 0) {
+                hijo = estado;
+            }
+            tirada.aleatorio_100 = inicios [tramo];
+            reglas.aplica (hijo, tirada);
+            float valor = valora (hijo, reglas.sigueTurno (hijo, turno, accion.personaje), profundidad, alfa_tramo, beta_tramo, nivel);
+            if (abandonada) {
+                return 0.0f;
+            }
+            suma += probabilidad * valor;
+            if (suma + cota_inferior * resto >= beta) {
+                return suma + cota_inferior * resto;
+            }
+            if (suma + cota_superior * resto <= alfa) {
+                return suma + cota_superior * resto;
+            }
+        }
+        return suma;
+    }
+
+    float BusquedaExpectimax::evalua (const EstadoReglas & estado) const {
+        const CatalogoReglas & catalogo = acciones_.reglas ().catalogo ();
+        float valor = 0.0f;
+        float acerca = 0.0f;
+        std::array <int, 2> vivos {};
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            const PersonajeReglas & persj = estado.personajes [indc];
+            LadoReglas lado = catalogo.fichas [indc].lado;
+            if (persj.vitalidad <= 0) {
+                continue;
+            }
+            ++ vivos [static_cast <int> (lado)];
+            // un personaje que puede atacar ya a un oponente vale más que uno que aún debe acercarse
+            float propio = persj.vitalidad + bonoVivo + (amenaza (estado, indc) ? bonoAmenaza : 0.0f);
+            if (lado == lado_raiz) {
+                valor  += propio;
+                acerca += GeneradorAcciones::distanciaOponente (estado, catalogo, lado, persj.sitio);
+            } else {
+                valor  -= propio;
+            }
+        }
+
+        int propios = vivos [static_cast <int> (lado_raiz)];
+        int ajenos  = vivos [static_cast <int> (ReglasJuego::contrario (lado_raiz))];
+        if (ajenos == 0) {
+            valor += bonoVictoria;
+        } else if (propios == 0) {
+            valor -= bonoVictoria;
+        } else {
+            // distancia media, en celdas, de los personajes propios al oponente más cercano
+            constexpr float lejana = static_cast <float> (TableroReglas::columnas);
+            float media = acerca / propios / TableroReglas::distanciaCeldas;
+            valor += aproximacion * (1.0f - std::min (media, lejana) / lejana);
+        }
+        return valor;
+    }
+
+    bool BusquedaExpectimax::generaJugadas (
+            const EstadoReglas &         estado,
+            const TurnoReglas &          turno,
+            uint32_t                     firma_primera,
+            std::vector <AccionReglas> & lista         ) {
+        const CatalogoReglas & catalogo = acciones_.reglas ().catalogo ();
+        acciones_.jugadas (estado, turno, lista);
+
+        // orden: la acción de la tabla de transposición, los ataques, las demás habilidades y los
+        // desplazamientos, en el orden en que llegan: de los más cercanos al oponente a los más alejados
+        auto final_habilidades = std::stable_partition (lista.begin (), lista.end (),
+                [] (const AccionReglas & accion) {
+                    return accion.tipo == TipoAccionReglas::habilidad;
+                } );
+        std::stable_partition (lista.begin (), final_habilidades,
+                [& catalogo] (const AccionReglas & accion) {
+                    return catalogo.habilidades [accion.habilidad].antagonista == AntagonistaReglas::oponente;
+                } );
+        if (firma_primera != 0) {
+            auto primera = std::find_if (lista.begin (), lista.end (),
+                    [firma_primera] (const AccionReglas & accion) {
+                        return firma (accion) == firma_primera;
+                    } );
+            if (primera != lista.end ()) {
+                std::rotate (lista.begin (), primera, primera + 1);
+            }
+        }
+        return ! lista.empty ();
+    }
+
+    bool BusquedaExpectimax::terminada (const EstadoReglas & estado) const {
+        const CatalogoReglas & catalogo = acciones_.reglas ().catalogo ();
+        std::array <bool, 2> vivos {};
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            if (estado.personajes [indc].vitalidad > 0) {
+                vivos [static_cast <int> (catalogo.fichas [indc].lado)] = true;
+            }
+        }
+        return ! vivos [0] || ! vivos [1];
+    }
+
+    bool BusquedaExpectimax::amenaza (const EstadoReglas & estado, int personaje) const {
+        const CatalogoReglas &  catalogo = acciones_.reglas ().catalogo ();
+        const FichaReglas &     ficha    = catalogo.fichas [personaje];
+        const PersonajeReglas & persj    = estado.personajes [personaje];
+        for (int indc = 0; indc < ficha.cuenta_habilidades; ++ indc) {
+            const HabilidadReglas & habilidad = catalogo.habilidades [ficha.habilidades [indc]];
+            if (habilidad.antagonista != AntagonistaReglas::oponente || habilidad.enfoque == EnfoqueReglas::si_mismo) {
+                continue;
+            }
+            if (habilidad.coste > persj.puntos_accion) {
+                continue;
+            }
+            for (int indc_opone = 0; indc_opone < estado.cuenta_personajes; ++ indc_opone) {
+                if (catalogo.fichas [indc_opone].lado == ficha.lado || estado.personajes [indc_opone].vitalidad <= 0) {
+                    continue;
+                }
+                if (ReglasJuego::distanciaAlcance (persj.sitio, estado.personajes [indc_opone].sitio) <= habilidad.alcance) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool BusquedaExpectimax::mide () {
+        if ((++ nodos & 1023) == 0 && (* agotado_) ()) {
+            abandonada = true;
+        }
+        return abandonada;
+    }
+
+    uint32_t BusquedaExpectimax::firma (const AccionReglas & accion) {
+        // tipo, personaje, habilidad y destino: la celda final del camino, el objetivo o el área
+        uint32_t destino;
+        uint32_t habilidad = 0;
+        if (accion.tipo == TipoAccionReglas::desplaza) {
+            destino = TableroReglas::indiceCelda (accion.etapas [accion.cuenta_etapas - 1]) + 1;
+        } else {
+            habilidad = static_cast <uint32_t> (accion.habilidad);
+            destino   = static_cast <uint32_t> (accion.objetivo + 1) |
+                        static_cast <uint32_t> (TableroReglas::indiceCelda (accion.celda_area) + 1) << 5;
+        }
+        uint32_t tipo = static_cast <uint32_t> (accion.tipo) + 1;
+        return tipo << 30 | static_cast <uint32_t> (accion.personaje) << 24 | habilidad << 18 | destino;
+    }
+
+
+}
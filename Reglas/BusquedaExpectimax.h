@@ -0,0 +1,142 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  BusquedaExpectimax.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace reglas {
+
+
+    /*
+     * \struct ResultadoBusqueda
+     * \brief Acción elegida por BusquedaExpectimax y datos de la búsqueda que la eligió.
+     */
+    struct ResultadoBusqueda {
+        AccionReglas accion;
+        float        valor;             /*!< valoración esperada para el lado que busca */
+        int          profundidad;       /*!< jugadas de la última iteración completa, 0 si ninguna */
+        int64_t      nodos;
+    };
+
+
+    /*
+     * \class BusquedaExpectimax
+     * \brief Busca la mejor acción de un lado con expectimax, poda alfa-beta y profundización iterativa.
+     *
+     * Cada jugada es una acción de un personaje vivo y con puntos de acción, en el orden de turnos del
+     * modo de juego; si al lado que le toca no le queda ningún personaje que pueda actuar, juega el
+     * otro, y si tampoco puede, la ronda ha terminado y el nodo es una hoja. Las habilidades de ataque abren un nodo de azar con los
+     * tramos de ReglasJuego::tramosAleatorio, que se poda con las cotas de la valoración (Star1). Las
+     * jugadas son las de GeneradorAcciones::jugadas, con pocas celdas candidatas para desplazarse.
+     * Se prueba primero la mejor acción de la tabla de transposición, luego los ataques,
+     * el resto de habilidades y los desplazamientos.
+     *
+     * La búsqueda no mide el tiempo: recibe una función que indica cuándo se ha agotado el presupuesto
+     * y la consulta cada pocos nodos. La iteración en curso se abandona y se entrega la última completa.
+     */
+    class BusquedaExpectimax {
+    public:
+
+        static constexpr int profundidadMaxima = 16;
+
+        /*!
+         * \brief Constructor.
+         * \param acciones Enumerador de acciones, con las reglas de la partida.
+         */
+        explicit BusquedaExpectimax (GeneradorAcciones & acciones);
+
+        /*!
+         * \brief Busca la mejor acción de un lado.
+         * \param estado Estado de la partida.
+         * \param turno Situación del turno; si el lado no tiene personaje elegido, elige también el
+         *              personaje que actúa.
+         * \param profundidad Jugadas de la última iteración, hasta profundidadMaxima.
+         * \param agotado Indica si se ha agotado el presupuesto de la búsqueda.
+         * \param resultado Acción elegida, ya validada.
+         * \return false si ningún personaje que puede actuar tiene una acción válida.
+         */
+        bool busca (
+                const EstadoReglas &            estado,
+                const TurnoReglas &             turno,
+                int                             profundidad,
+                const std::function <bool ()> & agotado,
+                ResultadoBusqueda &             resultado   );
+
+        /*!
+         * \brief Calcula la clave de un estado en la tabla de transposición.
+         * \param estado Estado de la partida.
+         * \param turno Situación del turno.
+         */
+        static uint64_t clave (const EstadoReglas & estado, const TurnoReglas & turno);
+
+    private:
+
+        enum class CotaTransposicion : uint8_t {
+            vacia,
+            exacta,
+            inferior,
+            superior
+        };
+
+        struct EntradaTransposicion {
+            uint64_t          clave;
+            float             valor;
+            uint32_t          firma;
+            int8_t            profundidad;
+            CotaTransposicion cota;
+        };
+
+        static constexpr int bitsTransposicion = 16;
+
+        static constexpr float bonoVivo     = 20.0f;
+        static constexpr float bonoVictoria = 1000.0f;
+        static constexpr float aproximacion = 5.0f;
+        static constexpr float bonoAmenaza  = 10.0f;
+
+        GeneradorAcciones & acciones_;
+
+        std::vector <EntradaTransposicion> transposicion;
+        std::array <std::vector <AccionReglas>, profundidadMaxima + 1> jugadas {};
+
+        LadoReglas                      lado_raiz {};
+        float                           cota_inferior {};
+        float                           cota_superior {};
+        int64_t                         nodos {};
+        bool                            abandonada {};
+        const std::function <bool ()> * agotado_ {};
+
+        float valora (
+                const EstadoReglas & estado,
+                TurnoReglas          turno,
+                int                  profundidad,
+                float                alfa,
+                float                beta,
+                int                  nivel       );
+        float promedia (
+                const EstadoReglas & estado,
+                const TurnoReglas &  turno,
+                const AccionReglas & accion,
+                int                  profundidad,
+                float                alfa,
+                float                beta,
+                int                  nivel       );
+        float evalua (const EstadoReglas & estado) const;
+
+        bool generaJugadas (
+                const EstadoReglas &         estado,
+                const TurnoReglas &          turno,
+                uint32_t                     firma_primera,
+                std::vector <AccionReglas> & lista         );
+
+        bool terminada (const EstadoReglas & estado) const;
+        bool amenaza (const EstadoReglas & estado, int personaje) const;
+        bool mide ();
+
+        static uint32_t firma (const AccionReglas & accion);
+
+    };
+
+
+}
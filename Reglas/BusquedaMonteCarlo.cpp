@@ -0,0 +1,439 @@
+﻿// proyecto: Grupal/Reglas
+// archivo   BusquedaMonteCarlo.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "reglas.h"
+
+namespace reglas {
+
+    BusquedaMonteCarlo::Trabajador::Trabajador (const CatalogoReglas & catalogo, uint64_t semilla) :
+            reglas   {catalogo},
+            acciones {reglas},
+            azar     {semilla} {
+    }
+
+    BusquedaMonteCarlo::BusquedaMonteCarlo (const CatalogoReglas & catalogo, int hilos, uint64_t semilla) :
+            catalogo_ {catalogo},
+            nodos     {std::make_unique <Nodo []> (capacidadNodos)} {
+        hilos = std::max (1, hilos);
+        std::seed_seq semillas {static_cast <uint32_t> (semilla), static_cast <uint32_t> (semilla >> 32)};
+        std::vector <uint64_t> semillas_hilos (hilos);
+        semillas.generate (semillas_hilos.begin (), semillas_hilos.end ());
+        for (int indc = 0; indc < hilos; ++ indc) {
+            trabajadores.push_back (std::make_unique <Trabajador> (catalogo, semillas_hilos [indc]));
+        }
+        // el trabajador 0 es el hilo que llama a busca
+        for (int indc = 1; indc < hilos; ++ indc) {
+            hilos_.emplace_back (& BusquedaMonteCarlo::espera, this, indc);
+        }
+    }
+
+    BusquedaMonteCarlo::~BusquedaMonteCarlo () {
+        {
+            std::lock_guard <std::mutex> bloqueo {cerrojo};
+            cierre = true;
+        }
+        aviso.notify_all ();
+        for (std::thread & hilo : hilos_) {
+            hilo.join ();
+        }
+    }
+
+    int BusquedaMonteCarlo::hilos () const {
+        return static_cast <int> (trabajadores.size ());
+    }
+
+    bool BusquedaMonteCarlo::busca (
+            const EstadoReglas &            estado,
+            const TurnoReglas &             turno,
+            int64_t                         simulaciones,
+            const std::function <bool ()> & agotado,
+            ResultadoBusqueda &             resultado     ) {
+        resultado = ResultadoBusqueda {};
+        Trabajador & principal = * trabajadores [0];
+        cuenta_nodos.store (1, std::memory_order_relaxed);
+        inicia (nodos [0], AccionReglas {}, ReglasJuego::contrario (turno.lado));
+        expande (0, principal, estado, turno);
+        int32_t primer_hijo  = nodos [0].primer_hijo .load (std::memory_order_relaxed);
+        int32_t cuenta_hijos = nodos [0].cuenta_hijos.load (std::memory_order_relaxed);
+        if (cuenta_hijos == 0) {
+            return false;
+        }
+        resultado.accion = nodos [primer_hijo].accion;
+        if (cuenta_hijos == 1) {
+            return true;
+        }
+
+        estado_raiz          = estado;
+        turno_raiz           = turno;
+        simulaciones_maximas = simulaciones;
+        agotado_             = & agotado;
+        simulaciones_hechas.store (0, std::memory_order_relaxed);
+        detenida.store (false, std::memory_order_relaxed);
+        for (std::unique_ptr <Trabajador> & trabajador : trabajadores) {
+            trabajador->profundidad = 0;
+        }
+        {
+            std::lock_guard <std::mutex> bloqueo {cerrojo};
+            ++ generacion;
+            ocupados = static_cast <int> (hilos_.size ());
+        }
+        aviso.notify_all ();
+        trabaja (0);
+        {
+            std::unique_lock <std::mutex> bloqueo {cerrojo};
+            aviso.wait (bloqueo, [this] () {
+                return ocupados == 0;
+            });
+        }
+        agotado_ = nullptr;
+
+        // se juega la acción más visitada, que es más estable que la de mejor promedio
+        int32_t mejor = primer_hijo;
+        for (int32_t indc = primer_hijo + 1; indc < primer_hijo + cuenta_hijos; ++ indc) {
+            if (nodos [indc].visitas.load (std::memory_order_relaxed) > nodos [mejor].visitas.load (std::memory_order_relaxed)) {
+                mejor = indc;
+            }
+        }
+        int32_t visitas = nodos [mejor].visitas.load (std::memory_order_relaxed);
+        resultado.accion = nodos [mejor].accion;
+        resultado.valor  = visitas > 0 ? nodos [mejor].suma.load (std::memory_order_relaxed) / visitas : 0.0f;
+        for (std::unique_ptr <Trabajador> & trabajador : trabajadores) {
+            resultado.profundidad = std::max (resultado.profundidad, trabajador->profundidad);
+        }
+        resultado.nodos = std::min (simulaciones_hechas.load (std::memory_order_relaxed), simulaciones);
+        return true;
+    }
+
+    void BusquedaMonteCarlo::espera (int indice) {
+        int vista = 0;
+        while (true) {
+            {
+                std::unique_lock <std::mutex> bloqueo {cerrojo};
+                aviso.wait (bloqueo, [this, & vista] () {
+                    return cierre || generacion != vista;
+                });
+                if (cierre) {
+                    return;
+                }
+                vista = generacion;
+            }
+            trabaja (indice);
+            {
+                std::lock_guard <std::mutex> bloqueo {cerrojo};
+                -- ocupados;
+            }
+            aviso.notify_all ();
+        }
+    }
+
+    void BusquedaMonteCarlo::trabaja (int indice) {
+        Trabajador & trabajador = * trabajadores [indice];
+        int64_t vueltas = 0;
+        while (! detenida.load (std::memory_order_relaxed)) {
+            if (indice == 0 && vueltas ++ % consultaAgotado == 0 && (* agotado_) ()) {
+                detenida.store (true, std::memory_order_relaxed);
+                break;
+            }
+            if (simulaciones_hechas.fetch_add (1, std::memory_order_relaxed) >= simulaciones_maximas) {
+                detenida.store (true, std::memory_order_relaxed);
+                break;
+            }
+            simula (trabajador);
+        }
+    }
+
+    void BusquedaMonteCarlo::simula (Trabajador & trabajador) {
+        EstadoReglas estado = estado_raiz;
+        TurnoReglas  turno  = turno_raiz;
+        std::vector <int32_t> & camino = trabajador.camino;
+        camino.clear ();
+        camino.push_back (0);
+
+        // descenso por el árbol, sorteando de nuevo el resultado de cada ataque
+        int32_t indice_nodo = 0;
+        while (! terminada (estado) && ajustaTurno (trabajador, estado, turno)) {
+            Nodo & nodo = nodos [indice_nodo];
+            ExpansionNodo expansion = nodo.expansion.load (std::memory_order_acquire);
+            if (expansion != ExpansionNodo::hecha) {
+                ExpansionNodo esperada = ExpansionNodo::pendiente;
+                if (nodo.expansion.compare_exchange_strong (esperada, ExpansionNodo::en_curso, std::memory_order_acq_rel)) {
+                    expande (indice_nodo, trabajador, estado, turno);
+                }
+                break;
+            }
+            int32_t indice_hijo = selecciona (nodo);
+            if (indice_hijo < 0) {
+                break;
+            }
+            // con otro sorteo el turno puede ser de otro lado o de otro personaje que al expandir
+            Nodo & hijo = nodos [indice_hijo];
+            int elegido = turno.elegidos [static_cast <int> (turno.lado)];
+            if (hijo.lado != turno.lado || (elegido >= 0 && elegido != hijo.accion.personaje)) {
+                break;
+            }
+            hijo.virtuales.fetch_add (1, std::memory_order_relaxed);
+            camino.push_back (indice_hijo);
+            AccionReglas accion = hijo.accion;
+            accion.aleatorio_100 = static_cast <int8_t> (trabajador.azar () % 100);
+            if (! trabajador.reglas.aplica (estado, accion)) {
+                break;
+            }
+            turno = trabajador.reglas.sigueTurno (estado, turno, accion.personaje);
+            indice_nodo = indice_hijo;
+        }
+        trabajador.profundidad = std::max (trabajador.profundidad, static_cast <int> (camino.size ()) - 1);
+
+        float valor = juega (trabajador, estado, turno, static_cast <int> (camino.size ()) - 1);
+        for (int32_t indc : camino) {
+            Nodo & nodo = nodos [indc];
+            nodo.suma.fetch_add (nodo.lado == turno_raiz.lado ? valor : 1.0f - valor, std::memory_order_relaxed);
+            nodo.visitas.fetch_add (1, std::memory_order_relaxed);
+            if (indc != 0) {
+                nodo.virtuales.fetch_sub (1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    float BusquedaMonteCarlo::juega (Trabajador & trabajador, EstadoReglas & estado, TurnoReglas & turno, int jugadas) {
+        int jugada = 0;
+        for (; jugada < jugadasSimulacion; ++ jugada) {
+            if (terminada (estado) || ! ajustaTurno (trabajador, estado, turno)) {
+                break;
+            }
+            // actúa el personaje elegido o, si el lado aún elige, el que más puntos de acción tiene
+            int actor = turno.elegidos [static_cast <int> (turno.lado)];
+            if (actor < 0) {
+                for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+                    if (catalogo_.fichas [indc].lado == turno.lado && ReglasJuego::activo (estado, indc) &&
+                            (actor < 0 || estado.personajes [indc].puntos_accion > estado.personajes [actor].puntos_accion)) {
+                        actor = indc;
+                    }
+                }
+            }
+            AccionReglas accion;
+            // un personaje sin ninguna acción válida pasa y agota sus puntos
+            if (! juegaActor (trabajador, estado, actor, accion) || ! trabajador.reglas.aplica (estado, accion)) {
+                estado.personajes [actor].puntos_accion = 0;
+            }
+            turno = trabajador.reglas.sigueTurno (estado, turno, actor);
+        }
+        return recompensa (estado, jugadas + jugada);
+    }
+
+    bool BusquedaMonteCarlo::juegaActor (
+            Trabajador &         trabajador,
+            const EstadoReglas & estado,
+            int                  actor,
+            AccionReglas &       accion     ) {
+        std::vector <AccionReglas> & lista = trabajador.lista;
+        trabajador.acciones.habilidades (estado, actor, lista);
+        const FichaReglas & ficha = catalogo_.fichas [actor];
+        int8_t aleatorio_100 = static_cast <int8_t> (trabajador.azar () % 100);
+        int    mejor_ataque  = -1;
+        int    mejor_dano    = 0;
+        // el ataque que más daño neto hace con el valor aleatorio ya sorteado, probado en una copia
+        for (int indc = 0; indc < static_cast <int> (lista.size ()); ++ indc) {
+            if (! ataca (lista [indc].habilidad)) {
+                continue;
+            }
+            EstadoReglas & prueba = trabajador.prueba;
+            prueba = estado;
+            AccionReglas ataque = lista [indc];
+            ataque.aleatorio_100 = aleatorio_100;
+            if (! trabajador.reglas.aplica (prueba, ataque)) {
+                continue;
+            }
+            int dano = 0;
+            for (int indc_persj = 0; indc_persj < estado.cuenta_personajes; ++ indc_persj) {
+                int perdida = estado.personajes [indc_persj].vitalidad - prueba.personajes [indc_persj].vitalidad;
+                dano += catalogo_.fichas [indc_persj].lado == ficha.lado ? - perdida : perdida;
+            }
+            if (dano > mejor_dano) {
+                mejor_dano   = dano;
+                mejor_ataque = indc;
+            }
+        }
+        if (mejor_ataque >= 0) {
+            accion = lista [mejor_ataque];
+            accion.aleatorio_100 = aleatorio_100;
+            return true;
+        }
+
+        // sin ataque útil se acerca al oponente guardando puntos para su ataque más barato; si no
+        // puede, usa otra habilidad, y si no tiene ninguna, se acerca con todos sus puntos
+        int reserva = maximoPuntosAccion;
+        for (int indc = 0; indc < ficha.cuenta_habilidades; ++ indc) {
+            if (ataca (ficha.habilidades [indc])) {
+                reserva = std::min (reserva, static_cast <int> (catalogo_.habilidades [ficha.habilidades [indc]].coste));
+            }
+        }
+        int puntos = estado.personajes [actor].puntos_accion;
+        if (puntos > reserva && acerca (trabajador, estado, actor, puntos - reserva, accion)) {
+            return true;
+        }
+        for (const AccionReglas & habilidad : lista) {
+            if (! ataca (habilidad.habilidad)) {
+                accion = habilidad;
+                accion.aleatorio_100 = aleatorio_100;
+                return true;
+            }
+        }
+        return acerca (trabajador, estado, actor, puntos, accion);
+    }
+
+    bool BusquedaMonteCarlo::acerca (
+            Trabajador &         trabajador,
+            const EstadoReglas & estado,
+            int                  actor,
+            int                  puntos,
+            AccionReglas &       accion     ) const {
+        LadoReglas  lado          = catalogo_.fichas [actor].lado;
+        CeldaReglas sitio         = estado.personajes [actor].sitio;
+        CeldaReglas destino       = sitio;
+        float       distn_destino = GeneradorAcciones::distanciaOponente (estado, catalogo_, lado, sitio);
+        for (CeldaReglas celda : trabajador.acciones.alcanzables (estado, actor, puntos)) {
+            float distn = GeneradorAcciones::distanciaOponente (estado, catalogo_, lado, celda);
+            if (distn < distn_destino) {
+                destino       = celda;
+                distn_destino = distn;
+            }
+        }
+        if (destino == sitio) {
+            return false;
+        }
+        trabajador.acciones.desplazamiento (actor, destino, accion);
+        return true;
+    }
+
+    bool BusquedaMonteCarlo::ataca (int habilidad) const {
+        const HabilidadReglas & datos = catalogo_.habilidades [habilidad];
+        return datos.antagonista == AntagonistaReglas::oponente && datos.enfoque != EnfoqueReglas::si_mismo;
+    }
+
+    bool BusquedaMonteCarlo::expande (
+            int32_t              indice_nodo,
+            Trabajador &         trabajador,
+            const EstadoReglas & estado,
+            const TurnoReglas &  turno       ) {
+        Nodo & nodo = nodos [indice_nodo];
+        std::vector <AccionReglas> & lista = trabajador.lista;
+        trabajador.acciones.jugadas (estado, turno, lista);
+        int32_t cuenta  = static_cast <int32_t> (lista.size ());
+        int32_t primero = 0;
+        // si el almacén se agota el nodo queda como hoja; se comprueba antes de reservar para que
+        // la cuenta de nodos no siga creciendo con las reservas fallidas
+        bool cabe = cuenta_nodos.load (std::memory_order_relaxed) + cuenta <= capacidadNodos;
+        if (cabe) {
+            primero = cuenta_nodos.fetch_add (cuenta, std::memory_order_relaxed);
+            cabe    = primero + cuenta <= capacidadNodos;
+        }
+        if (! cabe) {
+            cuenta = 0;
+        }
+        for (int32_t indc = 0; indc < cuenta; ++ indc) {
+            inicia (nodos [primero + indc], lista [indc], catalogo_.fichas [lista [indc].personaje].lado);
+        }
+        nodo.primer_hijo .store (primero, std::memory_order_relaxed);
+        nodo.cuenta_hijos.store (cuenta,  std::memory_order_relaxed);
+        nodo.expansion.store (ExpansionNodo::hecha, std::memory_order_release);
+        return cabe;
+    }
+
+    int32_t BusquedaMonteCarlo::selecciona (const Nodo & nodo) const {
+        int32_t primero = nodo.primer_hijo .load (std::memory_order_relaxed);
+        int32_t cuenta  = nodo.cuenta_hijos.load (std::memory_order_relaxed);
+        if (cuenta == 0) {
+            return -1;
+        }
+        int32_t visitas_nodo = nodo.visitas.load (std::memory_order_relaxed) + nodo.virtuales.load (std::memory_order_relaxed);
+        float   registro     = std::log (static_cast <float> (std::max (1, visitas_nodo)));
+        int32_t mejor        = primero;
+        float   puntuacion_mejor = - 1.0f;
+        for (int32_t indc = primero; indc < primero + cuenta; ++ indc) {
+            const Nodo & hijo = nodos [indc];
+            // las pérdidas virtuales cuentan como visitas sin recompensa
+            int32_t visitas = hijo.visitas.load (std::memory_order_relaxed) + hijo.virtuales.load (std::memory_order_relaxed);
+            if (visitas == 0) {
+                return indc;
+            }
+            float puntuacion = hijo.suma.load (std::memory_order_relaxed) / visitas +
+                               exploracion * std::sqrt (registro / visitas);
+            if (puntuacion > puntuacion_mejor) {
+                puntuacion_mejor = puntuacion;
+                mejor            = indc;
+            }
+        }
+        return mejor;
+    }
+
+    bool BusquedaMonteCarlo::ajustaTurno (Trabajador & trabajador, EstadoReglas & estado, TurnoReglas & turno) const {
+        // Un turno empezado sigue mientras su lado pueda actuar; si no, empieza el del otro lado. Como
+        // en el tapete (ModoJuegoBase::turnosDisponiblesAmbos), al empezar un turno empieza otra ronda
+        // si a alguno de los lados no le queda ningún personaje que pueda actuar. En el modo equipo
+        // el turno sin elegir es el final de una vuelta, y la siguiente empieza por su primer factor.
+        const ReglasJuego & reglas = trabajador.reglas;
+        bool empezado = turno.elegidos [0] >= 0 || turno.elegidos [1] >= 0;
+        if (empezado) {
+            if (reglas.puedeActuar (estado, turno, turno.lado)) {
+                return true;
+            }
+            turno = ReglasJuego::cedeTurno (turno);
+        }
+        if (! reglas.puedeActuar (estado, turno, LadoReglas::izquierda) ||
+            ! reglas.puedeActuar (estado, turno, LadoReglas::derecha)     ) {
+            reglas.restauraRonda (estado);
+        }
+        if (turno.modo == ModoReglas::equipo) {
+            int primero = reglas.siguienteFactor (estado, turno.inicial, -1);
+            if (primero < 0) {
+                return false;
+            }
+            turno.lado = catalogo_.fichas [primero].lado;
+            turno.elegidos [static_cast <int> (turno.lado)] = static_cast <int8_t> (primero);
+        }
+        return reglas.puedeActuar (estado, turno, turno.lado);
+    }
+
+    void BusquedaMonteCarlo::inicia (Nodo & nodo, const AccionReglas & accion, LadoReglas lado) const {
+        nodo.accion = accion;
+        nodo.lado   = lado;
+        nodo.primer_hijo .store (0, std::memory_order_relaxed);
+        nodo.cuenta_hijos.store (0, std::memory_order_relaxed);
+        nodo.visitas     .store (0, std::memory_order_relaxed);
+        nodo.virtuales   .store (0, std::memory_order_relaxed);
+        nodo.suma        .store (0.0f, std::memory_order_relaxed);
+        nodo.expansion   .store (ExpansionNodo::pendiente, std::memory_order_relaxed);
+    }
+
+    bool BusquedaMonteCarlo::terminada (const EstadoReglas & estado) const {
+        std::array <bool, 2> vivos {};
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            if (estado.personajes [indc].vitalidad > 0) {
+                vivos [static_cast <int> (catalogo_.fichas [indc].lado)] = true;
+            }
+        }
+        return ! vivos [0] || ! vivos [1];
+    }
+
+    float BusquedaMonteCarlo::recompensa (const EstadoReglas & estado, int jugadas) const {
+        // Una victoria vale más cuanto antes llega y una derrota, cuanto más tarda; si no, cuenta la
+        // proporción de vitalidad, que queda entre las dos. Sin esto, un lado que gana en todas las
+        // simulaciones no distingue las acciones que lo acercan a la victoria de las que la retrasan.
+        std::array <int, 2> vitalidad {};
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            vitalidad [static_cast <int> (catalogo_.fichas [indc].lado)] += std::max <int> (0, estado.personajes [indc].vitalidad);
+        }
+        int propia = vitalidad [static_cast <int> (turno_raiz.lado)];
+        int ajena  = vitalidad [1 - static_cast <int> (turno_raiz.lado)];
+        float duracion = margenDuracion * std::min (1.0f, static_cast <float> (jugadas) / jugadasSimulacion);
+        if (ajena == 0) {
+            return propia > 0 ? 1.0f - duracion : 0.5f;
+        }
+        if (propia == 0) {
+            return duracion;
+        }
+        return margenDuracion + (1.0f - 2.0f * margenDuracion) * propia / (propia + ajena);
+    }
+
+}
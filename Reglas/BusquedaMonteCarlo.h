@@ -0,0 +1,166 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  BusquedaMonteCarlo.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace reglas {
+
+
+    /*
+     * \class BusquedaMonteCarlo
+     * \brief Busca la mejor acción de un lado con Monte Carlo sobre un árbol (UCT), en varios hilos.
+     *
+     * Está pensada para los modos equipo y libre doble, en los que cada jugada tiene tantas
+     * alternativas que BusquedaExpectimax apenas pasa de la primera respuesta del contrario.
+     *
+     * Todos los hilos recorren el mismo árbol. Las estadísticas de los nodos son atómicas y no hay
+     * cerrojos: cada hilo que baja por un nodo le suma una pérdida virtual, que cuenta como una
+     * visita sin recompensa hasta que llega el resultado de su simulación, de modo que los demás
+     * hilos prefieren otras ramas. Un nodo se expande una sola vez; lo reclama el primer hilo que
+     * llega, y los demás simulan desde él mientras tanto. Los nodos salen de un almacén reservado al
+     * construir la búsqueda; si se agota, el árbol deja de crecer pero las simulaciones siguen.
+     *
+     * El azar de los ataques no abre nodos: en cada descenso se sortea de nuevo el valor aleatorio de
+     * cada acción, y si una acción del árbol ya no es válida con lo sorteado, la simulación empieza
+     * allí. Las simulaciones no enumeran todas las jugadas, que es lo más costoso: juegan como la
+     * política guion del simulador. Actúa el personaje elegido o el que más puntos tiene; hace el
+     * ataque de más daño neto con el valor aleatorio ya sorteado y, si no tiene ninguno útil, se
+     * acerca al oponente guardando puntos para su ataque más barato. Las acciones se aplican con
+     * ReglasJuego, que las valida igual que el tapete, y los turnos y las rondas siguen el orden del
+     * modo como en el tapete. Acaban al morir un lado o tras jugadasSimulacion jugadas; una victoria
+     * del lado que busca vale cerca de 1, más cuanto antes llega, una derrota cerca de 0, y si no,
+     * cuenta la proporción de vitalidad que le queda.
+     *
+     * Cada hilo tiene sus propias reglas, su enumerador de acciones y su generador aleatorio. Los
+     * hilos se crean con la búsqueda y esperan entre una jugada y la siguiente; el que llama a busca
+     * también simula, y es el único que consulta si se ha agotado el presupuesto.
+     */
+    class BusquedaMonteCarlo {
+    public:
+
+        static constexpr int capacidadNodos    = 1 << 17;
+        static constexpr int jugadasSimulacion = 40;
+
+        /*!
+         * \brief Constructor.
+         * \param catalogo Catálogo de la partida; debe durar tanto como la búsqueda.
+         * \param hilos Hilos que simulan, contando el que llama a busca; al menos uno.
+         * \param semilla Semilla de los generadores de los hilos.
+         */
+        BusquedaMonteCarlo (const CatalogoReglas & catalogo, int hilos, uint64_t semilla);
+
+        /*!
+         * \brief Destructor: detiene los hilos.
+         */
+        ~BusquedaMonteCarlo ();
+
+        BusquedaMonteCarlo (const BusquedaMonteCarlo &) = delete;
+        BusquedaMonteCarlo & operator = (const BusquedaMonteCarlo &) = delete;
+
+        /*!
+         * \brief Devuelve el número de hilos que simulan.
+         */
+        int hilos () const;
+
+        /*!
+         * \brief Busca la mejor acción de un lado.
+         * \param estado Estado de la partida.
+         * \param turno Situación del turno; si el lado no tiene personaje elegido, elige también el
+         *              personaje que actúa.
+         * \param simulaciones Simulaciones tras las que se detiene la búsqueda.
+         * \param agotado Indica si se ha agotado el presupuesto de la búsqueda.
+         * \param resultado Acción elegida, ya validada; la profundidad es la del descenso más largo
+         *                  y los nodos son las simulaciones hechas.
+         * \return false si ningún personaje que puede actuar tiene una acción válida.
+         */
+        bool busca (
+                const EstadoReglas &            estado,
+                const TurnoReglas &             turno,
+                int64_t                         simulaciones,
+                const std::function <bool ()> & agotado,
+                ResultadoBusqueda &             resultado     );
+
+    private:
+
+        enum class ExpansionNodo : uint8_t {
+            pendiente,
+            en_curso,
+            hecha
+        };
+
+        /*
+         * Nodo del árbol. La acción y el lado se escriben antes de publicar el nodo con la expansión
+         * de su padre; el resto se lee y se escribe desde varios hilos.
+         */
+        struct Nodo {
+            AccionReglas                 accion;
+            LadoReglas                   lado;           // lado que hace la acción del nodo
+            std::atomic <ExpansionNodo>  expansion;
+            std::atomic <int32_t>        primer_hijo;
+            std::atomic <int32_t>        cuenta_hijos;
+            std::atomic <int32_t>        visitas;
+            std::atomic <int32_t>        virtuales;
+            std::atomic <float>          suma;           // recompensas del lado del nodo
+        };
+
+        /*
+         * Datos de trabajo de un hilo.
+         */
+        struct Trabajador {
+            ReglasJuego                reglas;
+            GeneradorAcciones          acciones;
+            std::mt19937_64            azar;
+            std::vector <AccionReglas> lista {};
+            EstadoReglas               prueba {};
+            std::vector <int32_t>      camino {};
+            int                        profundidad {};
+
+            Trabajador (const CatalogoReglas & catalogo, uint64_t semilla);
+        };
+
+        static constexpr float exploracion      = 0.7f;
+        static constexpr int   consultaAgotado  = 64;
+        static constexpr float margenDuracion   = 0.1f;
+
+        const CatalogoReglas &                     catalogo_;
+        std::vector <std::unique_ptr <Trabajador>> trabajadores;
+        std::vector <std::thread>                  hilos_;
+        std::unique_ptr <Nodo []>                  nodos;
+
+        std::mutex              cerrojo;
+        std::condition_variable aviso;
+        int                     generacion {};
+        int                     ocupados {};
+        bool                    cierre {};
+
+        EstadoReglas                    estado_raiz {};
+        TurnoReglas                     turno_raiz {};
+        int64_t                         simulaciones_maximas {};
+        const std::function <bool ()> * agotado_ {};
+        std::atomic <int32_t>           cuenta_nodos {};
+        std::atomic <int64_t>           simulaciones_hechas {};
+        std::atomic <bool>              detenida {};
+
+        void espera (int indice);
+        void trabaja (int indice);
+        void simula (Trabajador & trabajador);
+        float juega (Trabajador & trabajador, EstadoReglas & estado, TurnoReglas & turno, int jugadas);
+        bool juegaActor (Trabajador & trabajador, const EstadoReglas & estado, int actor, AccionReglas & accion);
+        bool acerca (Trabajador & trabajador, const EstadoReglas & estado, int actor, int puntos, AccionReglas & accion) const;
+        bool ataca (int habilidad) const;
+
+        bool expande (int32_t indice_nodo, Trabajador & trabajador, const EstadoReglas & estado, const TurnoReglas & turno);
+        int32_t selecciona (const Nodo & nodo) const;
+        bool ajustaTurno (Trabajador & trabajador, EstadoReglas & estado, TurnoReglas & turno) const;
+        void inicia (Nodo & nodo, const AccionReglas & accion, LadoReglas lado) const;
+
+        bool terminada (const EstadoReglas & estado) const;
+        float recompensa (const EstadoReglas & estado, int jugadas) const;
+
+    };
+
+
+}
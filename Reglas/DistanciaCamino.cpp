@@ -0,0 +1,54 @@
+﻿// proyecto: Grupal/Reglas
+// archivo   DistanciaCamino.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "reglas.h"
+
+namespace reglas {
+
+    void DistanciaCamino::vacia () {
+        longitud_ = 0.0f;
+        ultima_   = CeldaReglas {};
+        vacio_    = true;
+    }
+
+    void DistanciaCamino::agrega (CeldaReglas celda) {
+        if (! vacio_) {
+            longitud_ += TableroReglas::distancia (ultima_, celda);
+        }
+        ultima_ = celda;
+        vacio_  = false;
+    }
+
+    bool DistanciaCamino::vacio () const {
+        return vacio_;
+    }
+
+    CeldaReglas DistanciaCamino::ultima () const {
+        aserta (! vacio_, "camino vacío");
+        return ultima_;
+    }
+
+    float DistanciaCamino::longitud () const {
+        return longitud_;
+    }
+
+    int DistanciaCamino::puntos (float puntos_accion_de_desplaza) const {
+        return ReglasJuego::puntosDesplaza (longitud_, puntos_accion_de_desplaza);
+    }
+
+    int DistanciaCamino::puntosHasta (CeldaReglas proxima_celda, float puntos_accion_de_desplaza) const {
+        aserta (! vacio_, "camino vacío");
+        float distn = longitud_;
+        distn += TableroReglas::distancia (ultima_, proxima_celda);
+        return ReglasJuego::puntosDesplaza (distn, puntos_accion_de_desplaza);
+    }
+
+    void DistanciaCamino::aserta (bool expresion, const std::string & mensaje) {
+        if (expresion) {
+            return;
+        }
+        throw std::logic_error (mensaje);
+    }
+
+}
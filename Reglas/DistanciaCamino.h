@@ -0,0 +1,73 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  DistanciaCamino.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace reglas {
+
+
+    /*
+     * \class DistanciaCamino
+     * \brief Longitud de un camino que se traza etapa a etapa y puntos de acción que cuesta.
+     *
+     * La distancia de cada etapa se suma al agregarla, en el mismo orden en que se traza el camino,
+     * así que probar una celda más cuesta una sola distancia y el redondeo es el mismo que el de
+     * volver a sumar todo el camino. La usan ModoJuegoBase, AlcanceMovimiento y las reglas.
+     */
+    class DistanciaCamino {
+    public:
+
+        /*!
+         * \brief Olvida el camino.
+         */
+        void vacia ();
+
+        /*!
+         * \brief Agrega una celda al final del camino; la primera es la de partida.
+         * \param celda Celda de llegada de la etapa.
+         */
+        void agrega (CeldaReglas celda);
+
+        /*!
+         * \brief Indica si el camino no tiene ninguna celda.
+         */
+        bool vacio () const;
+
+        /*!
+         * \brief Devuelve la última celda del camino, de la que sale la próxima etapa.
+         */
+        CeldaReglas ultima () const;
+
+        /*!
+         * \brief Devuelve la longitud del camino, en píxeles.
+         */
+        float longitud () const;
+
+        /*!
+         * \brief Calcula los puntos de acción que cuesta el camino.
+         * \param puntos_accion_de_desplaza Píxeles que se recorren por punto de acción.
+         */
+        int puntos (float puntos_accion_de_desplaza) const;
+
+        /*!
+         * \brief Calcula los puntos de acción que costaría el camino con una etapa más.
+         * \param proxima_celda Celda de llegada de la etapa que se prueba.
+         * \param puntos_accion_de_desplaza Píxeles que se recorren por punto de acción.
+         */
+        int puntosHasta (CeldaReglas proxima_celda, float puntos_accion_de_desplaza) const;
+
+    private:
+
+        float       longitud_ {};
+        CeldaReglas ultima_ {};
+        bool        vacio_ {true};
+
+        static void aserta (bool expresion, const std::string & mensaje);
+
+    };
+
+
+}
@@ -0,0 +1,155 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  EstadoReglas.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace reglas {
+
+
+    // Los enumerados siguen el orden de LadoTablero, EnfoqueHabilidad, AccesoHabilidad y Antagonista
+    // del tapete, que los traduce con una conversión directa.
+
+    enum class LadoReglas : uint8_t {
+        izquierda,
+        derecha
+    };
+
+    enum class EnfoqueReglas : uint8_t {
+        si_mismo,
+        personaje,
+        area
+    };
+
+    enum class AccesoReglas : uint8_t {
+        ninguno,
+        directo,
+        indirecto
+    };
+
+    enum class AntagonistaReglas : uint8_t {
+        oponente,
+        aliado,
+        si_mismo
+    };
+
+
+    constexpr int maximoPersonajes       = 16;
+    constexpr int maximoHabilidades      = 32;
+    constexpr int maximoHabilidadesFicha = 10;
+    constexpr int maximoEstadisticas     = 8;
+    constexpr int maximoGrados           = 8;
+    constexpr int maximoEfectos          = 4;
+
+    constexpr int maximaVitalidad    = 100;
+    constexpr int maximoPuntosAccion = 20;
+
+    /*!
+     * \brief Índice de estadística que indica que no se ha establecido.
+     */
+    constexpr int8_t sinEstadistica = -1;
+
+
+    /*
+     * \struct EfectoReglas
+     * \brief Cambio que aplica una habilidad sobre una estadística de ataque o de defensa.
+     */
+    struct EfectoReglas {
+        int8_t  estadistica;
+        int16_t valor;
+    };
+
+    /*
+     * \struct HabilidadReglas
+     * \brief Datos de una habilidad que intervienen en las reglas.
+     */
+    struct HabilidadReglas {
+        EnfoqueReglas     enfoque;
+        AccesoReglas      acceso;
+        AntagonistaReglas antagonista;
+        int8_t            coste;
+        int8_t            alcance;
+        int8_t            radio;
+        int8_t            ataque;
+        int8_t            defensa;
+        int8_t            dano;
+        int16_t           valor_dano;
+        int16_t           valor_curacion;
+        int8_t            cuenta_efectos_ataque;
+        int8_t            cuenta_efectos_defensa;
+        std::array <EfectoReglas, maximoEfectos> efectos_ataque;
+        std::array <EfectoReglas, maximoEfectos> efectos_defensa;
+    };
+
+    /*
+     * \struct GradoReglas
+     * \brief Grado de efectividad: límite superior del ataque final y porcentaje de daño.
+     */
+    struct GradoReglas {
+        int32_t valor_superior;
+        int16_t porciento_dano;
+    };
+
+    /*
+     * \struct FichaReglas
+     * \brief Datos fijos de un personaje: lado, iniciativa, habilidades y estadísticas de partida.
+     *
+     * Las máscaras indican qué estadísticas tiene el personaje; un bit por índice de estadística.
+     */
+    struct FichaReglas {
+        LadoReglas lado;
+        int8_t     iniciativa;
+        int8_t     puntos_accion_ronda;
+        int8_t     cuenta_habilidades;
+        std::array <int8_t,  maximoHabilidadesFicha> habilidades;
+        uint8_t    con_ataque;
+        uint8_t    con_defensa;
+        uint8_t    con_reduce_dano;
+        std::array <int16_t, maximoEstadisticas> ataque;
+        std::array <int16_t, maximoEstadisticas> defensa;
+        std::array <int16_t, maximoEstadisticas> reduce_dano;
+    };
+
+    /*
+     * \struct CatalogoReglas
+     * \brief Configuración de la partida que no cambia al aplicar acciones.
+     */
+    struct CatalogoReglas {
+        int   cuenta_personajes;
+        int   cuenta_habilidades;
+        int   cuenta_grados;
+        float puntos_accion_de_desplaza;
+        std::array <FichaReglas,     maximoPersonajes>  fichas;
+        std::array <HabilidadReglas, maximoHabilidades> habilidades;
+        std::array <GradoReglas,     maximoGrados>      grados;
+    };
+
+    /*
+     * \struct PersonajeReglas
+     * \brief Estado variable de un personaje durante la partida.
+     */
+    struct PersonajeReglas {
+        CeldaReglas sitio;
+        int16_t     vitalidad;
+        int8_t      puntos_accion;
+        std::array <int16_t, maximoEstadisticas> cambio_ataque;
+        std::array <int16_t, maximoEstadisticas> cambio_defensa;
+    };
+
+    /*
+     * \struct EstadoReglas
+     * \brief Estado completo de una partida para las reglas: personajes y ocupación del tablero.
+     *
+     * Es un agregado de datos sin punteros, así que se copia con una simple asignación; las
+     * simulaciones lo duplican para explorar alternativas sin deshacer acciones.
+     */
+    struct EstadoReglas {
+        int cuenta_personajes;
+        std::array <PersonajeReglas, maximoPersonajes> personajes;
+        TableroReglas tablero;
+    };
+
+
+}
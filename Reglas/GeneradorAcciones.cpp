@@ -0,0 +1,222 @@
+﻿// proyecto: Grupal/Reglas
+// archivo   GeneradorAcciones.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "reglas.h"
+
+namespace reglas {
+
+    GeneradorAcciones::GeneradorAcciones (ReglasJuego & reglas) :
+            reglas_ {reglas},
+            celda_previa (TableroReglas::celdas, -1) {
+    }
+
+    ReglasJuego & GeneradorAcciones::reglas () {
+        return reglas_;
+    }
+
+    void GeneradorAcciones::habilidades (
+            const EstadoReglas &         estado,
+            int                          personaje,
+            std::vector <AccionReglas> & acciones  ) {
+        acciones.clear ();
+        const FichaReglas & ficha = reglas_.catalogo ().fichas [personaje];
+        int puntos_en_juego;
+        for (int indc = 0; indc < ficha.cuenta_habilidades; ++ indc) {
+            int indc_habld = ficha.habilidades [indc];
+            const HabilidadReglas & habilidad = reglas_.catalogo ().habilidades [indc_habld];
+            AccionReglas accion = accionHabilidad (personaje, indc_habld);
+            if (habilidad.enfoque == EnfoqueReglas::si_mismo) {
+                if (reglas_.valida (estado, accion, puntos_en_juego)) {
+                    acciones.push_back (accion);
+                }
+                continue;
+            }
+            // los objetivos muertos siguen en el tablero, pero usar una habilidad con ellos no
+            // tiene efecto, así que no se ofrecen
+            for (int indc_objtv = 0; indc_objtv < estado.cuenta_personajes; ++ indc_objtv) {
+                if (estado.personajes [indc_objtv].vitalidad <= 0) {
+                    continue;
+                }
+                if (habilidad.enfoque == EnfoqueReglas::personaje) {
+                    accion.objetivo = static_cast <int8_t> (indc_objtv);
+                } else {
+                    accion.celda_area = estado.personajes [indc_objtv].sitio;
+                }
+                if (reglas_.valida (estado, accion, puntos_en_juego)) {
+                    acciones.push_back (accion);
+                }
+            }
+        }
+    }
+
+    const std::vector <CeldaReglas> & GeneradorAcciones::alcanzables (
+            const EstadoReglas & estado, int personaje, int puntos) {
+        static constexpr std::array <CeldaReglas, 6> vecinas {
+                CeldaReglas {-2,  0}, CeldaReglas {-1,  1}, CeldaReglas { 1,  1},
+                CeldaReglas { 2,  0}, CeldaReglas { 1, -1}, CeldaReglas {-1, -1}  };
+
+        for (CeldaReglas celda : celdas_visitadas) {
+            celda_previa [TableroReglas::indiceCelda (celda)] = -1;
+        }
+        celdas_visitadas.clear ();
+
+        // El origen se marca como su propia celda previa, que es donde acaba la reconstrucción de
+        // los caminos. El recorrido va por capas: la capa n son las celdas a n pasos del origen.
+        CeldaReglas origen = estado.personajes [personaje].sitio;
+        int indc_origen = TableroReglas::indiceCelda (origen);
+        celda_previa [indc_origen] = static_cast <int16_t> (indc_origen);
+        celdas_visitadas.push_back (origen);
+        int inicio_capa = 0;
+        for (int pasos = 0; pasos < puntos && inicio_capa < static_cast <int> (celdas_visitadas.size ()); ++ pasos) {
+            int final_capa = static_cast <int> (celdas_visitadas.size ());
+            for (int indc = inicio_capa; indc < final_capa; ++ indc) {
+                CeldaReglas celda_sale = celdas_visitadas [indc];
+                for (CeldaReglas paso : vecinas) {
+                    CeldaReglas celda_llega {
+                            static_cast <int16_t> (celda_sale.fila + paso.fila),
+                            static_cast <int16_t> (celda_sale.coln + paso.coln) };
+                    int indc_llega = TableroReglas::indiceCelda (celda_llega);
+                    if (indc_llega < 0 || celda_previa [indc_llega] >= 0) {
+                        continue;
+                    }
+                    if (estado.tablero.ocupada (celda_llega)) {
+                        continue;
+                    }
+                    celda_previa [indc_llega] = static_cast <int16_t> (TableroReglas::indiceCelda (celda_sale));
+                    celdas_visitadas.push_back (celda_llega);
+                }
+            }
+            inicio_capa = final_capa;
+        }
+
+        celdas_alcanzables.assign (celdas_visitadas.begin () + 1, celdas_visitadas.end ());
+        return celdas_alcanzables;
+    }
+
+    void GeneradorAcciones::desplazamiento (int personaje, CeldaReglas destino, AccionReglas & accion) const {
+        accion = AccionReglas {};
+        accion.tipo      = TipoAccionReglas::desplaza;
+        accion.personaje = static_cast <int8_t> (personaje);
+
+        std::array <CeldaReglas, maximoEtapas> inversas;
+        int cuenta = 0;
+        int indc = TableroReglas::indiceCelda (destino);
+        while (celda_previa [indc] != indc) {
+            inversas [cuenta ++] = CeldaReglas {
+                    static_cast <int16_t> (indc / TableroReglas::columnas + 1),
+                    static_cast <int16_t> (indc % TableroReglas::columnas + 1) };
+            indc = celda_previa [indc];
+        }
+        accion.cuenta_etapas = static_cast <int8_t> (cuenta);
+        for (int etapa = 0; etapa < cuenta; ++ etapa) {
+            accion.etapas [etapa] = inversas [cuenta - 1 - etapa];
+        }
+    }
+
+    void GeneradorAcciones::jugadas (
+            const EstadoReglas &         estado,
+            const TurnoReglas &          turno,
+            std::vector <AccionReglas> & acciones ) {
+        const CatalogoReglas & catalogo = reglas_.catalogo ();
+        int elegido = turno.elegidos [static_cast <int> (turno.lado)];
+        acciones.clear ();
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            if (catalogo.fichas [indc].lado != turno.lado || (elegido >= 0 && elegido != indc)) {
+                continue;
+            }
+            if (! ReglasJuego::activo (estado, indc)) {
+                continue;
+            }
+            habilidades (estado, indc, habilidades_jugadas);
+            acciones.insert (acciones.end (), habilidades_jugadas.begin (), habilidades_jugadas.end ());
+            desplazamientos (estado, indc, acciones);
+        }
+    }
+
+    void GeneradorAcciones::desplazamientos (
+            const EstadoReglas &         estado,
+            int                          personaje,
+            std::vector <AccionReglas> & acciones  ) {
+        const CatalogoReglas &  catalogo = reglas_.catalogo ();
+        const FichaReglas &     ficha    = catalogo.fichas [personaje];
+        const PersonajeReglas & persj    = estado.personajes [personaje];
+
+        constexpr int lejanas  = candidatosDesplaza / 4;
+        constexpr int cercanas = (candidatosDesplaza - lejanas) / 2;
+        int coste_ataque = maximoPuntosAccion + 1;
+        for (int indc = 0; indc < ficha.cuenta_habilidades; ++ indc) {
+            const HabilidadReglas & habilidad = catalogo.habilidades [ficha.habilidades [indc]];
+            if (habilidad.antagonista == AntagonistaReglas::oponente) {
+                coste_ataque = std::min (coste_ataque, static_cast <int> (habilidad.coste));
+            }
+        }
+
+        std::size_t inicio = acciones.size ();
+        auto agrega = [&] (int primera, int ultima) {
+            for (int indc = primera; indc < ultima; ++ indc) {
+                AccionReglas accion;
+                desplazamiento (personaje, celdas_candidatas [indc].second, accion);
+                CeldaReglas destino = accion.etapas [accion.cuenta_etapas - 1];
+                bool repetida = std::any_of (acciones.begin () + inicio, acciones.end (),
+                        [destino] (const AccionReglas & otra) {
+                            return otra.etapas [otra.cuenta_etapas - 1] == destino;
+                        } );
+                int puntos_en_juego;
+                if (! repetida && reglas_.valida (estado, accion, puntos_en_juego)) {
+                    acciones.push_back (accion);
+                }
+            }
+        };
+        auto ordena = [&] (int puntos) {
+            celdas_candidatas.clear ();
+            for (CeldaReglas celda : alcanzables (estado, personaje, puntos)) {
+                celdas_candidatas.emplace_back (distanciaOponente (estado, catalogo, ficha.lado, celda), celda);
+            }
+            // a igual distancia se conserva el orden por pasos del recorrido en anchura
+            std::stable_sort (celdas_candidatas.begin (), celdas_candidatas.end (),
+                    [] (const auto & una, const auto & otra) {
+                        return una.first < otra.first;
+                    } );
+            return static_cast <int> (celdas_candidatas.size ());
+        };
+
+        if (coste_ataque < persj.puntos_accion) {
+            int cuenta = ordena (persj.puntos_accion - coste_ataque);
+            agrega (0, std::min (cuenta, cercanas));
+        }
+        int cuenta = ordena (persj.puntos_accion);
+        agrega (0, std::min (cuenta, cercanas));
+        agrega (std::max (cercanas, cuenta - lejanas), cuenta);
+    }
+
+    float GeneradorAcciones::distanciaOponente (
+            const EstadoReglas &   estado,
+            const CatalogoReglas & catalogo,
+            LadoReglas             lado,
+            CeldaReglas            celda    ) {
+        float minima = 0.0f;
+        bool  con_oponente = false;
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            if (catalogo.fichas [indc].lado == lado || estado.personajes [indc].vitalidad <= 0) {
+                continue;
+            }
+            float distn = TableroReglas::distancia (celda, estado.personajes [indc].sitio);
+            if (! con_oponente || distn < minima) {
+                minima       = distn;
+                con_oponente = true;
+            }
+        }
+        return minima;
+    }
+
+    AccionReglas GeneradorAcciones::accionHabilidad (int personaje, int habilidad) {
+        AccionReglas accion {};
+        accion.tipo      = TipoAccionReglas::habilidad;
+        accion.personaje = static_cast <int8_t> (personaje);
+        accion.habilidad = static_cast <int8_t> (habilidad);
+        accion.objetivo  = -1;
+        return accion;
+    }
+
+}
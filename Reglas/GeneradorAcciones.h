@@ -0,0 +1,125 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  GeneradorAcciones.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace reglas {
+
+
+    /*
+     * \class GeneradorAcciones
+     * \brief Enumera las acciones válidas de un personaje para elegir entre ellas.
+     *
+     * Lo usan las políticas del simulador, BusquedaExpectimax y BusquedaMonteCarlo.
+     *
+     * Las habilidades se prueban con cada objetivo posible. Los desplazamientos se calculan con una
+     * búsqueda en anchura por celdas vecinas libres: cada paso entre vecinas cuesta un punto de
+     * acción, así que las celdas alcanzables son las que están a tantos pasos como puntos quedan, y
+     * el camino de una de ellas se entrega como una etapa por paso. Todas las acciones se validan con
+     * ReglasJuego antes de ofrecerlas.
+     */
+    class GeneradorAcciones {
+    public:
+
+        static constexpr int candidatosDesplaza = 8;
+
+        /*!
+         * \brief Constructor.
+         * \param reglas Reglas de la partida; cada hilo o jugador usa su propia instancia.
+         */
+        explicit GeneradorAcciones (ReglasJuego & reglas);
+
+        /*!
+         * \brief Devuelve las reglas de la partida.
+         */
+        ReglasJuego & reglas ();
+
+        /*!
+         * \brief Enumera las habilidades que el personaje puede usar, con cada objetivo válido.
+         * \param estado Estado de la partida.
+         * \param personaje Índice del personaje.
+         * \param acciones Acciones válidas de habilidad (se vacía antes).
+         */
+        void habilidades (
+                const EstadoReglas &         estado,
+                int                                  personaje,
+                std::vector <AccionReglas> & acciones  );
+
+        /*!
+         * \brief Calcula las celdas a las que puede llegar el personaje.
+         * \param estado Estado de la partida.
+         * \param personaje Índice del personaje.
+         * \param puntos Puntos de acción que puede gastar en el desplazamiento.
+         * \return Celdas alcanzables, sin la de partida, por orden de pasos.
+         */
+        const std::vector <CeldaReglas> & alcanzables (
+                const EstadoReglas & estado, int personaje, int puntos);
+
+        /*!
+         * \brief Construye el desplazamiento hasta una celda de la última llamada a alcanzables.
+         * \param personaje Índice del personaje.
+         * \param destino Celda alcanzable.
+         * \param accion Acción de desplazamiento.
+         */
+        void desplazamiento (int personaje, CeldaReglas destino, AccionReglas & accion) const;
+
+        /*!
+         * \brief Enumera las jugadas de los personajes a los que les toca actuar, para una búsqueda.
+         *
+         * Para cada personaje activo del lado, sus habilidades y sus desplazamientos candidatos.
+         * \param estado Estado de la partida.
+         * \param turno Situación del turno.
+         * \param acciones Acciones válidas (se vacía antes).
+         */
+        void jugadas (
+                const EstadoReglas &         estado,
+                const TurnoReglas &          turno,
+                std::vector <AccionReglas> & acciones );
+
+        /*!
+         * \brief Agrega unos pocos desplazamientos de un personaje, hasta candidatosDesplaza.
+         *
+         * Las celdas más cercanas al oponente que dejan puntos para el ataque más barato, las más
+         * cercanas sin esa condición y las más alejadas, para poder huir; por ese orden.
+         * \param estado Estado de la partida.
+         * \param personaje Índice del personaje.
+         * \param acciones Acciones a las que se agregan los desplazamientos válidos.
+         */
+        void desplazamientos (
+                const EstadoReglas &         estado,
+                int                          personaje,
+                std::vector <AccionReglas> & acciones  );
+
+        /*!
+         * \brief Distancia de una celda al oponente vivo más cercano de un lado, o 0 si no queda ninguno.
+         * \param estado Estado de la partida.
+         * \param catalogo Catálogo de la partida.
+         * \param lado Lado del tablero cuyos oponentes se miden.
+         * \param celda Celda.
+         */
+        static float distanciaOponente (
+                const EstadoReglas &   estado,
+                const CatalogoReglas & catalogo,
+                LadoReglas             lado,
+                CeldaReglas            celda    );
+
+    private:
+
+        ReglasJuego & reglas_;
+
+        std::vector <CeldaReglas> celdas_visitadas {};
+        std::vector <CeldaReglas> celdas_alcanzables {};
+        std::vector <int16_t>             celda_previa {};
+
+        std::vector <AccionReglas>                   habilidades_jugadas {};
+        std::vector <std::pair <float, CeldaReglas>> celdas_candidatas {};
+
+        static AccionReglas accionHabilidad (int personaje, int habilidad);
+
+    };
+
+
+}
@@ -0,0 +1,514 @@
+﻿// proyecto: Grupal/Reglas
+// archivo   ReglasJuego.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "reglas.h"
+
+namespace reglas {
+
+    ReglasJuego::ReglasJuego (const CatalogoReglas & catalogo) :
+            catalogo_ {catalogo} {
+    }
+
+    const CatalogoReglas & ReglasJuego::catalogo () const {
+        return catalogo_;
+    }
+
+    void ReglasJuego::colocaFichas (EstadoReglas & estado) const {
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            estado.tablero.mueveFicha (CeldaReglas {0, 0}, estado.personajes [indc].sitio);
+        }
+    }
+
+    void ReglasJuego::restauraRonda (EstadoReglas & estado) const {
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            PersonajeReglas & persj = estado.personajes [indc];
+            persj.puntos_accion = catalogo_.fichas [indc].puntos_accion_ronda;
+            persj.cambio_ataque .fill (0);
+            persj.cambio_defensa.fill (0);
+        }
+    }
+
+    bool ReglasJuego::valida (const EstadoReglas & estado, const AccionReglas & accion, int & puntos_en_juego) {
+        if (accion.personaje < 0 || accion.personaje >= estado.cuenta_personajes) {
+            return false;
+        }
+        const PersonajeReglas & persj = estado.personajes [accion.personaje];
+        if (persj.puntos_accion <= 0 || persj.vitalidad <= 0) {
+            return false;
+        }
+        if (accion.tipo == TipoAccionReglas::desplaza) {
+            return validaDesplaza (estado, accion, puntos_en_juego);
+        }
+        return validaHabilidad (estado, accion, puntos_en_juego);
+    }
+
+    bool ReglasJuego::aplica (EstadoReglas & estado, const AccionReglas & accion) {
+        int puntos_en_juego;
+        if (! valida (estado, accion, puntos_en_juego)) {
+            return false;
+        }
+        PersonajeReglas & persj = estado.personajes [accion.personaje];
+        if (accion.tipo == TipoAccionReglas::desplaza) {
+            CeldaReglas nuevo_sitio = accion.etapas [accion.cuenta_etapas - 1];
+            estado.tablero.mueveFicha (persj.sitio, nuevo_sitio);
+            persj.sitio = nuevo_sitio;
+        } else {
+            aplicaHabilidad (estado, accion);
+            // las habilidades sobre un personaje de coste 1 agotan los puntos restantes,
+            // como en ModoJuegoBase::atacaOponente
+            const HabilidadReglas & habilidad = catalogo_.habilidades [accion.habilidad];
+            if (habilidad.enfoque == EnfoqueReglas::personaje && habilidad.coste == 1) {
+                puntos_en_juego = persj.puntos_accion;
+            }
+        }
+        persj.puntos_accion = static_cast <int8_t> (persj.puntos_accion - puntos_en_juego);
+        return true;
+    }
+
+    int ReglasJuego::tramosAleatorio (
+            const EstadoReglas &       estado,
+            const AccionReglas &       accion,
+            std::array <int8_t, 101> & inicios ) const {
+        const HabilidadReglas & habilidad = catalogo_.habilidades [accion.habilidad];
+        int cuenta = 1;
+        inicios [0] = 0;
+        bool con_ataque =
+                habilidad.antagonista == AntagonistaReglas::oponente &&
+                habilidad.enfoque != EnfoqueReglas::si_mismo &&
+                habilidad.ataque != sinEstadistica && habilidad.defensa != sinEstadistica &&
+                ! (habilidad.enfoque == EnfoqueReglas::personaje && habilidad.coste == 1);
+        if (con_ataque) {
+            // un tramo empieza en cada valor aleatorio que lleva el ataque final justo por encima del
+            // valor superior de un grado, para cada oponente alcanzado
+            for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+                if (habilidad.enfoque == EnfoqueReglas::personaje) {
+                    if (indc != accion.objetivo) {
+                        continue;
+                    }
+                } else if (! enArea (accion.celda_area, habilidad.radio, estado.personajes [indc].sitio)) {
+                    continue;
+                }
+                if (estado.personajes [indc].vitalidad <= 0) {
+                    continue;
+                }
+                int valor_ataque, valor_defensa;
+                valoresAtaque (estado, accion.personaje, habilidad, indc, valor_ataque, valor_defensa);
+                for (int indc_grado = 0; indc_grado < catalogo_.cuenta_grados; ++ indc_grado) {
+                    int inicio = catalogo_.grados [indc_grado].valor_superior - (valor_ataque - valor_defensa) + 1;
+                    if (inicio > 0 && inicio < 100) {
+                        inicios [cuenta ++] = static_cast <int8_t> (inicio);
+                    }
+                }
+            }
+            std::sort (inicios.begin (), inicios.begin () + cuenta);
+            cuenta = static_cast <int> (std::unique (inicios.begin (), inicios.begin () + cuenta) - inicios.begin ());
+        }
+        inicios [cuenta] = 100;
+        return cuenta;
+    }
+
+    TurnoReglas ReglasJuego::sigueTurno (const EstadoReglas & estado, TurnoReglas turno, int actor) const {
+        LadoReglas lado = turno.lado;
+        switch (turno.modo) {
+        case ModoReglas::pares:
+            // el personaje sigue elegido aunque se agote, para que su lado no vuelva a actuar hasta
+            // que el contrario se agote también y los dos elijan de nuevo
+            turno.elegidos [static_cast <int> (lado)] = static_cast <int8_t> (actor);
+            if (puedeActuar (estado, turno, contrario (lado))) {
+                turno.lado = contrario (lado);
+            } else if (! puedeActuar (estado, turno, lado)) {
+                turno = cedeTurno (turno);
+            }
+            break;
+        case ModoReglas::equipo: {
+            int siguiente = siguienteFactor (estado, turno.inicial, actor);
+            turno = cedeTurno (turno);
+            if (siguiente >= 0) {
+                turno.lado = catalogo_.fichas [siguiente].lado;
+                turno.elegidos [static_cast <int> (turno.lado)] = static_cast <int8_t> (siguiente);
+            }
+            break;
+        }
+        case ModoReglas::libre_doble:
+            if (turno.acciones > 1 && activo (estado, actor)) {
+                turno.acciones --;
+                turno.elegidos [static_cast <int> (lado)] = static_cast <int8_t> (actor);
+            } else {
+                turno = cedeTurno (turno);
+            }
+            break;
+        }
+        return turno;
+    }
+
+    int ReglasJuego::siguienteFactor (const EstadoReglas & estado, LadoReglas inicial, int actor) const {
+        std::array <std::array <int8_t, maximoPersonajes>, 2> por_lado;
+        std::array <int, 2> cuentas {};
+        int posicion_actor = -1;
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            int lado = static_cast <int> (catalogo_.fichas [indc].lado);
+            if (indc == actor) {
+                posicion_actor = 2 * cuentas [lado] + (catalogo_.fichas [indc].lado == inicial ? 0 : 1);
+            }
+            por_lado [lado] [cuentas [lado] ++] = static_cast <int8_t> (indc);
+        }
+        int cuenta_posiciones = 2 * std::max (cuentas [0], cuentas [1]);
+        for (int posicion = posicion_actor + 1; posicion < cuenta_posiciones; ++ posicion) {
+            int lado   = static_cast <int> (posicion % 2 == 0 ? inicial : contrario (inicial));
+            int indice = posicion / 2;
+            if (indice < cuentas [lado] && activo (estado, por_lado [lado] [indice])) {
+                return por_lado [lado] [indice];
+            }
+        }
+        return -1;
+    }
+
+    bool ReglasJuego::puedeActuar (const EstadoReglas & estado, const TurnoReglas & turno, LadoReglas lado) const {
+        int elegido = turno.elegidos [static_cast <int> (lado)];
+        if (elegido >= 0) {
+            return activo (estado, elegido);
+        }
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            if (catalogo_.fichas [indc].lado == lado && activo (estado, indc)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    TurnoReglas ReglasJuego::cedeTurno (TurnoReglas turno) {
+        turno.lado     = contrario (turno.lado);
+        turno.acciones = static_cast <int8_t> (turno.modo == ModoReglas::libre_doble ? 2 : 1);
+        turno.elegidos = {-1, -1};
+        return turno;
+    }
+
+    bool ReglasJuego::activo (const EstadoReglas & estado, int personaje) {
+        return estado.personajes [personaje].vitalidad > 0 && estado.personajes [personaje].puntos_accion > 0;
+    }
+
+    LadoReglas ReglasJuego::contrario (LadoReglas lado) {
+        return lado == LadoReglas::izquierda ? LadoReglas::derecha : LadoReglas::izquierda;
+    }
+
+    float ReglasJuego::distanciaAlcance (CeldaReglas celda_origen, CeldaReglas celda_destino) {
+        constexpr float unidad = static_cast <float> (TableroReglas::ladoHexagono) * TableroReglas::seno60_exacto * 2;
+        return TableroReglas::distancia (celda_origen, celda_destino) / unidad;
+    }
+
+    int ReglasJuego::puntosDesplaza (float distancia, float puntos_accion_de_desplaza) {
+        return static_cast <int> (std::round (distancia / puntos_accion_de_desplaza));
+    }
+
+    bool ReglasJuego::enAlcance (
+            const TableroReglas &   tablero,
+            const HabilidadReglas & habilidad,
+            CeldaReglas             sitio,
+            CeldaReglas             celda_objetivo ) {
+        if (habilidad.enfoque == EnfoqueReglas::area) {
+            if (! TableroReglas::celdaEnTablero (celda_objetivo)) {
+                return false;
+            }
+            if (tablero.enMuro (celda_objetivo)) {
+                return false;
+            }
+        }
+        return distanciaAlcance (celda_objetivo, sitio) <= habilidad.alcance;
+    }
+
+    void ReglasJuego::resuelveAtaque (
+            const GradoReglas * grados,
+            int                 cuenta_grados,
+            int                 valor_ataque,
+            int                 valor_defensa,
+            int                 aleatorio_100,
+            int                 valor_dano,
+            int                 valor_reduce_dano,
+            int                 vitalidad,
+            AtaqueReglas &      ataque        ) {
+        ataque = AtaqueReglas {};
+        ataque.valor_ataque       = valor_ataque;
+        ataque.valor_defensa      = valor_defensa;
+        ataque.ventaja            = valor_ataque - valor_defensa;
+        ataque.aleatorio_100      = aleatorio_100;
+        ataque.valor_final_ataque = ataque.ventaja + aleatorio_100;
+
+        ataque.grado = -1;
+        for (int indc = 0; indc < cuenta_grados; ++ indc) {
+            if (ataque.valor_final_ataque <= grados [indc].valor_superior) {
+                ataque.grado          = indc;
+                ataque.porciento_dano = grados [indc].porciento_dano;
+                break;
+            }
+        }
+
+        ataque.valor_dano          = valor_dano;
+        ataque.valor_ajustado_dano = (int) (valor_dano * (((float) ataque.porciento_dano) / 100.0f));
+        ataque.valor_reduce_dano   = valor_reduce_dano;
+        ataque.valor_final_dano    = ataque.valor_ajustado_dano - valor_reduce_dano;
+
+        ataque.vitalidad_origen = vitalidad;
+        ataque.vitalidad_final  = vitalidad;
+        if (ataque.vitalidad_final > 0) {
+            ataque.vitalidad_final -= ataque.valor_final_dano;
+            ataque.vitalidad_final  = std::clamp (ataque.vitalidad_final, 0, maximaVitalidad);
+        }
+    }
+
+    void ReglasJuego::distribuyeAtaque (
+            const GradoReglas *   grados,
+            int                   cuenta_grados,
+            int                   valor_ataque,
+            int                   valor_defensa,
+            int                   valor_dano,
+            int                   valor_reduce_dano,
+            int                   vitalidad,
+            DistribucionAtaque &  distribucion  ) {
+        distribucion = DistribucionAtaque {};
+        distribucion.ventaja = valor_ataque - valor_defensa;
+
+        // el tramo de cada grado acaba en el valor aleatorio que lleva el ataque final a su valor
+        // superior; el último tramo, hasta 100, es el de los ataques que ningún grado admite
+        AtaqueReglas ataque {};
+        int inicio = 0;
+        for (int indc = 0; indc <= cuenta_grados && inicio < 100; ++ indc) {
+            int fin = 100;
+            if (indc < cuenta_grados) {
+                // el último grado suele acabar en INT_MAX: la cuenta se hace en 64 bits para no desbordar
+                int64_t fin_grado = int64_t {grados [indc].valor_superior} - distribucion.ventaja + 1;
+                fin = static_cast <int> (std::clamp <int64_t> (fin_grado, 0, 100));
+            }
+            if (fin <= inicio) {
+                continue;
+            }
+            float probabilidad = (fin - inicio) / 100.0f;
+            resuelveAtaque (
+                    grados, cuenta_grados, valor_ataque, valor_defensa, inicio,
+                    valor_dano, valor_reduce_dano, vitalidad, ataque);
+            if (ataque.grado >= 0) {
+                distribucion.probabilidad_grado [ataque.grado] += probabilidad;
+            } else {
+                distribucion.probabilidad_fallo += probabilidad;
+            }
+            distribucion.dano_esperado += probabilidad * (ataque.vitalidad_origen - ataque.vitalidad_final);
+            if (ataque.vitalidad_origen > 0 && ataque.vitalidad_final == 0) {
+                distribucion.probabilidad_derriba += probabilidad;
+            }
+            inicio = fin;
+        }
+    }
+
+    int ReglasJuego::resuelveCuracion (int vitalidad, int valor_curacion) {
+        if (vitalidad <= 0) {
+            return vitalidad;
+        }
+        return std::clamp (vitalidad + valor_curacion, 0, maximaVitalidad);
+    }
+
+    bool ReglasJuego::validaDesplaza (
+            const EstadoReglas & estado, const AccionReglas & accion, int & puntos_en_juego) {
+        if (accion.cuenta_etapas < 1 || accion.cuenta_etapas > maximoEtapas) {
+            return false;
+        }
+        const PersonajeReglas & persj = estado.personajes [accion.personaje];
+
+        // Como en ModoJuegoBase, las etapas ya trazadas cuentan como ocupadas para las siguientes y
+        // la distancia se acumula con el mismo DistanciaCamino, para que el redondeo coincida.
+        plano_camino.reset ();
+        plano_camino.set (TableroReglas::indiceCelda (persj.sitio));
+        CeldaReglas celda_sale = persj.sitio;
+        DistanciaCamino distancia_camino;
+        distancia_camino.agrega (celda_sale);
+        for (int indc = 0; indc < accion.cuenta_etapas; ++ indc) {
+            CeldaReglas celda_llega = accion.etapas [indc];
+            int indc_llega = TableroReglas::indiceCelda (celda_llega);
+            if (indc_llega < 0 || plano_camino.test (indc_llega)) {
+                return false;
+            }
+            if (estado.tablero.ocupada (celda_llega)) {
+                return false;
+            }
+            if (! estado.tablero.segmentoValido (celda_sale, celda_llega, plano_camino)) {
+                return false;
+            }
+            distancia_camino.agrega (celda_llega);
+            plano_camino.set (indc_llega);
+            celda_sale = celda_llega;
+        }
+        puntos_en_juego = distancia_camino.puntos (catalogo_.puntos_accion_de_desplaza);
+        return puntos_en_juego <= persj.puntos_accion;
+    }
+
+    bool ReglasJuego::validaHabilidad (
+            const EstadoReglas & estado, const AccionReglas & accion, int & puntos_en_juego) const {
+        const FichaReglas & ficha = catalogo_.fichas [accion.personaje];
+        bool propia = false;
+        for (int indc = 0; indc < ficha.cuenta_habilidades; ++ indc) {
+            if (ficha.habilidades [indc] == accion.habilidad) {
+                propia = true;
+                break;
+            }
+        }
+        if (! propia) {
+            return false;
+        }
+        const PersonajeReglas & persj     = estado.personajes [accion.personaje];
+        const HabilidadReglas & habilidad = catalogo_.habilidades [accion.habilidad];
+        puntos_en_juego = habilidad.coste;
+        if (puntos_en_juego > persj.puntos_accion) {
+            return false;
+        }
+
+        CeldaReglas celda_objetivo;
+        switch (habilidad.enfoque) {
+        case EnfoqueReglas::si_mismo:
+            return true;
+        case EnfoqueReglas::personaje:
+            if (accion.objetivo < 0 || accion.objetivo >= estado.cuenta_personajes) {
+                return false;
+            }
+            if (accion.objetivo == accion.personaje) {
+                return false;
+            }
+            if ((habilidad.antagonista == AntagonistaReglas::oponente) ==
+                (catalogo_.fichas [accion.objetivo].lado == ficha.lado)  ) {
+                return false;
+            }
+            celda_objetivo = estado.personajes [accion.objetivo].sitio;
+            break;
+        case EnfoqueReglas::area:
+            celda_objetivo = accion.celda_area;
+            break;
+        }
+
+        if (! enAlcance (estado.tablero, habilidad, persj.sitio, celda_objetivo)) {
+            return false;
+        }
+        if (habilidad.acceso == AccesoReglas::directo) {
+            if (! estado.tablero.segmentoValido (persj.sitio, celda_objetivo)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void ReglasJuego::aplicaHabilidad (EstadoReglas & estado, const AccionReglas & accion) const {
+        const HabilidadReglas & habilidad = catalogo_.habilidades [accion.habilidad];
+        switch (habilidad.enfoque) {
+        case EnfoqueReglas::si_mismo:
+            aplicaEfectos (estado, accion.personaje, habilidad);
+            break;
+        case EnfoqueReglas::personaje:
+            if (habilidad.antagonista == AntagonistaReglas::oponente) {
+                int aleatorio_100 = habilidad.coste == 1 ? 100 : accion.aleatorio_100;
+                atacaPersonaje (estado, accion.personaje, habilidad, accion.objetivo, aleatorio_100);
+            } else {
+                curaPersonaje (estado, habilidad, accion.objetivo);
+            }
+            break;
+        case EnfoqueReglas::area:
+            // El área alcanza a todos los personajes que hay en ella, de cualquier lado. Cada uno se
+            // calcula por separado, así que el orden de recorrido no altera el resultado.
+            for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+                if (! enArea (accion.celda_area, habilidad.radio, estado.personajes [indc].sitio)) {
+                    continue;
+                }
+                if (habilidad.antagonista == AntagonistaReglas::oponente) {
+                    atacaPersonaje (estado, accion.personaje, habilidad, indc, accion.aleatorio_100);
+                } else {
+                    curaPersonaje (estado, habilidad, indc);
+                }
+            }
+            break;
+        }
+    }
+
+    void ReglasJuego::aplicaEfectos (
+            EstadoReglas & estado, int indice_personaje, const HabilidadReglas & habilidad) const {
+        aserta (habilidad.cuenta_efectos_ataque > 0 || habilidad.cuenta_efectos_defensa > 0,
+                "reglas mal configuradas: habilidad auto-aplicada sin efectos definidos");
+        const FichaReglas & ficha = catalogo_.fichas [indice_personaje];
+        PersonajeReglas &   persj = estado.personajes [indice_personaje];
+        for (int indc = 0; indc < habilidad.cuenta_efectos_ataque; ++ indc) {
+            const EfectoReglas & efecto = habilidad.efectos_ataque [indc];
+            aserta ((ficha.con_ataque & (1u << efecto.estadistica)) != 0,
+                    "reglas mal configuradas: tipo de ataque no admitido por el atacante");
+            persj.cambio_ataque [efecto.estadistica] = efecto.valor;
+        }
+        for (int indc = 0; indc < habilidad.cuenta_efectos_defensa; ++ indc) {
+            const EfectoReglas & efecto = habilidad.efectos_defensa [indc];
+            aserta ((ficha.con_defensa & (1u << efecto.estadistica)) != 0,
+                    "reglas mal configuradas: tipo de defensa no admitido por el atacante");
+            persj.cambio_defensa [efecto.estadistica] = efecto.valor;
+        }
+    }
+
+    void ReglasJuego::valoresAtaque (
+            const EstadoReglas &    estado,
+            int                     indice_atacante,
+            const HabilidadReglas & habilidad,
+            int                     indice_oponente,
+            int &                   valor_ataque,
+            int &                   valor_defensa   ) const {
+        valor_ataque =
+                catalogo_.fichas [indice_atacante].ataque [habilidad.ataque] +
+                estado.personajes [indice_atacante].cambio_ataque [habilidad.ataque];
+        valor_defensa =
+                catalogo_.fichas [indice_oponente].defensa [habilidad.defensa] +
+                estado.personajes [indice_oponente].cambio_defensa [habilidad.defensa];
+    }
+
+    void ReglasJuego::atacaPersonaje (
+            EstadoReglas &          estado,
+            int                     indice_atacante,
+            const HabilidadReglas & habilidad,
+            int                     indice_oponente,
+            int                     aleatorio_100   ) const {
+        const FichaReglas &     ficha_ataca = catalogo_.fichas [indice_atacante];
+        const FichaReglas &     ficha_opone = catalogo_.fichas [indice_oponente];
+        PersonajeReglas &       persj_opone = estado.personajes [indice_oponente];
+
+        aserta (habilidad.ataque != sinEstadistica && (ficha_ataca.con_ataque & (1u << habilidad.ataque)) != 0,
+                "reglas mal configuradas: tipo de ataque no admitido por el atacante");
+        aserta (habilidad.defensa != sinEstadistica && (ficha_opone.con_defensa & (1u << habilidad.defensa)) != 0,
+                "reglas mal configuradas: tipo de defensa no admitido por el oponente");
+        aserta (habilidad.dano != sinEstadistica && (ficha_opone.con_reduce_dano & (1u << habilidad.dano)) != 0,
+                "reglas mal configuradas: reducción de daño no establecida en el oponente");
+        aserta (catalogo_.cuenta_grados > 0,
+                "reglas mal configuradas: grados de efectividad no configurados");
+
+        int valor_ataque, valor_defensa;
+        valoresAtaque (estado, indice_atacante, habilidad, indice_oponente, valor_ataque, valor_defensa);
+        AtaqueReglas ataque;
+        resuelveAtaque (
+                catalogo_.grados.data (), catalogo_.cuenta_grados,
+                valor_ataque, valor_defensa, aleatorio_100,
+                habilidad.valor_dano, ficha_opone.reduce_dano [habilidad.dano],
+                persj_opone.vitalidad, ataque);
+        persj_opone.vitalidad = static_cast <int16_t> (ataque.vitalidad_final);
+    }
+
+    void ReglasJuego::curaPersonaje (
+            EstadoReglas & estado, const HabilidadReglas & habilidad, int indice_oponente) const {
+        aserta (habilidad.valor_curacion != 0,
+                "reglas mal configuradas: curación no establecida en la habilidad");
+        PersonajeReglas & persj = estado.personajes [indice_oponente];
+        persj.vitalidad = static_cast <int16_t> (resuelveCuracion (persj.vitalidad, habilidad.valor_curacion));
+    }
+
+    bool ReglasJuego::enArea (CeldaReglas celda_central, int radio_area, CeldaReglas celda) {
+        // distancia hexagonal con pasos (±2, 0) y (±1, ±1), la de los anillos de CalculoCaminos::areaCeldas
+        int filas = std::abs (celda.fila - celda_central.fila);
+        int colns = std::abs (celda.coln - celda_central.coln);
+        return std::max (colns, (filas + colns) / 2) <= radio_area;
+    }
+
+    void ReglasJuego::aserta (bool expresion, const std::string & mensaje) {
+        if (expresion) {
+            return;
+        }
+        throw std::logic_error (mensaje);
+    }
+
+}
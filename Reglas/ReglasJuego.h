@@ -0,0 +1,293 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  ReglasJuego.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace reglas {
+
+
+    /*
+     * \struct AtaqueReglas
+     * \brief Detalle del cálculo de un ataque sobre un personaje.
+     */
+    struct AtaqueReglas {
+        int valor_ataque;
+        int valor_defensa;
+        int ventaja;
+        int aleatorio_100;
+        int valor_final_ataque;
+        int grado;                  /*!< índice del grado de efectividad, o -1 si ninguno lo admite */
+        int porciento_dano;
+        int valor_dano;
+        int valor_ajustado_dano;
+        int valor_reduce_dano;
+        int valor_final_dano;
+        int vitalidad_origen;
+        int vitalidad_final;
+    };
+
+
+    /*
+     * \struct DistribucionAtaque
+     * \brief Resultado de un ataque promediado sobre todos los valores aleatorios, sin sortearlos.
+     */
+    struct DistribucionAtaque {
+        int                                ventaja;
+        std::array <float, maximoGrados>   probabilidad_grado;   /*!< por índice de grado de efectividad */
+        float                              probabilidad_fallo;   /*!< ningún grado admite el ataque final */
+        float                              dano_esperado;        /*!< vitalidad que se espera quitar */
+        float                              probabilidad_derriba; /*!< el oponente queda sin vitalidad */
+    };
+
+
+    /*
+     * \class ReglasJuego
+     * \brief Valida y aplica las acciones de los personajes sobre un estado de la partida.
+     *
+     * Reúne las reglas que en el tapete usan ModoJuegoBase, SistemaAtaque y CalculoCaminos: coste y
+     * validez de los desplazamientos, alcance y acceso de las habilidades, y el cálculo de ataques,
+     * curaciones y efectos. El tapete llama a las funciones estáticas (puntosDesplaza, enAlcance,
+     * resuelveAtaque...) en lugar de repetirlas, así que las búsquedas validan igual que el juego.
+     * No mantiene estado de la partida, solo el catálogo y un plano de trabajo, así que una misma
+     * instancia sirve para aplicar acciones sobre muchos estados.
+     */
+    class ReglasJuego {
+    public:
+        /*!
+         * \brief Constructor.
+         * \param catalogo Configuración de la partida; debe existir mientras se usen las reglas.
+         */
+        explicit ReglasJuego (const CatalogoReglas & catalogo);
+
+        /*!
+         * \brief Devuelve el catálogo de la partida.
+         */
+        const CatalogoReglas & catalogo () const;
+
+        /*!
+         * \brief Sitúa las fichas de los personajes en el plano de ocupación del tablero.
+         * \param estado Estado con los sitios de los personajes ya establecidos.
+         */
+        void colocaFichas (EstadoReglas & estado) const;
+
+        /*!
+         * \brief Inicia una ronda: restaura los puntos de acción y anula los efectos de habilidades.
+         * \param estado Estado de la partida.
+         */
+        void restauraRonda (EstadoReglas & estado) const;
+
+        /*!
+         * \brief Comprueba si una acción es válida en un estado.
+         * \param estado Estado de la partida.
+         * \param accion Acción del personaje.
+         * \param puntos_en_juego Puntos de acción que consumiría (solo si es válida).
+         * \return true si la acción es válida, false en caso contrario.
+         */
+        bool valida (const EstadoReglas & estado, const AccionReglas & accion, int & puntos_en_juego);
+
+        /*!
+         * \brief Valida una acción y, si es válida, la aplica sobre el estado.
+         * \param estado Estado de la partida.
+         * \param accion Acción del personaje.
+         * \return true si se ha aplicado, false si no es válida (el estado no cambia).
+         */
+        bool aplica (EstadoReglas & estado, const AccionReglas & accion);
+
+        /*!
+         * \brief Divide los valores aleatorios de una habilidad en tramos con el mismo resultado.
+         *
+         * El grado de efectividad de un ataque solo cambia cuando el valor aleatorio cruza el valor
+         * superior de un grado, así que dentro de cada tramo todos los valores dejan el mismo estado.
+         * Las habilidades sin ataque, o con ataque de coste 1, tienen un único tramo.
+         * \param estado Estado de la partida.
+         * \param accion Acción de habilidad válida.
+         * \param inicios Primer valor aleatorio de cada tramo; tras el último tramo se anota 100.
+         * \return Número de tramos.
+         */
+        int tramosAleatorio (
+                const EstadoReglas &       estado,
+                const AccionReglas &       accion,
+                std::array <int8_t, 101> & inicios ) const;
+
+        /*!
+         * \brief Calcula a quién le toca actuar tras la acción de un personaje, según el modo.
+         *
+         * En pares, cada lado actúa con su personaje elegido y se alternan una acción cada uno; si al
+         * contrario no le quedan puntos, repite el mismo lado, y cuando ninguno puede actuar los dos
+         * eligen de nuevo. En equipo, actúa el siguiente personaje de la vuelta (siguienteFactor), y al
+         * acabarse la vuelta el turno queda sin elegir, como al empezar una. En libre doble, el
+         * personaje hace hasta dos acciones y luego le toca al contrario.
+         * \param estado Estado tras la acción.
+         * \param turno Situación del turno en que se ha hecho la acción.
+         * \param actor Índice del personaje que ha actuado.
+         * \return Situación del turno siguiente.
+         */
+        TurnoReglas sigueTurno (const EstadoReglas & estado, TurnoReglas turno, int actor) const;
+
+        /*!
+         * \brief Busca el personaje que actúa después de otro en la vuelta del modo equipo.
+         *
+         * La vuelta alterna los lados, empezando por el inicial, y en cada lado sigue el orden del
+         * catálogo, como ModoJuegoBase::estableceFactoresEquipos; se saltan los que no pueden actuar.
+         * \param estado Estado de la partida.
+         * \param inicial Lado que abre la vuelta.
+         * \param actor Personaje que acaba de actuar, o -1 para buscar desde el principio de la vuelta.
+         * \return Índice del personaje, o -1 si la vuelta se ha acabado.
+         */
+        int siguienteFactor (const EstadoReglas & estado, LadoReglas inicial, int actor) const;
+
+        /*!
+         * \brief Indica si un lado tiene algún personaje que pueda actuar en el turno.
+         * \param estado Estado de la partida.
+         * \param turno Situación del turno.
+         * \param lado Lado del tablero.
+         */
+        bool puedeActuar (const EstadoReglas & estado, const TurnoReglas & turno, LadoReglas lado) const;
+
+        /*!
+         * \brief Empieza un turno completo del lado contrario, con cualquiera de sus personajes.
+         * \param turno Situación del turno actual.
+         */
+        static TurnoReglas cedeTurno (TurnoReglas turno);
+
+        /*!
+         * \brief Indica si un personaje está vivo y le quedan puntos de acción.
+         * \param estado Estado de la partida.
+         * \param personaje Índice del personaje.
+         */
+        static bool activo (const EstadoReglas & estado, int personaje);
+
+        /*!
+         * \brief Devuelve el lado contrario.
+         * \param lado Lado del tablero.
+         */
+        static LadoReglas contrario (LadoReglas lado);
+
+        /*!
+         * \brief Distancia entre dos celdas en unidades de alcance de las habilidades.
+         * \param celda_origen Celda de origen.
+         * \param celda_destino Celda de destino.
+         */
+        static float distanciaAlcance (CeldaReglas celda_origen, CeldaReglas celda_destino);
+
+        /*!
+         * \brief Calcula los puntos de acción que cuesta un camino.
+         * \param distancia Longitud del camino en píxeles, sumada etapa a etapa.
+         * \param puntos_accion_de_desplaza Píxeles que se recorren por punto de acción.
+         */
+        static int puntosDesplaza (float distancia, float puntos_accion_de_desplaza);
+
+        /*!
+         * \brief Comprueba si una habilidad llega a una celda objetivo desde el sitio del personaje.
+         *
+         * La celda central de un área debe estar en el tablero y fuera de los muros, y en todos los
+         * casos la distancia no debe superar el alcance. El acceso directo se comprueba aparte, con
+         * TableroReglas::segmentoValido desde el sitio hasta la celda objetivo.
+         * \param tablero Muros y fichas.
+         * \param habilidad Habilidad con enfoque en un personaje o en un área.
+         * \param sitio Celda del personaje que usa la habilidad.
+         * \param celda_objetivo Celda del oponente o celda central del área.
+         */
+        static bool enAlcance (
+                const TableroReglas &   tablero,
+                const HabilidadReglas & habilidad,
+                CeldaReglas             sitio,
+                CeldaReglas             celda_objetivo );
+
+        /*!
+         * \brief Calcula un ataque a partir de los valores de las estadísticas.
+         * \param grados Grados de efectividad, por orden de valor superior.
+         * \param cuenta_grados Número de grados de efectividad.
+         * \param valor_ataque Valor de ataque del atacante.
+         * \param valor_defensa Valor de defensa del oponente.
+         * \param aleatorio_100 Valor aleatorio entre 0 y 100.
+         * \param valor_dano Daño de la habilidad.
+         * \param valor_reduce_dano Reducción de daño del oponente.
+         * \param vitalidad Vitalidad del oponente antes del ataque.
+         * \param ataque Detalle del cálculo.
+         */
+        static void resuelveAtaque (
+                const GradoReglas * grados,
+                int                 cuenta_grados,
+                int                 valor_ataque,
+                int                 valor_defensa,
+                int                 aleatorio_100,
+                int                 valor_dano,
+                int                 valor_reduce_dano,
+                int                 vitalidad,
+                AtaqueReglas &      ataque        );
+
+        /*!
+         * \brief Calcula la distribución de un ataque sin sortear el valor aleatorio.
+         *
+         * El valor aleatorio es uniforme entre 0 y 99, y cada grado de efectividad recoge un tramo
+         * de valores con el mismo resultado; basta con resolver el ataque una vez por tramo, así que
+         * el coste depende del número de grados y no del de valores aleatorios.
+         * \param grados Grados de efectividad, por orden de valor superior.
+         * \param cuenta_grados Número de grados de efectividad.
+         * \param valor_ataque Valor de ataque del atacante.
+         * \param valor_defensa Valor de defensa del oponente.
+         * \param valor_dano Daño de la habilidad.
+         * \param valor_reduce_dano Reducción de daño del oponente.
+         * \param vitalidad Vitalidad del oponente antes del ataque.
+         * \param distribucion Probabilidades y daño esperado.
+         */
+        static void distribuyeAtaque (
+                const GradoReglas *   grados,
+                int                   cuenta_grados,
+                int                   valor_ataque,
+                int                   valor_defensa,
+                int                   valor_dano,
+                int                   valor_reduce_dano,
+                int                   vitalidad,
+                DistribucionAtaque &  distribucion  );
+
+        /*!
+         * \brief Calcula la vitalidad tras una curación.
+         * \param vitalidad Vitalidad antes de la curación.
+         * \param valor_curacion Curación de la habilidad.
+         * \return Vitalidad final.
+         */
+        static int resuelveCuracion (int vitalidad, int valor_curacion);
+
+    private:
+
+        const CatalogoReglas & catalogo_;
+
+        TableroReglas::PlanoCeldas plano_camino {};
+
+        bool validaDesplaza  (const EstadoReglas & estado, const AccionReglas & accion, int & puntos_en_juego);
+        bool validaHabilidad (const EstadoReglas & estado, const AccionReglas & accion, int & puntos_en_juego) const;
+
+        void aplicaHabilidad (EstadoReglas & estado, const AccionReglas & accion) const;
+
+        void aplicaEfectos (EstadoReglas & estado, int indice_personaje, const HabilidadReglas & habilidad) const;
+        void valoresAtaque (
+                const EstadoReglas &    estado,
+                int                     indice_atacante,
+                const HabilidadReglas & habilidad,
+                int                     indice_oponente,
+                int &                   valor_ataque,
+                int &                   valor_defensa   ) const;
+        void atacaPersonaje (
+                EstadoReglas &          estado,
+                int                     indice_atacante,
+                const HabilidadReglas & habilidad,
+                int                     indice_oponente,
+                int                     aleatorio_100   ) const;
+        void curaPersonaje (
+                EstadoReglas &          estado,
+                const HabilidadReglas & habilidad,
+                int                     indice_oponente ) const;
+
+        static bool enArea (CeldaReglas celda_central, int radio_area, CeldaReglas celda);
+
+        static void aserta (bool expresion, const std::string & mensaje);
+
+    };
+
+
+}
@@ -0,0 +1,477 @@
+﻿// proyecto: Grupal/Reglas
+// archivo   TableroReglas.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "reglas.h"
+
+namespace reglas {
+
+    namespace {
+        constexpr unsigned char pasoPrimera  = 0;
+        constexpr unsigned char pasoSegunda  = 1;
+        constexpr unsigned char pasoAjustado = 2;
+
+        constexpr int maximoFilasTrayecto = TableroReglas::filas    - 1;
+        constexpr int maximoColnsTrayecto = TableroReglas::columnas - 1;
+        constexpr int anchoTablaTrayectos = 2 * maximoColnsTrayecto + 1;
+        constexpr int cuentaTrayectos     = (2 * maximoFilasTrayecto + 1) * anchoTablaTrayectos;
+        constexpr int limitePasosTrayecto = TableroReglas::filas + TableroReglas::columnas;
+
+        // distancia a la recta, en píxeles, por debajo de la cual un paso se considera ajustado
+        constexpr double margenAjusteTrayecto = 0.05;
+    }
+
+    bool TableroReglas::celdaEnTablero (CeldaReglas celda) {
+        if (celda.fila % 2 == 0) {
+            if (celda.fila < 2 || celda.fila > filas - 1) {
+                return false;
+            }
+        } else {
+            if (celda.fila < 1 || celda.fila > filas) {
+                return false;
+            }
+        }
+        return 0 < celda.coln && celda.coln <= columnas;
+    }
+
+    int TableroReglas::indiceCelda (CeldaReglas celda) {
+        if (! celdaEnTablero (celda)) {
+            return -1;
+        }
+        return (celda.fila - 1) * columnas + (celda.coln - 1);
+    }
+
+    CeldaReglas TableroReglas::localizaCelda (float x_punto, float y_punto) {
+
+        constexpr float anchura = (1.5f * columnas + 0.5f) * ladoHexagono;
+        constexpr float altura  = (filas + 1) * seno60 * ladoHexagono;
+        if (x_punto < 0.0f || y_punto < 0.0f || x_punto >= anchura || y_punto >= altura) {
+            return CeldaReglas {0, 0};
+        }
+
+        // Con x medida en columnas e y en filas (la fila avanza seno60 lados), la rejilla dibujada
+        // es una transformación afín de una rejilla hexagonal regular: q = 2x/3 es la coordenada
+        // axial de la columna y r = (y - q)/2 la de la fila. Los puntos del margen se acercan antes a
+        // los centros de las celdas del borde, para que den una celda del borde.
+        float x = std::clamp (x_punto / ladoHexagono + 0.5f, 1.51f, 1.5f * columnas - 0.01f);
+        float y = std::clamp (y_punto / (ladoHexagono * seno60), 1.01f, filas - 0.01f);
+        float q = x * (2.0f / 3.0f);
+        float r = (y - q) * 0.5f;
+        float s = - q - r;
+
+        // Redondeo en coordenadas cúbicas: se redondean las tres y se recalcula la que más se ha
+        // movido, para que sigan sumando cero.
+        float q_redondo = std::round (q);
+        float r_redondo = std::round (r);
+        float s_redondo = std::round (s);
+        float q_diferencia = std::fabs (q_redondo - q);
+        float r_diferencia = std::fabs (r_redondo - r);
+        float s_diferencia = std::fabs (s_redondo - s);
+        if (q_diferencia > r_diferencia && q_diferencia > s_diferencia) {
+            q_redondo = - r_redondo - s_redondo;
+        } else if (r_diferencia > s_diferencia) {
+            r_redondo = - q_redondo - s_redondo;
+        }
+
+        int coln = static_cast <int> (q_redondo);
+        int fila = 2 * static_cast <int> (r_redondo) + coln;
+        CeldaReglas localizada {static_cast <int16_t> (fila), static_cast <int16_t> (coln)};
+        if (! celdaEnTablero (localizada)) {
+            return CeldaReglas {0, 0};
+        }
+        return localizada;
+    }
+
+    float TableroReglas::distancia (CeldaReglas celda_origen, CeldaReglas celda_destino) {
+        float x_origen, y_origen, x_destino, y_destino;
+        centroHexagono (celda_origen,  x_origen,  y_origen);
+        centroHexagono (celda_destino, x_destino, y_destino);
+        float x = x_destino - x_origen;
+        float y = y_destino - y_origen;
+        return std::sqrt (x * x + y * y);
+    }
+
+    void TableroReglas::vacia () {
+        plano_muros .reset ();
+        plano_fichas.reset ();
+    }
+
+    void TableroReglas::ponMuro (CeldaReglas celda) {
+        int indc = indiceCelda (celda);
+        if (indc < 0) {
+            return;
+        }
+        plano_muros.set (indc);
+    }
+
+    void TableroReglas::mueveFicha (CeldaReglas origen, CeldaReglas destino) {
+        int indc_origen  = indiceCelda (origen);
+        int indc_destino = indiceCelda (destino);
+        if (indc_origen >= 0) {
+            plano_fichas.reset (indc_origen);
+        }
+        if (indc_destino >= 0) {
+            plano_fichas.set (indc_destino);
+        }
+    }
+
+    bool TableroReglas::enMuro (CeldaReglas celda) const {
+        int indc = indiceCelda (celda);
+        if (indc < 0) {
+            return false;
+        }
+        return plano_muros.test (indc);
+    }
+
+    bool TableroReglas::ocupada (CeldaReglas celda) const {
+        int indc = indiceCelda (celda);
+        if (indc < 0) {
+            return false;
+        }
+        return plano_muros.test (indc) || plano_fichas.test (indc);
+    }
+
+    bool TableroReglas::segmentoValido (CeldaReglas celda_origen, CeldaReglas celda_destino) const {
+        static const PlanoCeldas sin_camino {};
+        return recorre (celda_origen, celda_destino, sin_camino, nullptr);
+    }
+
+    bool TableroReglas::segmentoValido (
+            CeldaReglas         celda_origen,
+            CeldaReglas         celda_destino,
+            const PlanoCeldas & plano_camino  ) const {
+        return recorre (celda_origen, celda_destino, plano_camino, nullptr);
+    }
+
+    bool TableroReglas::recorridoSegmento (
+            CeldaReglas                 celda_origen,
+            CeldaReglas                 celda_destino,
+            std::vector <CeldaReglas> & recorrido     ) const {
+        static const PlanoCeldas sin_camino {};
+        recorrido.clear ();
+        return recorre (celda_origen, celda_destino, sin_camino, & recorrido);
+    }
+
+    void TableroReglas::celdasVisibles (
+            CeldaReglas         celda_origen,
+            const PlanoCeldas & plano_camino,
+            PlanoCeldas &       celdas_visibles ) const {
+        aserta (celdaEnTablero (celda_origen), "origen fuera del tablero");
+        celdas_visibles.reset ();
+        PlanoCeldas celdas_resueltas {};
+
+        // En las direcciones exactas la primera celda que no está libre es visible y tapa las
+        // siguientes, así que basta avanzar hasta ella y dar el resto de la dirección por resuelto.
+        for (int direccion_exacta = 1; direccion_exacta <= 6; ++ direccion_exacta) {
+            CeldaReglas celda = celdaProximaExacta (celda_origen, direccion_exacta);
+            bool tapada = false;
+            while (celdaEnTablero (celda)) {
+                int indc = indiceCelda (celda);
+                celdas_resueltas.set (indc);
+                if (! tapada) {
+                    celdas_visibles.set (indc);
+                    tapada = ! libre (celda, plano_camino);
+                }
+                celda = celdaProximaExacta (celda, direccion_exacta);
+            }
+        }
+
+        // ningún paso cambia la paridad de fila + columna
+        int paridad = (celda_origen.fila + celda_origen.coln) % 2;
+        for (int fila = 1; fila <= filas; ++ fila) {
+            for (int coln = 1; coln <= columnas; ++ coln) {
+                CeldaReglas celda {static_cast <int16_t> (fila), static_cast <int16_t> (coln)};
+                if ((fila + coln) % 2 != paridad || celda == celda_origen) {
+                    continue;
+                }
+                int indc = indiceCelda (celda);
+                if (indc < 0 || celdas_resueltas.test (indc)) {
+                    continue;
+                }
+                if (recorre (celda_origen, celda, plano_camino, nullptr)) {
+                    celdas_visibles.set (indc);
+                }
+            }
+        }
+    }
+
+    bool TableroReglas::recorre (
+            CeldaReglas                 celda_origen,
+            CeldaReglas                 celda_destino,
+            const PlanoCeldas &         plano_camino,
+            std::vector <CeldaReglas> * recorrido     ) const {
+        aserta (celda_origen != celda_destino, "segmento de camino nulo");
+
+        int direccion_exacta;
+        int direccion_cuadrante;
+        calculoDireccion (celda_origen, celda_destino, direccion_exacta, direccion_cuadrante);
+
+        CeldaReglas celda_sale = celda_origen;
+        if (direccion_exacta != 0) {
+            while (true) {
+                CeldaReglas celda_llega = celdaProximaExacta (celda_sale, direccion_exacta);
+                if (celda_llega == celda_destino) {
+                    return true;
+                }
+                if (! libre (celda_llega, plano_camino)) {
+                    return false;
+                }
+                if (recorrido != nullptr) {
+                    recorrido->push_back (celda_llega);
+                }
+                celda_sale = celda_llega;
+            }
+        }
+
+        // Recorrido tabulado: solo enteros y consultas de ocupación. Se abandona en cuanto un paso
+        // está ajustado o tiene alguna candidata fuera del tablero, porque entonces la elección
+        // depende de la posición absoluta y se continúa con el cálculo en coma flotante.
+        const TablaTrayectos & tabla = tablaTrayectos ();
+        int indc_trayecto = indiceTrayecto (
+                celda_destino.fila - celda_origen.fila, celda_destino.coln - celda_origen.coln);
+        int inicio_pasos = 0;
+        int cuenta_pasos = 0;
+        if (indc_trayecto >= 0) {
+            inicio_pasos = tabla.inicios [indc_trayecto];
+            cuenta_pasos = tabla.cuentas [indc_trayecto];
+        }
+        for (int indc_paso = 0; indc_paso < cuenta_pasos; ++ indc_paso) {
+            unsigned char paso = tabla.pasos [inicio_pasos + indc_paso];
+            if ((paso & pasoAjustado) != 0) {
+                break;
+            }
+            std::array <CeldaReglas, 2> celda_proxm;
+            celdasCandidatasCuadrante (celda_sale, direccion_cuadrante, celda_proxm);
+            if (! celdaEnTablero (celda_proxm [0]) || ! celdaEnTablero (celda_proxm [1])) {
+                break;
+            }
+            CeldaReglas celda_llega = celda_proxm [paso & pasoSegunda];
+            if (celda_llega == celda_destino) {
+                return true;
+            }
+            if (! libre (celda_llega, plano_camino)) {
+                return false;
+            }
+            if (recorrido != nullptr) {
+                recorrido->push_back (celda_llega);
+            }
+            celda_sale = celda_llega;
+        }
+
+        // la recta se calcula siempre desde el origen, con el mismo orden de operaciones en coma
+        // flotante que tenía el cálculo del tapete
+        float x_origen, y_origen, x_destino, y_destino;
+        centroHexagono (celda_origen,  x_origen,  y_origen);
+        centroHexagono (celda_destino, x_destino, y_destino);
+        EcuacionRecta recta;
+        recta.a =   y_destino - y_origen;
+        recta.b = -(x_destino - x_origen);
+        recta.c = -recta.a * x_origen - recta.b * y_origen;
+        recta.d = std::sqrt (recta.a * recta.a + recta.b * recta.b);
+
+        while (true) {
+            CeldaReglas celda_llega = celdaProximaCuadrante (celda_sale, direccion_cuadrante, recta);
+            if (celda_llega == celda_destino) {
+                return true;
+            }
+            if (! libre (celda_llega, plano_camino)) {
+                return false;
+            }
+            if (recorrido != nullptr) {
+                recorrido->push_back (celda_llega);
+            }
+            celda_sale = celda_llega;
+        }
+    }
+
+    const TableroReglas::TablaTrayectos & TableroReglas::tablaTrayectos () {
+        static const TablaTrayectos tabla = generaTablaTrayectos ();
+        return tabla;
+    }
+
+    TableroReglas::TablaTrayectos TableroReglas::generaTablaTrayectos () {
+        // Los centros de los hexágonos dependen linealmente de la celda, así que la secuencia de
+        // celdas de un recorrido por cuadrante solo depende del desplazamiento entre el origen y el
+        // destino. Se calcula en doble precisión desde el origen {0, 0}; los pasos cuyas dos
+        // candidatas quedan casi a la misma distancia de la recta se marcan como ajustados, porque
+        // ahí decide el redondeo del cálculo en coma flotante sobre las coordenadas absolutas.
+        constexpr double ancho_coln = 1.5 * ladoHexagono;
+        const double     alto_fila  = static_cast <double> (seno60) * ladoHexagono;
+
+        TablaTrayectos tabla {};
+        tabla.inicios.resize (cuentaTrayectos);
+        tabla.cuentas.resize (cuentaTrayectos);
+        for (int filas = -maximoFilasTrayecto; filas <= maximoFilasTrayecto; ++ filas) {
+            for (int colns = -maximoColnsTrayecto; colns <= maximoColnsTrayecto; ++ colns) {
+                if ((filas % 2 == 0) != (colns % 2 == 0)) {
+                    continue;
+                }
+                if (filas == 0 && colns == 0) {
+                    continue;
+                }
+                CeldaReglas celda_destino {static_cast <int16_t> (filas), static_cast <int16_t> (colns)};
+                int direccion_exacta;
+                int direccion_cuadrante;
+                calculoDireccion (CeldaReglas {0, 0}, celda_destino, direccion_exacta, direccion_cuadrante);
+                if (direccion_exacta != 0) {
+                    continue;
+                }
+
+                double recta_a = filas * alto_fila;
+                double recta_b = -colns * ancho_coln;
+                double margen  = margenAjusteTrayecto * std::sqrt (recta_a * recta_a + recta_b * recta_b);
+                int inicio_pasos = static_cast <int> (tabla.pasos.size ());
+                CeldaReglas celda_sale {0, 0};
+                bool llega = false;
+                for (int indc = 0; indc < limitePasosTrayecto && ! llega; ++ indc) {
+                    std::array <CeldaReglas, 2> celda_proxm;
+                    celdasCandidatasCuadrante (celda_sale, direccion_cuadrante, celda_proxm);
+                    std::array <double, 2> distn_proxm {};
+                    for (int indc_proxm = 0; indc_proxm < static_cast <int> (celda_proxm.size ()); ++ indc_proxm) {
+                        distn_proxm [indc_proxm] = std::fabs (
+                                recta_a * celda_proxm [indc_proxm].coln * ancho_coln +
+                                recta_b * celda_proxm [indc_proxm].fila * alto_fila   );
+                    }
+                    unsigned char paso = distn_proxm [0] < distn_proxm [1] ? pasoPrimera : pasoSegunda;
+                    if (std::fabs (distn_proxm [0] - distn_proxm [1]) < margen) {
+                        paso |= pasoAjustado;
+                    }
+                    tabla.pasos.push_back (paso);
+                    celda_sale = celda_proxm [paso & pasoSegunda];
+                    llega = celda_sale == celda_destino;
+                }
+
+                int indc_trayecto = indiceTrayecto (filas, colns);
+                if (llega) {
+                    tabla.inicios [indc_trayecto] = inicio_pasos;
+                    tabla.cuentas [indc_trayecto] = static_cast <int> (tabla.pasos.size ()) - inicio_pasos;
+                } else {
+                    tabla.pasos.resize (inicio_pasos);
+                }
+            }
+        }
+        return tabla;
+    }
+
+    int TableroReglas::indiceTrayecto (int filas, int colns) {
+        if (std::abs (filas) > maximoFilasTrayecto || std::abs (colns) > maximoColnsTrayecto) {
+            return -1;
+        }
+        return (filas + maximoFilasTrayecto) * anchoTablaTrayectos + (colns + maximoColnsTrayecto);
+    }
+
+    void TableroReglas::centroHexagono (CeldaReglas celda, float & x, float & y) {
+        x = 1.5f * celda.coln - 0.5f;
+        y = seno60 * celda.fila;
+        x *= ladoHexagono;
+        y *= ladoHexagono;
+    }
+
+    void TableroReglas::calculoDireccion (
+            CeldaReglas celda_origen, CeldaReglas celda_destino,
+            int & direccion_exacta, int & direccion_cuadrante) {
+        direccion_exacta    = 0;
+        direccion_cuadrante = 0;
+        int filas = celda_destino.fila - celda_origen.fila;
+        int colns = celda_destino.coln - celda_origen.coln;
+        if (filas == 0) {
+            direccion_cuadrante = colns > 0 ? 2 : 5;
+        } else if (colns == 0) {
+            direccion_exacta = filas > 0 ? 4 : 1;
+        } else if (filas > 0 && colns > 0) {
+            if (filas == colns) {
+                direccion_exacta = 3;
+            } else {
+                direccion_cuadrante = filas < colns ? 2 : 3;
+            }
+        } else if (filas > 0 && colns < 0) {
+            if (filas == -colns) {
+                direccion_exacta = 5;
+            } else {
+                direccion_cuadrante = filas < -colns ? 5 : 4;
+            }
+        } else if (filas < 0 && colns > 0) {
+            if (-filas == colns) {
+                direccion_exacta = 2;
+            } else {
+                direccion_cuadrante = -filas < colns ? 2 : 1;
+            }
+        } else {
+            if (-filas == -colns) {
+                direccion_exacta = 6;
+            } else {
+                direccion_cuadrante = -filas < -colns ? 5 : 6;
+            }
+        }
+    }
+
+    CeldaReglas TableroReglas::celdaProximaExacta (CeldaReglas celda_sale, int direccion_exacta) {
+        static constexpr std::array <CeldaReglas, 7> pasos {
+                CeldaReglas { 0,  0},
+                CeldaReglas {-2,  0}, CeldaReglas {-1,  1}, CeldaReglas { 1,  1},
+                CeldaReglas { 2,  0}, CeldaReglas { 1, -1}, CeldaReglas {-1, -1}  };
+        CeldaReglas paso = pasos [direccion_exacta];
+        return CeldaReglas {
+                static_cast <int16_t> (celda_sale.fila + paso.fila),
+                static_cast <int16_t> (celda_sale.coln + paso.coln) };
+    }
+
+    void TableroReglas::celdasCandidatasCuadrante (
+            CeldaReglas celda_sale, int direccion_cuadrante, std::array <CeldaReglas, 2> & celda_proxm) {
+        static constexpr std::array <std::array <CeldaReglas, 2>, 7> pasos {{
+                {{ { 0,  0}, { 0,  0} }},
+                {{ {-2,  0}, {-1,  1} }},
+                {{ {-1,  1}, { 1,  1} }},
+                {{ { 1,  1}, { 2,  0} }},
+                {{ { 2,  0}, { 1, -1} }},
+                {{ { 1, -1}, {-1, -1} }},
+                {{ {-1, -1}, {-2,  0} }}  }};
+        for (int indc = 0; indc < static_cast <int> (celda_proxm.size ()); ++ indc) {
+            CeldaReglas paso = pasos [direccion_cuadrante] [indc];
+            celda_proxm [indc] = CeldaReglas {
+                    static_cast <int16_t> (celda_sale.fila + paso.fila),
+                    static_cast <int16_t> (celda_sale.coln + paso.coln) };
+        }
+    }
+
+    CeldaReglas TableroReglas::celdaProximaCuadrante (
+            CeldaReglas celda_sale, int direccion_cuadrante, const EcuacionRecta & recta) {
+        std::array <CeldaReglas, 2> celda_proxm;
+        celdasCandidatasCuadrante (celda_sale, direccion_cuadrante, celda_proxm);
+        for (int indc = 0; indc < static_cast <int> (celda_proxm.size ()); ++ indc) {
+            if (! celdaEnTablero (celda_proxm [indc])) {
+                celda_proxm [indc] = CeldaReglas {0, 0};
+            }
+        }
+        if (celda_proxm [0] == CeldaReglas {0, 0}) {
+            return celda_proxm [1];
+        }
+        if (celda_proxm [1] == CeldaReglas {0, 0}) {
+            return celda_proxm [0];
+        }
+
+        std::array <float, 2> distn_proxm;
+        for (int indc = 0; indc < static_cast <int> (celda_proxm.size ()); ++ indc) {
+            float x, y;
+            centroHexagono (celda_proxm [indc], x, y);
+            distn_proxm [indc] = std::fabs (recta.a * x + recta.b * y + recta.c) / recta.d;
+        }
+        return distn_proxm [0] < distn_proxm [1] ? celda_proxm [0] : celda_proxm [1];
+    }
+
+    bool TableroReglas::libre (CeldaReglas celda, const PlanoCeldas & plano_camino) const {
+        int indc = indiceCelda (celda);
+        if (indc < 0) {
+            return false;
+        }
+        return ! plano_muros.test (indc) && ! plano_fichas.test (indc) && ! plano_camino.test (indc);
+    }
+
+    void TableroReglas::aserta (bool expresion, const std::string & mensaje) {
+        if (expresion) {
+            return;
+        }
+        throw std::logic_error (mensaje);
+    }
+
+}
@@ -0,0 +1,209 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  TableroReglas.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace reglas {
+
+
+    /*
+     * \struct CeldaReglas
+     * \brief Coordenada de una celda de la rejilla hexagonal, con la misma numeración que Coord.
+     */
+    struct CeldaReglas {
+        int16_t fila;
+        int16_t coln;
+
+        bool operator == (const CeldaReglas & otra) const = default;
+    };
+
+
+    /*
+     * \class TableroReglas
+     * \brief Geometría de la rejilla y ocupación de sus celdas, sin representación gráfica.
+     *
+     * Es la única implementación de la geometría que interviene en las reglas: los límites del
+     * tablero, los centros de los hexágonos y la validez de un segmento recto entre dos celdas. El
+     * tapete la usa a través de OcupacionTablero y CalculoCaminos, así que el juego, las búsquedas y
+     * el simulador aceptan exactamente los mismos caminos y accesos directos.
+     */
+    class TableroReglas {
+    public:
+
+        static constexpr int   filas           = 51;
+        static constexpr int   columnas        = 49;
+        static constexpr int   celdas          = filas * columnas;
+        static constexpr int   ladoHexagono    = 20;
+        static constexpr float seno60          = 0.85f;
+        static constexpr float seno60_exacto   = 0.866f;
+        static constexpr float distanciaCeldas = ladoHexagono * seno60 * 2;
+
+        /*!
+         * \brief Plano de bits con una posición por celda de la rejilla.
+         */
+        using PlanoCeldas = std::bitset <celdas>;
+
+        /*!
+         * \brief Comprueba si una celda está dentro de los límites del tablero.
+         * \param celda Coordenada de la celda.
+         */
+        static bool celdaEnTablero (CeldaReglas celda);
+
+        /*!
+         * \brief Calcula el índice lineal de una celda en los planos de ocupación.
+         * \param celda Coordenada de la celda.
+         * \return Índice de la celda, o -1 si está fuera del tablero.
+         */
+        static int indiceCelda (CeldaReglas celda);
+
+        /*!
+         * \brief Localiza la celda que contiene un punto de la rejilla, en tiempo constante.
+         *        Los puntos del margen dan una celda del borde.
+         * \param x_punto Abscisa del punto, en píxeles desde el origen de la rejilla.
+         * \param y_punto Ordenada del punto, en píxeles desde el origen de la rejilla.
+         * \return Celda localizada, o {0, 0} si el punto queda fuera de la rejilla.
+         */
+        static CeldaReglas localizaCelda (float x_punto, float y_punto);
+
+        /*!
+         * \brief Calcula la distancia en píxeles entre los centros de dos celdas.
+         * \param celda_origen Celda de origen.
+         * \param celda_destino Celda de destino.
+         */
+        static float distancia (CeldaReglas celda_origen, CeldaReglas celda_destino);
+
+        /*!
+         * \brief Vacía los planos de muros y fichas.
+         */
+        void vacia ();
+
+        /*!
+         * \brief Marca una celda como muro.
+         * \param celda Coordenada de la celda.
+         */
+        void ponMuro (CeldaReglas celda);
+
+        /*!
+         * \brief Traslada una ficha de una celda a otra.
+         * \param origen Celda que deja la ficha (puede estar fuera del tablero).
+         * \param destino Celda que ocupa la ficha (puede estar fuera del tablero).
+         */
+        void mueveFicha (CeldaReglas origen, CeldaReglas destino);
+
+        /*!
+         * \brief Comprueba si una celda es un muro.
+         * \param celda Coordenada de la celda.
+         */
+        bool enMuro (CeldaReglas celda) const;
+
+        /*!
+         * \brief Comprueba si una celda está ocupada por un muro o por una ficha.
+         * \param celda Coordenada de la celda.
+         */
+        bool ocupada (CeldaReglas celda) const;
+
+        /*!
+         * \brief Valida un segmento recto entre dos celdas, como CalculoCaminos::segmentoValido.
+         * \param celda_origen Celda de origen.
+         * \param celda_destino Celda de destino, distinta del origen.
+         * \param plano_camino Celdas ocupadas además de muros y fichas (las etapas de un camino).
+         * \return true si todas las celdas intermedias están en el tablero y libres.
+         */
+        bool segmentoValido (
+                CeldaReglas         celda_origen,
+                CeldaReglas         celda_destino,
+                const PlanoCeldas & plano_camino  ) const;
+
+        /*!
+         * \brief Valida un segmento recto entre dos celdas sin etapas de camino.
+         * \param celda_origen Celda de origen.
+         * \param celda_destino Celda de destino, distinta del origen.
+         */
+        bool segmentoValido (CeldaReglas celda_origen, CeldaReglas celda_destino) const;
+
+        /*!
+         * \brief Recoge las celdas intermedias de un segmento recto, hasta la primera que no está libre.
+         * \param celda_origen Celda de origen.
+         * \param celda_destino Celda de destino, distinta del origen.
+         * \param recorrido Celdas intermedias libres, en orden; se vacía antes.
+         * \return true si el segmento es válido (el recorrido está completo).
+         */
+        bool recorridoSegmento (
+                CeldaReglas                 celda_origen,
+                CeldaReglas                 celda_destino,
+                std::vector <CeldaReglas> & recorrido     ) const;
+
+        /*!
+         * \brief Calcula las celdas visibles desde una celda: aquellas hasta las que segmentoValido
+         *        acepta el segmento con las mismas etapas de camino.
+         *
+         * Las seis direcciones exactas se resuelven con un avance por dirección, porque sus
+         * recorridos comparten prefijo; el resto de las celdas con la paridad del origen necesita un
+         * recorrido por celda, y las de la otra paridad no se alcanzan nunca.
+         * \param celda_origen Celda de origen, en el tablero.
+         * \param plano_camino Celdas ocupadas además de muros y fichas (las etapas de un camino).
+         * \param celdas_visibles Plano de las celdas visibles; se vacía antes.
+         */
+        void celdasVisibles (
+                CeldaReglas         celda_origen,
+                const PlanoCeldas & plano_camino,
+                PlanoCeldas &       celdas_visibles ) const;
+
+    private:
+
+        PlanoCeldas plano_muros  {};
+        PlanoCeldas plano_fichas {};
+
+        struct EcuacionRecta {
+            float a;
+            float b;
+            float c;
+            float d;
+        };
+
+        /*
+         * Pasos precalculados de los recorridos por cuadrante, por desplazamiento. Cada paso indica
+         * qué candidata se elige y si está ajustado (sus dos candidatas quedan casi a la misma
+         * distancia de la recta), en cuyo caso se recurre al cálculo en coma flotante.
+         */
+        struct TablaTrayectos {
+            std::vector <int>           inicios;
+            std::vector <int>           cuentas;
+            std::vector <unsigned char> pasos;
+        };
+
+        static void centroHexagono (CeldaReglas celda, float & x, float & y);
+
+        bool recorre (
+                CeldaReglas                 celda_origen,
+                CeldaReglas                 celda_destino,
+                const PlanoCeldas &         plano_camino,
+                std::vector <CeldaReglas> * recorrido     ) const;
+
+        static const TablaTrayectos & tablaTrayectos ();
+        static TablaTrayectos generaTablaTrayectos ();
+        static int indiceTrayecto (int filas, int colns);
+
+        static void calculoDireccion (
+                CeldaReglas celda_origen, CeldaReglas celda_destino,
+                int & direccion_exacta, int & direccion_cuadrante );
+
+        static CeldaReglas celdaProximaExacta (CeldaReglas celda_sale, int direccion_exacta);
+
+        static void celdasCandidatasCuadrante (
+                CeldaReglas celda_sale, int direccion_cuadrante, std::array <CeldaReglas, 2> & celda_proxm);
+
+        static CeldaReglas celdaProximaCuadrante (
+                CeldaReglas celda_sale, int direccion_cuadrante, const EcuacionRecta & recta);
+
+        bool libre (CeldaReglas celda, const PlanoCeldas & plano_camino) const;
+
+        static void aserta (bool expresion, const std::string & mensaje);
+
+    };
+
+
+}
@@ -0,0 +1,36 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  TurnoReglas.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace reglas {
+
+
+    /*
+     * \enum ModoReglas
+     * \brief Orden de los turnos de cada modo de juego.
+     */
+    enum class ModoReglas : uint8_t {
+        pares,          /*!< un personaje por lado; se alternan una acción cada uno hasta agotarse */
+        equipo,         /*!< los lados se alternan una acción cada vez */
+        libre_doble     /*!< cada lado elige un personaje, que hace hasta dos acciones seguidas */
+    };
+
+
+    /*
+     * \struct TurnoReglas
+     * \brief Situación del turno: a quién le toca actuar y con qué personajes.
+     */
+    struct TurnoReglas {
+        ModoReglas             modo;
+        LadoReglas             lado;          /*!< lado que actúa */
+        int8_t                 acciones;      /*!< acciones que le quedan al lado en su turno (libre doble) */
+        std::array <int8_t, 2> elegidos;      /*!< personaje de cada lado en el turno, o -1 si aún lo elige */
+        LadoReglas             inicial {};    /*!< lado que abre cada vuelta de los personajes (equipo) */
+    };
+
+
+}
@@ -0,0 +1,37 @@
+﻿// proyecto: Grupal/Reglas
+// archivo:  reglas.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+// Biblioteca de reglas del juego sin dependencias gráficas: no incluye UNIR-2D ni SFML, de modo que
+// se puede compilar y ejecutar en cualquier plataforma para simulaciones sin ventana.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cassert>
+#include <climits>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TableroReglas.h"
+#include "EstadoReglas.h"
+#include "AccionReglas.h"
+#include "TurnoReglas.h"
+#include "ReglasJuego.h"
+#include "DistanciaCamino.h"
+#include "BusquedaCamino.h"
+#include "GeneradorAcciones.h"
+#include "BusquedaExpectimax.h"
+#include "BusquedaMonteCarlo.h"
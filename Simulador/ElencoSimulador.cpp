@@ -0,0 +1,370 @@
+﻿// proyecto: Grupal/Simulador
+// archivo   ElencoSimulador.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "simulador.h"
+
+namespace simulador {
+
+    using namespace reglas;
+
+    ElencoSimulador ElencoSimulador::carga (const std::string & archivo) {
+        std::ifstream entrada {archivo};
+        aserta (entrada.is_open (), "no se puede abrir el archivo de elenco '" + archivo + "'");
+
+        ElencoSimulador elenco {};
+        std::string texto;
+        int numero = 0;
+        while (std::getline (entrada, texto)) {
+            numero ++;
+            std::istringstream linea {texto};
+            try {
+                elenco.interpreta (linea);
+            } catch (const std::runtime_error & error) {
+                throw std::runtime_error (archivo + ":" + std::to_string (numero) + ": " + error.what ());
+            }
+        }
+        elenco.completa ();
+        return elenco;
+    }
+
+    const CatalogoReglas & ElencoSimulador::catalogo () const {
+        return catalogo_;
+    }
+
+    const std::string & ElencoSimulador::nombreLado (LadoReglas lado) const {
+        return nombres_lados [static_cast <int> (lado)];
+    }
+
+    const std::string & ElencoSimulador::nombrePersonaje (int indice) const {
+        return nombres_personajes.at (indice);
+    }
+
+    const std::string & ElencoSimulador::nombreHabilidad (int indice) const {
+        return nombres_habilidades.at (indice);
+    }
+
+    void ElencoSimulador::preparaPartida (
+            AzarSimulador &                 azar,
+            EstadoReglas &                  estado,
+            std::vector <TesoroSimulador> & tesoros ) const {
+        estado = EstadoReglas {};
+        estado.cuenta_personajes = catalogo_.cuenta_personajes;
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            PersonajeReglas & persj = estado.personajes [indc];
+            persj.sitio     = sitios_personajes [indc];
+            persj.vitalidad = maximaVitalidad;
+            estado.tablero.mueveFicha (CeldaReglas {0, 0}, persj.sitio);
+        }
+        for (CeldaReglas muro : sitios_muros) {
+            estado.tablero.ponMuro (muro);
+        }
+        if (muros_aleatorios) {
+            generaMuros (azar, estado.tablero);
+        }
+
+        // como en JuegoMesa::configuraJuego, cada tesoro cura o daña con la misma probabilidad
+        std::uniform_int_distribution <int> tipo_efecto {0, 1};
+        tesoros.clear ();
+        for (int indc = 0; indc < static_cast <int> (sitios_tesoros.size ()); ++ indc) {
+            int valor = valores_tesoros [indc];
+            tesoros.push_back (TesoroSimulador {
+                    sitios_tesoros [indc], tipo_efecto (azar) == 1 ? valor : -valor, false });
+        }
+    }
+
+    void ElencoSimulador::interpreta (std::istringstream & linea) {
+        std::string clave;
+        if (! (linea >> clave) || clave [0] == '#') {
+            return;
+        }
+        if (clave == "lado") {
+            LadoReglas ladr = lado (palabra (linea));
+            nombres_lados [static_cast <int> (ladr)] = palabra (linea);
+        } else if (clave == "desplaza") {
+            float valor;
+            aserta (static_cast <bool> (linea >> valor) && valor > 0, "valor de desplazamiento erróneo");
+            catalogo_.puntos_accion_de_desplaza = valor;
+        } else if (clave == "ataque") {
+            nombres_ataques.push_back (palabra (linea));
+        } else if (clave == "defensa") {
+            nombres_defensas.push_back (palabra (linea));
+        } else if (clave == "dano") {
+            nombres_danos.push_back (palabra (linea));
+        } else if (clave == "grado") {
+            aserta (nombres_grados.size () < maximoGrados, "demasiados grados de efectividad");
+            GradoReglas & grado = catalogo_.grados [nombres_grados.size ()];
+            nombres_grados.push_back (palabra (linea));
+            std::string superior = palabra (linea);
+            grado.valor_superior = superior == "max" ? INT_MAX : std::stoi (superior);
+            grado.porciento_dano = static_cast <int16_t> (entero (linea));
+        } else if (clave == "habilidad") {
+            interpretaHabilidad (linea);
+        } else if (clave == "ataca") {
+            interpretaAtaca (linea);
+        } else if (clave == "cura") {
+            interpretaCura (linea);
+        } else if (clave == "efecto") {
+            interpretaEfecto (linea);
+        } else if (clave == "personaje") {
+            interpretaPersonaje (linea);
+        } else if (clave == "estadistica") {
+            interpretaEstadistica (linea);
+        } else if (clave == "usa") {
+            interpretaUsa (linea);
+        } else if (clave == "muros") {
+            aserta (palabra (linea) == "aleatorios", "se esperaba 'muros aleatorios'");
+            muros_aleatorios = true;
+        } else if (clave == "muro") {
+            sitios_muros.push_back (celda (linea));
+        } else if (clave == "tesoro") {
+            sitios_tesoros .push_back (celda (linea));
+            valores_tesoros.push_back (entero (linea));
+        } else {
+            aserta (false, "palabra clave desconocida '" + clave + "'");
+        }
+    }
+
+    void ElencoSimulador::interpretaHabilidad (std::istringstream & linea) {
+        aserta (nombres_habilidades.size () < maximoHabilidades, "demasiadas habilidades");
+        HabilidadReglas & habilidad = catalogo_.habilidades [nombres_habilidades.size ()];
+        nombres_habilidades.push_back (palabra (linea));
+
+        static const std::vector <std::string> enfoques     {"si_mismo", "personaje", "area"};
+        static const std::vector <std::string> accesos      {"ninguno", "directo", "indirecto"};
+        static const std::vector <std::string> antagonistas {"oponente", "aliado", "si_mismo"};
+        habilidad = HabilidadReglas {};
+        habilidad.enfoque     = static_cast <EnfoqueReglas>     (busca (enfoques,     palabra (linea)));
+        habilidad.acceso      = static_cast <AccesoReglas>      (busca (accesos,      palabra (linea)));
+        habilidad.antagonista = static_cast <AntagonistaReglas> (busca (antagonistas, palabra (linea)));
+        habilidad.coste       = static_cast <int8_t> (entero (linea));
+        habilidad.alcance     = static_cast <int8_t> (entero (linea));
+        habilidad.radio       = static_cast <int8_t> (entero (linea));
+        habilidad.ataque      = sinEstadistica;
+        habilidad.defensa     = sinEstadistica;
+        habilidad.dano        = sinEstadistica;
+    }
+
+    void ElencoSimulador::interpretaAtaca (std::istringstream & linea) {
+        HabilidadReglas & habilidad = catalogo_.habilidades [busca (nombres_habilidades, palabra (linea))];
+        habilidad.ataque     = static_cast <int8_t>  (busca (nombres_ataques,  palabra (linea)));
+        habilidad.defensa    = static_cast <int8_t>  (busca (nombres_defensas, palabra (linea)));
+        habilidad.dano       = static_cast <int8_t>  (busca (nombres_danos,    palabra (linea)));
+        habilidad.valor_dano = static_cast <int16_t> (entero (linea));
+    }
+
+    void ElencoSimulador::interpretaCura (std::istringstream & linea) {
+        HabilidadReglas & habilidad = catalogo_.habilidades [busca (nombres_habilidades, palabra (linea))];
+        habilidad.valor_curacion = static_cast <int16_t> (entero (linea));
+    }
+
+    void ElencoSimulador::interpretaEfecto (std::istringstream & linea) {
+        HabilidadReglas & habilidad = catalogo_.habilidades [busca (nombres_habilidades, palabra (linea))];
+        std::string clase = palabra (linea);
+        EfectoReglas efecto;
+        if (clase == "ataque") {
+            efecto.estadistica = static_cast <int8_t> (busca (nombres_ataques, palabra (linea)));
+            efecto.valor       = static_cast <int16_t> (entero (linea));
+            aserta (habilidad.cuenta_efectos_ataque < maximoEfectos, "demasiados efectos de ataque");
+            habilidad.efectos_ataque [habilidad.cuenta_efectos_ataque ++] = efecto;
+        } else if (clase == "defensa") {
+            efecto.estadistica = static_cast <int8_t> (busca (nombres_defensas, palabra (linea)));
+            efecto.valor       = static_cast <int16_t> (entero (linea));
+            aserta (habilidad.cuenta_efectos_defensa < maximoEfectos, "demasiados efectos de defensa");
+            habilidad.efectos_defensa [habilidad.cuenta_efectos_defensa ++] = efecto;
+        } else {
+            aserta (false, "se esperaba 'ataque' o 'defensa'");
+        }
+    }
+
+    void ElencoSimulador::interpretaPersonaje (std::istringstream & linea) {
+        aserta (nombres_personajes.size () < maximoPersonajes, "demasiados personajes");
+        FichaReglas & ficha = catalogo_.fichas [nombres_personajes.size ()];
+        nombres_personajes.push_back (palabra (linea));
+        ficha = FichaReglas {};
+        ficha.lado                = lado (palabra (linea));
+        ficha.iniciativa          = static_cast <int8_t> (entero (linea));
+        ficha.puntos_accion_ronda = static_cast <int8_t> (entero (linea));
+        aserta (ficha.puntos_accion_ronda > 0 && ficha.puntos_accion_ronda <= maximoPuntosAccion,
+                "puntos de acción fuera de rango");
+        sitios_personajes.push_back (celda (linea));
+    }
+
+    void ElencoSimulador::interpretaEstadistica (std::istringstream & linea) {
+        FichaReglas & ficha = catalogo_.fichas [busca (nombres_personajes, palabra (linea))];
+        std::string clase = palabra (linea);
+        if (clase == "ataque") {
+            int indc = busca (nombres_ataques, palabra (linea));
+            ficha.con_ataque  |= 1u << indc;
+            ficha.ataque [indc] = static_cast <int16_t> (entero (linea));
+        } else if (clase == "defensa") {
+            int indc = busca (nombres_defensas, palabra (linea));
+            ficha.con_defensa |= 1u << indc;
+            ficha.defensa [indc] = static_cast <int16_t> (entero (linea));
+        } else if (clase == "reduce") {
+            int indc = busca (nombres_danos, palabra (linea));
+            ficha.con_reduce_dano |= 1u << indc;
+            ficha.reduce_dano [indc] = static_cast <int16_t> (entero (linea));
+        } else {
+            aserta (false, "se esperaba 'ataque', 'defensa' o 'reduce'");
+        }
+    }
+
+    void ElencoSimulador::interpretaUsa (std::istringstream & linea) {
+        FichaReglas & ficha = catalogo_.fichas [busca (nombres_personajes, palabra (linea))];
+        std::string nombre;
+        while (linea >> nombre) {
+            aserta (ficha.cuenta_habilidades < maximoHabilidadesFicha, "demasiadas habilidades del personaje");
+            ficha.habilidades [ficha.cuenta_habilidades ++] = static_cast <int8_t> (busca (nombres_habilidades, nombre));
+        }
+    }
+
+    void ElencoSimulador::completa () {
+        aserta (nombres_ataques .size () <= maximoEstadisticas &&
+                nombres_defensas.size () <= maximoEstadisticas &&
+                nombres_danos   .size () <= maximoEstadisticas,
+                "demasiados tipos de estadística");
+        aserta (nombres_grados.size () > 0, "grados de efectividad no configurados");
+        aserta (catalogo_.puntos_accion_de_desplaza > 0, "desplazamiento no configurado");
+
+        catalogo_.cuenta_personajes  = static_cast <int> (nombres_personajes .size ());
+        catalogo_.cuenta_habilidades = static_cast <int> (nombres_habilidades.size ());
+        catalogo_.cuenta_grados      = static_cast <int> (nombres_grados     .size ());
+
+        // los modos de juego exigen el mismo número de personajes en los dos lados
+        int cuenta_izqrd = 0;
+        int cuenta_derch = 0;
+        for (int indc = 0; indc < catalogo_.cuenta_personajes; ++ indc) {
+            if (catalogo_.fichas [indc].lado == LadoReglas::izquierda) {
+                cuenta_izqrd ++;
+            } else {
+                cuenta_derch ++;
+            }
+        }
+        aserta (cuenta_izqrd > 0 && cuenta_izqrd == cuenta_derch,
+                "el elenco necesita el mismo número de personajes en los dos lados");
+    }
+
+    void ElencoSimulador::generaMuros (AzarSimulador & azar, TableroReglas & tablero) const {
+        // El mismo procedimiento que generaMurosAleatorios de JuegoMesa, expresado en celdas: en cada
+        // franja de cuatro filas se colocan una o dos islas de formas fijas en la mitad izquierda y
+        // se reflejan en la mitad derecha, lejos de los sitios de los personajes y de los tesoros.
+        constexpr int filas   = TableroReglas::filas;
+        constexpr int fichas  = 25;
+        constexpr int mitad   = fichas / 2;
+        constexpr int franja  = 4;
+        constexpr std::array <int, franja> desplazam {0, 1, 0, 1};
+
+        using Forma = std::vector <std::pair <int, int>>;
+        static const std::array <Forma, 6> formas {
+                Forma {{0, 0}, {0, 1}, {1, 0}, {1, 1}},
+                Forma {{0, 0}, {0, 1}, {0, 2}, {0, 3}, {0, 4}},
+                Forma {{0, 1}, {1, 0}, {1, 1}, {1, 2}, {2, 1}},
+                Forma {{0, 0}, {1, 0}, {2, 0}, {2, 1}, {2, 2}},
+                Forma {{0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {1, 2}},
+                Forma {{0, 1}, {0, 2}, {0, 3}, {1, 0}, {1, 3}, {2, 0}, {2, 3}}  };
+
+        auto protegida = [this] (int fila, int coln) {
+            for (const std::vector <CeldaReglas> * sitios : {& sitios_personajes, & sitios_tesoros}) {
+                for (CeldaReglas sitio : * sitios) {
+                    if (std::abs (sitio.fila - fila) <= 1 && std::abs (sitio.coln - coln) <= 1) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+        auto admitida = [&protegida] (int fila, int coln) {
+            return coln <= TableroReglas::columnas && fila % 2 == coln % 2 && ! protegida (fila, coln);
+        };
+
+        std::uniform_int_distribution <int> cuenta_islas {1, 2};
+        std::uniform_int_distribution <int> indice_forma {0, static_cast <int> (formas.size ()) - 1};
+        for (int bloque = 0; bloque < filas / franja; ++ bloque) {
+            int cuenta = cuenta_islas (azar);
+            for (int indc = 0; indc < cuenta; ++ indc) {
+                const Forma & forma = formas [indice_forma (azar)];
+                int ancho = 0;
+                for (const auto & [df, dc] : forma) {
+                    ancho = std::max (ancho, dc + 1);
+                }
+                std::uniform_int_distribution <int> coln_isla {0, mitad - ancho};
+                int coln_base = coln_isla (azar);
+                int fila_base = bloque * franja + static_cast <int> (azar () % franja);
+                int coln_refl = fichas - ancho - coln_base;
+
+                bool valida = true;
+                for (const auto & [df, dc] : forma) {
+                    int rr  = fila_base + df;
+                    int cc  = coln_base + dc;
+                    int cc2 = coln_refl + dc;
+                    if (rr >= filas || cc >= mitad || cc2 < mitad || cc2 >= fichas) {
+                        valida = false;
+                        break;
+                    }
+                    if (! admitida (rr + 1, desplazam [rr % franja] + 2 * cc  + 1) ||
+                        ! admitida (rr + 1, desplazam [rr % franja] + 2 * cc2 + 1)   ) {
+                        valida = false;
+                        break;
+                    }
+                }
+                if (! valida) {
+                    indc --;
+                    continue;
+                }
+                for (const auto & [df, dc] : forma) {
+                    int rr = fila_base + df;
+                    int16_t fila = static_cast <int16_t> (rr + 1);
+                    tablero.ponMuro (CeldaReglas {fila, static_cast <int16_t> (desplazam [rr % franja] + 2 * (coln_base + dc) + 1)});
+                    tablero.ponMuro (CeldaReglas {fila, static_cast <int16_t> (desplazam [rr % franja] + 2 * (coln_refl + dc) + 1)});
+                }
+            }
+        }
+    }
+
+    int ElencoSimulador::busca (const std::vector <std::string> & nombres, const std::string & nombre) {
+        for (int indc = 0; indc < static_cast <int> (nombres.size ()); ++ indc) {
+            if (nombres [indc] == nombre) {
+                return indc;
+            }
+        }
+        aserta (false, "nombre desconocido '" + nombre + "'");
+        return -1;
+    }
+
+    LadoReglas ElencoSimulador::lado (const std::string & nombre) {
+        if (nombre == "izquierda") {
+            return LadoReglas::izquierda;
+        }
+        aserta (nombre == "derecha", "se esperaba 'izquierda' o 'derecha'");
+        return LadoReglas::derecha;
+    }
+
+    std::string ElencoSimulador::palabra (std::istringstream & linea) {
+        std::string texto;
+        aserta (static_cast <bool> (linea >> texto), "faltan valores en la línea");
+        return texto;
+    }
+
+    int ElencoSimulador::entero (std::istringstream & linea) {
+        int valor;
+        aserta (static_cast <bool> (linea >> valor), "se esperaba un número entero");
+        return valor;
+    }
+
+    CeldaReglas ElencoSimulador::celda (std::istringstream & linea) {
+        int fila = entero (linea);
+        int coln = entero (linea);
+        CeldaReglas celda {static_cast <int16_t> (fila), static_cast <int16_t> (coln)};
+        aserta (TableroReglas::celdaEnTablero (celda), "celda fuera del tablero");
+        return celda;
+    }
+
+    void ElencoSimulador::aserta (bool expresion, const std::string & mensaje) {
+        if (expresion) {
+            return;
+        }
+        throw std::runtime_error (mensaje);
+    }
+
+}
@@ -0,0 +1,140 @@
+﻿// proyecto: Grupal/Simulador
+// archivo:  ElencoSimulador.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace simulador {
+
+
+    /*!
+     * \brief Generador de números aleatorios de cada hilo del simulador.
+     */
+    using AzarSimulador = std::mt19937_64;
+
+
+    /*
+     * \struct TesoroSimulador
+     * \brief Tesoro de una partida: celda y cambio de vitalidad al recogerlo (negativo si es daño).
+     */
+    struct TesoroSimulador {
+        reglas::CeldaReglas sitio;
+        int                 efecto;
+        bool                recogido;
+    };
+
+
+    /*
+     * \class ElencoSimulador
+     * \brief Configuración de las partidas simuladas, leída de un archivo de texto.
+     *
+     * El archivo describe lo mismo que JuegoMesa prepara en código (tipos de estadísticas, grados
+     * de efectividad, habilidades, personajes con sus estadísticas y habilidades, muros y tesoros).
+     * No se escribe a mano: lo escribe el juego con la opción --elenco, a partir de la configuración
+     * que prepara (tapete::CapturaReglas::escribeElenco); un ajuste del elenco se prueba editando
+     * después el archivo, sin compilar. Cada línea empieza por una palabra clave; las líneas vacías
+     * y las que empiezan por '#' se ignoran. Los nombres no llevan espacios y los índices siguen el
+     * orden de las líneas:
+     *
+     *     lado        <izquierda|derecha> <nombre>
+     *     desplaza    <píxeles por punto de acción>
+     *     ataque      <tipo>          (y también: defensa <tipo>, dano <tipo>)
+     *     grado       <nombre> <valor superior del ataque final | max> <porcentaje de daño>
+     *     habilidad   <nombre> <si_mismo|personaje|area> <ninguno|directo|indirecto>
+     *                 <oponente|aliado|si_mismo> <coste> <alcance> <radio>
+     *     ataca       <habilidad> <tipo ataque> <tipo defensa> <tipo daño> <daño>
+     *     cura        <habilidad> <curación>
+     *     efecto      <habilidad> <ataque|defensa> <tipo> <valor>
+     *     personaje   <nombre> <lado> <iniciativa> <puntos de acción por ronda> <fila> <columna>
+     *     estadistica <personaje> <ataque|defensa|reduce> <tipo> <valor>
+     *     usa         <personaje> <habilidad>...
+     *     muros       aleatorios      (o bien: muro <fila> <columna>)
+     *     tesoro      <fila> <columna> <cambio de vitalidad>
+     */
+    class ElencoSimulador {
+    public:
+
+        /*!
+         * \brief Lee el elenco de un archivo.
+         * \param archivo Ruta del archivo de elenco.
+         * \throw std::runtime_error si el archivo no se puede leer o tiene una línea errónea.
+         */
+        static ElencoSimulador carga (const std::string & archivo);
+
+        /*!
+         * \brief Devuelve el catálogo de reglas del elenco.
+         */
+        const reglas::CatalogoReglas & catalogo () const;
+
+        /*!
+         * \brief Devuelve el nombre de un lado del tablero.
+         * \param lado Lado del tablero.
+         */
+        const std::string & nombreLado (reglas::LadoReglas lado) const;
+
+        /*!
+         * \brief Devuelve el nombre de un personaje.
+         * \param indice Índice del personaje en el catálogo.
+         */
+        const std::string & nombrePersonaje (int indice) const;
+
+        /*!
+         * \brief Devuelve el nombre de una habilidad.
+         * \param indice Índice de la habilidad en el catálogo.
+         */
+        const std::string & nombreHabilidad (int indice) const;
+
+        /*!
+         * \brief Prepara el estado inicial de una partida: sitios, vitalidad, muros y tesoros.
+         * \param azar Generador para los muros aleatorios y el efecto de los tesoros.
+         * \param estado Estado inicial; los puntos de acción se asignan al iniciar la ronda.
+         * \param tesoros Tesoros de la partida.
+         */
+        void preparaPartida (
+                AzarSimulador &                 azar,
+                reglas::EstadoReglas &          estado,
+                std::vector <TesoroSimulador> & tesoros ) const;
+
+    private:
+
+        reglas::CatalogoReglas catalogo_ {};
+
+        std::array <std::string, 2>       nombres_lados {"izquierda", "derecha"};
+        std::vector <std::string>         nombres_personajes {};
+        std::vector <std::string>         nombres_habilidades {};
+        std::vector <std::string>         nombres_ataques {};
+        std::vector <std::string>         nombres_defensas {};
+        std::vector <std::string>         nombres_danos {};
+        std::vector <std::string>         nombres_grados {};
+        std::vector <reglas::CeldaReglas> sitios_personajes {};
+        std::vector <reglas::CeldaReglas> sitios_muros {};
+        std::vector <reglas::CeldaReglas> sitios_tesoros {};
+        std::vector <int>                 valores_tesoros {};
+        bool                              muros_aleatorios {false};
+
+        void interpreta (std::istringstream & linea);
+        void interpretaHabilidad   (std::istringstream & linea);
+        void interpretaAtaca       (std::istringstream & linea);
+        void interpretaCura        (std::istringstream & linea);
+        void interpretaEfecto      (std::istringstream & linea);
+        void interpretaPersonaje   (std::istringstream & linea);
+        void interpretaEstadistica (std::istringstream & linea);
+        void interpretaUsa         (std::istringstream & linea);
+        void completa ();
+
+        void generaMuros (AzarSimulador & azar, reglas::TableroReglas & tablero) const;
+
+        static int busca (const std::vector <std::string> & nombres, const std::string & nombre);
+        static reglas::LadoReglas lado (const std::string & nombre);
+        static std::string palabra (std::istringstream & linea);
+        static int entero (std::istringstream & linea);
+        static reglas::CeldaReglas celda (std::istringstream & linea);
+
+        static void aserta (bool expresion, const std::string & mensaje);
+
+    };
+
+
+}
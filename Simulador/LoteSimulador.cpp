@@ -0,0 +1,141 @@
+﻿// proyecto: Grupal/Simulador
+// archivo   LoteSimulador.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "simulador.h"
+
+namespace simulador {
+
+    using namespace reglas;
+
+    void EstadisticaSimulador::suma (const ResultadoPartida & resultado) {
+        partidas ++;
+        victorias [resultado.ganador < 0 ? 2 : resultado.ganador] ++;
+        rondas   += resultado.rondas;
+        acciones += resultado.acciones;
+        pases    += resultado.pases;
+        for (int indc = 0; indc < maximoHabilidades; ++ indc) {
+            usos_habilidades [indc] += resultado.usos_habilidades [indc];
+            dano_habilidades [indc] += resultado.dano_habilidades [indc];
+        }
+    }
+
+    void EstadisticaSimulador::suma (const EstadisticaSimulador & otra) {
+        partidas += otra.partidas;
+        for (int indc = 0; indc < static_cast <int> (victorias.size ()); ++ indc) {
+            victorias [indc] += otra.victorias [indc];
+        }
+        rondas   += otra.rondas;
+        acciones += otra.acciones;
+        pases    += otra.pases;
+        for (int indc = 0; indc < maximoHabilidades; ++ indc) {
+            usos_habilidades [indc] += otra.usos_habilidades [indc];
+            dano_habilidades [indc] += otra.dano_habilidades [indc];
+        }
+    }
+
+    LoteSimulador::LoteSimulador (
+            const ElencoSimulador & elenco,
+            const std::string &     politica_izquierda,
+            const std::string &     politica_derecha,
+            int                     maximo_rondas,
+            int                     hilos_busqueda    ) :
+            elenco_            {elenco},
+            politica_izquierda {politica_izquierda},
+            politica_derecha   {politica_derecha},
+            maximo_rondas      {maximo_rondas},
+            hilos_busqueda     {hilos_busqueda} {
+        // crea las políticas una vez para rechazar nombres erróneos antes de lanzar los hilos
+        PoliticaSimulador::crea (politica_izquierda, hilos_busqueda);
+        PoliticaSimulador::crea (politica_derecha,   hilos_busqueda);
+    }
+
+    EstadisticaSimulador LoteSimulador::ejecuta (ModoSimulador modo, int partidas, int hilos, uint64_t semilla) const {
+        hilos = std::clamp (hilos, 1, std::max (partidas, 1));
+        std::vector <EstadisticaSimulador> parciales (hilos, EstadisticaSimulador {});
+        std::vector <std::thread> trabajos;
+        for (int indc = 0; indc < hilos; ++ indc) {
+            trabajos.emplace_back (
+                    & LoteSimulador::trabaja, this, modo, partidas, hilos, indc, semilla, std::ref (parciales [indc]));
+        }
+        for (std::thread & trabajo : trabajos) {
+            trabajo.join ();
+        }
+
+        EstadisticaSimulador total {};
+        for (const EstadisticaSimulador & parcial : parciales) {
+            total.suma (parcial);
+        }
+        return total;
+    }
+
+    void LoteSimulador::trabaja (
+            ModoSimulador          modo,
+            int                    partidas,
+            int                    hilos,
+            int                    indice_hilo,
+            uint64_t               semilla,
+            EstadisticaSimulador & estadistica ) const {
+        // un generador independiente por hilo, derivado de la semilla del lote y del índice del hilo
+        std::seed_seq semillas {
+                static_cast <uint32_t> (semilla), static_cast <uint32_t> (semilla >> 32),
+                static_cast <uint32_t> (indice_hilo) };
+        AzarSimulador azar {semillas};
+
+        std::unique_ptr <PoliticaSimulador> izquierda = PoliticaSimulador::crea (politica_izquierda, hilos_busqueda);
+        std::unique_ptr <PoliticaSimulador> derecha   = PoliticaSimulador::crea (politica_derecha,   hilos_busqueda);
+        PartidaSimulador partida {elenco_, * izquierda, * derecha, maximo_rondas};
+        ResultadoPartida resultado;
+        for (int indc = indice_hilo; indc < partidas; indc += hilos) {
+            partida.juega (modo, azar, resultado);
+            estadistica.suma (resultado);
+        }
+    }
+
+    void LoteSimulador::informa (
+            std::ostream &               salida,
+            ModoSimulador                modo,
+            const EstadisticaSimulador & estadistica,
+            double                       segundos    ) const {
+        auto porcentaje = [&estadistica] (int64_t cuenta) {
+            return estadistica.partidas == 0 ? 0.0 : 100.0 * cuenta / estadistica.partidas;
+        };
+        auto media = [] (int64_t suma, int64_t cuenta) {
+            return cuenta == 0 ? 0.0 : static_cast <double> (suma) / cuenta;
+        };
+
+        salida << std::fixed << std::setprecision (1);
+        salida << "Modo " << nombreModo (modo) << ": " << estadistica.partidas << " partidas en "
+               << std::setprecision (2) << segundos << " s" << std::setprecision (1) << std::endl;
+        salida << "  " << elenco_.nombreLado (LadoReglas::izquierda) << " (" << politica_izquierda << "): "
+               << porcentaje (estadistica.victorias [0]) << " %   "
+               << elenco_.nombreLado (LadoReglas::derecha)   << " (" << politica_derecha   << "): "
+               << porcentaje (estadistica.victorias [1]) << " %   "
+               << "empates: " << porcentaje (estadistica.victorias [2]) << " %" << std::endl;
+        salida << "  rondas por partida: "   << media (estadistica.rondas,   estadistica.partidas)
+               << "   acciones por partida: " << media (estadistica.acciones, estadistica.partidas)
+               << "   pases por partida: "    << media (estadistica.pases,    estadistica.partidas) << std::endl;
+        salida << "  " << std::left << std::setw (24) << "habilidad" << std::right
+               << std::setw (12) << "usos/partida" << std::setw (12) << "daño/uso"
+               << std::setw (16) << "daño/partida" << std::endl;
+        for (int indc = 0; indc < elenco_.catalogo ().cuenta_habilidades; ++ indc) {
+            salida << "  " << std::left << std::setw (24) << elenco_.nombreHabilidad (indc) << std::right
+                   << std::setw (12) << media (estadistica.usos_habilidades [indc], estadistica.partidas)
+                   << std::setw (12) << media (estadistica.dano_habilidades [indc], estadistica.usos_habilidades [indc])
+                   << std::setw (16) << media (estadistica.dano_habilidades [indc], estadistica.partidas) << std::endl;
+        }
+    }
+
+    const std::string LoteSimulador::nombreModo (ModoSimulador modo) {
+        switch (modo) {
+        case ModoSimulador::pares:
+            return "pares";
+        case ModoSimulador::equipo:
+            return "equipo";
+        case ModoSimulador::libre_doble:
+            return "libre-doble";
+        }
+        return "";
+    }
+
+}
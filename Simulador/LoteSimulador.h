@@ -0,0 +1,114 @@
+﻿// proyecto: Grupal/Simulador
+// archivo:  LoteSimulador.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace simulador {
+
+
+    /*
+     * \struct EstadisticaSimulador
+     * \brief Suma de los resultados de un lote de partidas.
+     */
+    struct EstadisticaSimulador {
+        int                 partidas;
+        std::array <int, 3> victorias;         /*!< izquierda, derecha y empates */
+        int64_t             rondas;
+        int64_t             acciones;
+        int64_t             pases;
+        std::array <int64_t, reglas::maximoHabilidades> usos_habilidades;
+        std::array <int64_t, reglas::maximoHabilidades> dano_habilidades;
+
+        /*!
+         * \brief Acumula el resultado de una partida.
+         * \param resultado Resultado de la partida.
+         */
+        void suma (const ResultadoPartida & resultado);
+
+        /*!
+         * \brief Acumula la estadística de otro hilo.
+         * \param otra Estadística de otro hilo.
+         */
+        void suma (const EstadisticaSimulador & otra);
+    };
+
+
+    /*
+     * \class LoteSimulador
+     * \brief Juega un lote de partidas en varios hilos y resume los resultados.
+     *
+     * Cada hilo tiene su propio generador, sus reglas y sus políticas, y juega las partidas cuyo
+     * número es congruente con su índice; los hilos no comparten nada mutable salvo al final, cuando
+     * se suman sus estadísticas. Con la misma semilla y el mismo número de hilos, el lote da el mismo
+     * resultado.
+     */
+    class LoteSimulador {
+    public:
+
+        /*!
+         * \brief Constructor.
+         * \param elenco Elenco de las partidas.
+         * \param politica_izquierda Nombre de la política del lado izquierdo.
+         * \param politica_derecha Nombre de la política del lado derecho.
+         * \param maximo_rondas Rondas tras las que una partida acaba en empate.
+         * \param hilos_busqueda Hilos de la búsqueda de cada política "montecarlo".
+         */
+        LoteSimulador (
+                const ElencoSimulador & elenco,
+                const std::string &     politica_izquierda,
+                const std::string &     politica_derecha,
+                int                     maximo_rondas,
+                int                     hilos_busqueda    );
+
+        /*!
+         * \brief Juega un lote de partidas.
+         * \param modo Modo de juego.
+         * \param partidas Número de partidas.
+         * \param hilos Número de hilos.
+         * \param semilla Semilla del lote; de ella se derivan las de los hilos.
+         * \return Estadística del lote.
+         */
+        EstadisticaSimulador ejecuta (ModoSimulador modo, int partidas, int hilos, uint64_t semilla) const;
+
+        /*!
+         * \brief Escribe el informe de un lote.
+         * \param salida Flujo de salida.
+         * \param modo Modo de juego.
+         * \param estadistica Estadística del lote.
+         * \param segundos Duración del lote.
+         */
+        void informa (
+                std::ostream &               salida,
+                ModoSimulador                modo,
+                const EstadisticaSimulador & estadistica,
+                double                       segundos    ) const;
+
+        /*!
+         * \brief Devuelve el nombre de un modo de juego.
+         * \param modo Modo de juego.
+         */
+        static const std::string nombreModo (ModoSimulador modo);
+
+    private:
+
+        const ElencoSimulador & elenco_;
+        std::string             politica_izquierda;
+        std::string             politica_derecha;
+        int                     maximo_rondas;
+        int                     hilos_busqueda;
+
+        void trabaja (
+                ModoSimulador          modo,
+                int                    partidas,
+                int                    hilos,
+                int                    indice_hilo,
+                uint64_t               semilla,
+                EstadisticaSimulador & estadistica ) const;
+
+    };
+
+
+}
@@ -0,0 +1,263 @@
+﻿// proyecto: Grupal/Simulador
+// archivo   PartidaSimulador.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "simulador.h"
+
+namespace simulador {
+
+    using namespace reglas;
+
+    PartidaSimulador::PartidaSimulador (
+            const ElencoSimulador & elenco,
+            PoliticaSimulador &     izquierda,
+            PoliticaSimulador &     derecha,
+            int                     maximo_rondas ) :
+            elenco_       {elenco},
+            reglas_       {elenco.catalogo ()},
+            acciones_     {reglas_},
+            politicas     {& izquierda, & derecha},
+            maximo_rondas {maximo_rondas} {
+    }
+
+    void PartidaSimulador::juega (ModoSimulador modo, AzarSimulador & azar, ResultadoPartida & resultado) {
+        resultado = ResultadoPartida {};
+        resultado.ganador = -1;
+        azar_      = & azar;
+        resultado_ = & resultado;
+        terminada  = false;
+        elenco_.preparaPartida (azar, estado, tesoros);
+        switch (modo) {
+        case ModoSimulador::pares:
+            juegaPares ();
+            break;
+        case ModoSimulador::equipo:
+            juegaEquipo ();
+            break;
+        case ModoSimulador::libre_doble:
+            juegaLibreDoble ();
+            break;
+        }
+        azar_      = nullptr;
+        resultado_ = nullptr;
+    }
+
+    void PartidaSimulador::juegaPares () {
+        // Cada turno, cada lado elige un personaje; empieza el de más iniciativa y se alternan una
+        // acción cada uno. Si al que le toca no le quedan puntos, repite el otro (ignoraPersonajeAgotado).
+        iniciaRonda ();
+        while (! terminada) {
+            std::array <int, 2> elegidos {eligePersonaje (LadoReglas::izquierda), eligePersonaje (LadoReglas::derecha)};
+            LadoReglas lado_activo = ladoIniciativa (
+                    elenco_.catalogo ().fichas [elegidos [0]].iniciativa,
+                    elenco_.catalogo ().fichas [elegidos [1]].iniciativa );
+            int activo = elegidos [static_cast <int> (lado_activo)];
+            while (true) {
+                turno = TurnoReglas {ModoReglas::pares, lado (activo), 1,
+                        {static_cast <int8_t> (elegidos [0]), static_cast <int8_t> (elegidos [1])}};
+                actua (activo);
+                if (terminada) {
+                    return;
+                }
+                int otro = elegidos [1 - static_cast <int> (lado (activo))];
+                if (disponible (otro)) {
+                    activo = otro;
+                } else if (! disponible (activo)) {
+                    break;
+                }
+            }
+            if (! turnosDisponiblesAmbos ()) {
+                iniciaRonda ();
+            }
+        }
+    }
+
+    void PartidaSimulador::juegaEquipo () {
+        // Los personajes actúan por turnos en orden fijo, alternando los lados y empezando por el
+        // equipo de más iniciativa; cada uno hace una acción por turno (ModoJuegoBase::estableceFactoresEquipos).
+        LadoReglas lado_inicial = equipoIniciativa ();
+        std::array <std::vector <int>, 2> por_lado;
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            por_lado [static_cast <int> (lado (indc))].push_back (indc);
+        }
+        const std::vector <int> & primero = por_lado [    static_cast <int> (lado_inicial)];
+        const std::vector <int> & segundo = por_lado [1 - static_cast <int> (lado_inicial)];
+        std::vector <int> factores;
+        for (int indc = 0; indc < static_cast <int> (primero.size ()); ++ indc) {
+            factores.push_back (primero [indc]);
+            factores.push_back (segundo [indc]);
+        }
+
+        iniciaRonda ();
+        while (! terminada) {
+            for (int persj : factores) {
+                if (! disponible (persj)) {
+                    continue;
+                }
+                turno = TurnoReglas {ModoReglas::equipo, lado (persj), 1, {-1, -1}, lado_inicial};
+                turno.elegidos [static_cast <int> (turno.lado)] = static_cast <int8_t> (persj);
+                actua (persj);
+                if (terminada) {
+                    return;
+                }
+            }
+            if (! turnosDisponiblesAmbos ()) {
+                iniciaRonda ();
+            }
+        }
+    }
+
+    void PartidaSimulador::juegaLibreDoble () {
+        // Los lados se alternan, empezando por el equipo de más iniciativa; en cada turno el lado
+        // elige un personaje, que hace hasta dos acciones.
+        LadoReglas lado_actual = equipoIniciativa ();
+        iniciaRonda ();
+        while (! terminada) {
+            int persj = eligePersonaje (lado_actual);
+            turno = TurnoReglas {ModoReglas::libre_doble, lado_actual, 2, {-1, -1}};
+            turno.elegidos [static_cast <int> (lado_actual)] = static_cast <int8_t> (persj);
+            actua (persj);
+            if (terminada) {
+                return;
+            }
+            if (disponible (persj)) {
+                turno.acciones = 1;
+                actua (persj);
+                if (terminada) {
+                    return;
+                }
+            }
+            lado_actual = lado_actual == LadoReglas::izquierda ? LadoReglas::derecha : LadoReglas::izquierda;
+            if (! turnosDisponiblesAmbos ()) {
+                iniciaRonda ();
+            }
+        }
+    }
+
+    void PartidaSimulador::actua (int personaje) {
+        PersonajeReglas & persj = estado.personajes [personaje];
+        int puntos_previos = persj.puntos_accion;
+        std::array <int16_t, maximoPersonajes> vitalidades;
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            vitalidades [indc] = estado.personajes [indc].vitalidad;
+        }
+
+        AccionReglas accion;
+        bool aplicada = false;
+        if (politicas [static_cast <int> (lado (personaje))]->eligeAccion (estado, personaje, turno, acciones_, * azar_, accion)) {
+            // el valor aleatorio lo decide la partida, no la política, como en ModoJuegoBase
+            std::uniform_int_distribution <int> aleatorio_100 {0, 99};
+            accion.aleatorio_100 = static_cast <int8_t> (aleatorio_100 (* azar_));
+            aplicada = reglas_.aplica (estado, accion);
+        }
+        // Los modos no permiten pasar, pero un personaje encerrado o sin puntos para ninguna
+        // habilidad no tiene acción posible: agota sus puntos para que la partida avance. Lo mismo
+        // con una acción que no gaste puntos, que solo aparece con elencos mal configurados.
+        if (! aplicada || persj.puntos_accion >= puntos_previos) {
+            persj.puntos_accion = 0;
+        }
+        if (! aplicada) {
+            resultado_->pases ++;
+            return;
+        }
+
+        resultado_->acciones ++;
+        if (accion.tipo == TipoAccionReglas::habilidad) {
+            int dano = 0;
+            for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+                dano += std::max (0, vitalidades [indc] - estado.personajes [indc].vitalidad);
+            }
+            resultado_->usos_habilidades [accion.habilidad] ++;
+            resultado_->dano_habilidades [accion.habilidad] += dano;
+        } else {
+            recogeTesoro (personaje);
+        }
+        compruebaFinal ();
+    }
+
+    void PartidaSimulador::iniciaRonda () {
+        if (resultado_->rondas == maximo_rondas) {
+            terminada = true;
+            return;
+        }
+        resultado_->rondas ++;
+        reglas_.restauraRonda (estado);
+    }
+
+    void PartidaSimulador::recogeTesoro (int personaje) {
+        PersonajeReglas & persj = estado.personajes [personaje];
+        for (TesoroSimulador & tesoro : tesoros) {
+            if (! tesoro.recogido && tesoro.sitio == persj.sitio) {
+                persj.vitalidad = static_cast <int16_t> (std::clamp (persj.vitalidad + tesoro.efecto, 0, maximaVitalidad));
+                tesoro.recogido = true;
+                return;
+            }
+        }
+    }
+
+    void PartidaSimulador::compruebaFinal () {
+        std::array <bool, 2> vivos {false, false};
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            if (estado.personajes [indc].vitalidad > 0) {
+                vivos [static_cast <int> (lado (indc))] = true;
+            }
+        }
+        if (! vivos [0]) {
+            resultado_->ganador = 1;
+            terminada = true;
+        } else if (! vivos [1]) {
+            resultado_->ganador = 0;
+            terminada = true;
+        }
+    }
+
+    bool PartidaSimulador::disponible (int personaje) const {
+        const PersonajeReglas & persj = estado.personajes [personaje];
+        return persj.vitalidad > 0 && persj.puntos_accion > 0;
+    }
+
+    bool PartidaSimulador::turnosDisponiblesAmbos () const {
+        std::array <bool, 2> lados {false, false};
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            if (disponible (indc)) {
+                lados [static_cast <int> (lado (indc))] = true;
+            }
+        }
+        return lados [0] && lados [1];
+    }
+
+    int PartidaSimulador::eligePersonaje (LadoReglas lado_elige) {
+        disponibles.clear ();
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            if (lado (indc) == lado_elige && disponible (indc)) {
+                disponibles.push_back (indc);
+            }
+        }
+        return politicas [static_cast <int> (lado_elige)]->eligePersonaje (estado, disponibles, * azar_);
+    }
+
+    LadoReglas PartidaSimulador::lado (int personaje) const {
+        return elenco_.catalogo ().fichas [personaje].lado;
+    }
+
+    LadoReglas PartidaSimulador::ladoIniciativa (int iniciativa_izqrd, int iniciativa_derch) {
+        if (iniciativa_izqrd > iniciativa_derch) {
+            return LadoReglas::izquierda;
+        }
+        if (iniciativa_izqrd < iniciativa_derch) {
+            return LadoReglas::derecha;
+        }
+        std::uniform_int_distribution <int> moneda {0, 1};
+        return moneda (* azar_) == 0 ? LadoReglas::izquierda : LadoReglas::derecha;
+    }
+
+    LadoReglas PartidaSimulador::equipoIniciativa () {
+        std::array <int, 2> iniciativas {-1, -1};
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            int & iniciativa = iniciativas [static_cast <int> (lado (indc))];
+            iniciativa = std::max (iniciativa, static_cast <int> (elenco_.catalogo ().fichas [indc].iniciativa));
+        }
+        return ladoIniciativa (iniciativas [0], iniciativas [1]);
+    }
+
+}
@@ -0,0 +1,106 @@
+﻿// proyecto: Grupal/Simulador
+// archivo:  PartidaSimulador.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace simulador {
+
+
+    /*
+     * \enum ModoSimulador
+     * \brief Modos de juego que reproduce el simulador.
+     */
+    enum class ModoSimulador {
+        pares,          /*!< ModoJuegoPares */
+        equipo,         /*!< ModoJuegoEquipo */
+        libre_doble     /*!< ModoJuegoLibreDoble */
+    };
+
+
+    /*
+     * \struct ResultadoPartida
+     * \brief Resumen de una partida simulada.
+     */
+    struct ResultadoPartida {
+        int ganador;            /*!< 0 izquierda, 1 derecha, -1 empate por límite de rondas */
+        int rondas;
+        int acciones;
+        int pases;              /*!< veces que un personaje no tenía acción útil y agotó sus puntos */
+        std::array <int, reglas::maximoHabilidades> usos_habilidades;
+        std::array <int, reglas::maximoHabilidades> dano_habilidades;
+    };
+
+
+    /*
+     * \class PartidaSimulador
+     * \brief Juega partidas completas de un modo, con una política por lado.
+     *
+     * La secuencia de rondas, turnos y jugadas reproduce la de ModoJuegoPares, ModoJuegoEquipo y
+     * ModoJuegoLibreDoble; las acciones se validan y aplican con ReglasJuego. Los tesoros se recogen
+     * al acabar un desplazamiento en su celda, como en JuegoMesa::verificaRecoleccion. La partida
+     * termina cuando un lado se queda sin personajes vivos o al superar el límite de rondas, que
+     * los modos del juego no tienen.
+     */
+    class PartidaSimulador {
+    public:
+
+        /*!
+         * \brief Constructor.
+         * \param elenco Elenco de la partida.
+         * \param izquierda Política del lado izquierdo.
+         * \param derecha Política del lado derecho.
+         * \param maximo_rondas Rondas tras las que la partida acaba en empate.
+         */
+        PartidaSimulador (
+                const ElencoSimulador & elenco,
+                PoliticaSimulador &     izquierda,
+                PoliticaSimulador &     derecha,
+                int                     maximo_rondas );
+
+        /*!
+         * \brief Juega una partida completa.
+         * \param modo Modo de juego.
+         * \param azar Generador del hilo.
+         * \param resultado Resumen de la partida.
+         */
+        void juega (ModoSimulador modo, AzarSimulador & azar, ResultadoPartida & resultado);
+
+    private:
+
+        const ElencoSimulador &              elenco_;
+        reglas::ReglasJuego                  reglas_;
+        reglas::GeneradorAcciones            acciones_;
+        std::array <PoliticaSimulador *, 2>  politicas;
+        int                                  maximo_rondas;
+
+        reglas::EstadoReglas                 estado {};
+        reglas::TurnoReglas                  turno {};
+        std::vector <TesoroSimulador>        tesoros {};
+        std::vector <int>                    disponibles {};
+        AzarSimulador *                      azar_ {};
+        ResultadoPartida *                   resultado_ {};
+        bool                                 terminada {};
+
+        void juegaPares ();
+        void juegaEquipo ();
+        void juegaLibreDoble ();
+
+        void actua (int personaje);
+        void iniciaRonda ();
+        void recogeTesoro (int personaje);
+        void compruebaFinal ();
+
+        bool disponible (int personaje) const;
+        bool turnosDisponiblesAmbos () const;
+        int  eligePersonaje (reglas::LadoReglas lado);
+        reglas::LadoReglas lado (int personaje) const;
+        reglas::LadoReglas ladoIniciativa (int iniciativa_izqrd, int iniciativa_derch);
+        reglas::LadoReglas equipoIniciativa ();
+
+    };
+
+
+}
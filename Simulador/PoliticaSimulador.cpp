@@ -0,0 +1,247 @@
+﻿// proyecto: Grupal/Simulador
+// archivo   PoliticaSimulador.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "simulador.h"
+
+namespace simulador {
+
+    using namespace reglas;
+
+    std::unique_ptr <PoliticaSimulador> PoliticaSimulador::crea (const std::string & nombre, int hilos_busqueda) {
+        if (nombre == "aleatoria") {
+            return std::make_unique <PoliticaAleatoria> ();
+        }
+        if (nombre == "guion") {
+            return std::make_unique <PoliticaGuion> ();
+        }
+        if (nombre == "expectimax") {
+            return std::make_unique <PoliticaExpectimax> ();
+        }
+        if (nombre == "montecarlo") {
+            return std::make_unique <PoliticaMonteCarlo> (hilos_busqueda);
+        }
+        throw std::runtime_error ("política desconocida '" + nombre + "'");
+    }
+
+    int PoliticaAleatoria::eligePersonaje (
+            const EstadoReglas &      /*estado*/,
+            const std::vector <int> & disponibles,
+            AzarSimulador &           azar        ) {
+        std::uniform_int_distribution <int> distrb {0, static_cast <int> (disponibles.size ()) - 1};
+        return disponibles [distrb (azar)];
+    }
+
+    bool PoliticaAleatoria::eligeAccion (
+            const EstadoReglas & estado,
+            int                  personaje,
+            const TurnoReglas &  /*turno*/,
+            GeneradorAcciones &  acciones,
+            AzarSimulador &      azar,
+            AccionReglas &       accion    ) {
+        acciones.habilidades (estado, personaje, habilidades);
+        std::uniform_int_distribution <int> moneda {0, 1};
+        if (habilidades.empty () || moneda (azar) == 1) {
+            const std::vector <CeldaReglas> & celdas =
+                    acciones.alcanzables (estado, personaje, estado.personajes [personaje].puntos_accion);
+            if (! celdas.empty ()) {
+                std::uniform_int_distribution <int> distrb {0, static_cast <int> (celdas.size ()) - 1};
+                acciones.desplazamiento (personaje, celdas [distrb (azar)], accion);
+                return true;
+            }
+        }
+        if (habilidades.empty ()) {
+            return false;
+        }
+        std::uniform_int_distribution <int> distrb {0, static_cast <int> (habilidades.size ()) - 1};
+        accion = habilidades [distrb (azar)];
+        return true;
+    }
+
+    int PoliticaGuion::eligePersonaje (
+            const EstadoReglas &      estado,
+            const std::vector <int> & disponibles,
+            AzarSimulador &           /*azar*/    ) {
+        int elegido = disponibles [0];
+        for (int indc : disponibles) {
+            if (estado.personajes [indc].puntos_accion > estado.personajes [elegido].puntos_accion) {
+                elegido = indc;
+            }
+        }
+        return elegido;
+    }
+
+    bool PoliticaGuion::eligeAccion (
+            const EstadoReglas & estado,
+            int                  personaje,
+            const TurnoReglas &  /*turno*/,
+            GeneradorAcciones &  acciones,
+            AzarSimulador &      /*azar*/,
+            AccionReglas &       accion    ) {
+        const CatalogoReglas & catalogo = acciones.reglas ().catalogo ();
+        auto ataca = [&catalogo] (int indc_habld) {
+            const HabilidadReglas & habilidad = catalogo.habilidades [indc_habld];
+            return habilidad.enfoque != EnfoqueReglas::si_mismo && habilidad.antagonista == AntagonistaReglas::oponente;
+        };
+
+        acciones.habilidades (estado, personaje, habilidades);
+        float mejor_dano = 0.0f;
+        int   mejor_indc = -1;
+        for (int indc = 0; indc < static_cast <int> (habilidades.size ()); ++ indc) {
+            if (! ataca (habilidades [indc].habilidad)) {
+                continue;
+            }
+            float dano = danoEsperado (estado, habilidades [indc], acciones);
+            if (dano > mejor_dano) {
+                mejor_dano = dano;
+                mejor_indc = indc;
+            }
+        }
+        if (mejor_indc >= 0) {
+            accion = habilidades [mejor_indc];
+            return true;
+        }
+
+        const FichaReglas & ficha = catalogo.fichas [personaje];
+        int reserva = maximoPuntosAccion;
+        for (int indc = 0; indc < ficha.cuenta_habilidades; ++ indc) {
+            if (ataca (ficha.habilidades [indc])) {
+                reserva = std::min (reserva, static_cast <int> (catalogo.habilidades [ficha.habilidades [indc]].coste));
+            }
+        }
+        int puntos = estado.personajes [personaje].puntos_accion;
+        if (puntos > reserva && acercaPersonaje (estado, personaje, puntos - reserva, acciones, accion)) {
+            return true;
+        }
+        for (const AccionReglas & habilidad : habilidades) {
+            if (! ataca (habilidad.habilidad)) {
+                accion = habilidad;
+                return true;
+            }
+        }
+        return acercaPersonaje (estado, personaje, puntos, acciones, accion);
+    }
+
+    float PoliticaGuion::danoEsperado (
+            const EstadoReglas & estado,
+            const AccionReglas & accion,
+            GeneradorAcciones &  acciones ) {
+        // promedio sobre diez valores aleatorios repartidos por el intervalo 0..99
+        LadoReglas lado = acciones.reglas ().catalogo ().fichas [accion.personaje].lado;
+        float dano = 0.0f;
+        for (int aleatorio = 5; aleatorio < 100; aleatorio += 10) {
+            prueba = estado;
+            AccionReglas accion_prueba = accion;
+            accion_prueba.aleatorio_100 = static_cast <int8_t> (aleatorio);
+            acciones.reglas ().aplica (prueba, accion_prueba);
+            for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+                int perdida = estado.personajes [indc].vitalidad - prueba.personajes [indc].vitalidad;
+                if (acciones.reglas ().catalogo ().fichas [indc].lado == lado) {
+                    dano -= perdida;
+                } else {
+                    dano += perdida;
+                }
+            }
+        }
+        return dano / 10.0f;
+    }
+
+    bool PoliticaGuion::acercaPersonaje (
+            const EstadoReglas & estado,
+            int                  personaje,
+            int                  puntos,
+            GeneradorAcciones &  acciones,
+            AccionReglas &       accion    ) {
+        const CatalogoReglas & catalogo = acciones.reglas ().catalogo ();
+        CeldaReglas sitio = estado.personajes [personaje].sitio;
+        int   objetivo = -1;
+        float distn_objetivo = 0.0f;
+        for (int indc = 0; indc < estado.cuenta_personajes; ++ indc) {
+            if (catalogo.fichas [indc].lado == catalogo.fichas [personaje].lado ||
+                estado.personajes [indc].vitalidad <= 0                           ) {
+                continue;
+            }
+            float distn = TableroReglas::distancia (sitio, estado.personajes [indc].sitio);
+            if (objetivo < 0 || distn < distn_objetivo) {
+                objetivo       = indc;
+                distn_objetivo = distn;
+            }
+        }
+        if (objetivo < 0) {
+            return false;
+        }
+
+        CeldaReglas sitio_objetivo = estado.personajes [objetivo].sitio;
+        const CeldaReglas * mejor_celda = nullptr;
+        float mejor_distn = distn_objetivo;
+        for (const CeldaReglas & celda : acciones.alcanzables (estado, personaje, puntos)) {
+            float distn = TableroReglas::distancia (celda, sitio_objetivo);
+            if (distn < mejor_distn) {
+                mejor_celda = & celda;
+                mejor_distn = distn;
+            }
+        }
+        if (mejor_celda == nullptr) {
+            return false;
+        }
+        acciones.desplazamiento (personaje, * mejor_celda, accion);
+        return true;
+    }
+
+    bool PoliticaExpectimax::eligeAccion (
+            const EstadoReglas & estado,
+            int                  personaje,
+            const TurnoReglas &  turno,
+            GeneradorAcciones &  acciones,
+            AzarSimulador &      /*azar*/,
+            AccionReglas &       accion    ) {
+        if (acciones_busqueda != & acciones) {
+            busqueda          = std::make_unique <BusquedaExpectimax> (acciones);
+            acciones_busqueda = & acciones;
+        }
+        static const std::function <bool ()> sin_limite = [] () {
+            return false;
+        };
+        // la partida ya ha elegido el personaje: la búsqueda solo decide su acción
+        TurnoReglas turno_personaje = turno;
+        turno_personaje.elegidos [static_cast <int> (turno.lado)] = static_cast <int8_t> (personaje);
+        ResultadoBusqueda resultado;
+        if (! busqueda->busca (estado, turno_personaje, profundidad, sin_limite, resultado)) {
+            return false;
+        }
+        accion = resultado.accion;
+        return true;
+    }
+
+    PoliticaMonteCarlo::PoliticaMonteCarlo (int hilos_busqueda) :
+            hilos_busqueda {hilos_busqueda} {
+    }
+
+    bool PoliticaMonteCarlo::eligeAccion (
+            const EstadoReglas & estado,
+            int                  personaje,
+            const TurnoReglas &  turno,
+            GeneradorAcciones &  acciones,
+            AzarSimulador &      azar,
+            AccionReglas &       accion    ) {
+        // cada partida tiene su catálogo: la búsqueda, con sus hilos, se crea al cambiar de partida
+        const CatalogoReglas & catalogo = acciones.reglas ().catalogo ();
+        if (catalogo_busqueda != & catalogo) {
+            busqueda          = std::make_unique <BusquedaMonteCarlo> (catalogo, hilos_busqueda, azar ());
+            catalogo_busqueda = & catalogo;
+        }
+        static const std::function <bool ()> sin_limite = [] () {
+            return false;
+        };
+        // la partida ya ha elegido el personaje: la búsqueda solo decide su acción
+        TurnoReglas turno_personaje = turno;
+        turno_personaje.elegidos [static_cast <int> (turno.lado)] = static_cast <int8_t> (personaje);
+        ResultadoBusqueda resultado;
+        if (! busqueda->busca (estado, turno_personaje, simulaciones, sin_limite, resultado)) {
+            return false;
+        }
+        accion = resultado.accion;
+        return true;
+    }
+
+}
@@ -0,0 +1,202 @@
+﻿// proyecto: Grupal/Simulador
+// archivo:  PoliticaSimulador.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace simulador {
+
+
+    /*
+     * \class PoliticaSimulador
+     * \brief Decide por un lado del tablero: qué personaje actúa y qué acción hace.
+     *
+     * Cada hilo del simulador crea sus propias políticas, así que pueden guardar datos de trabajo
+     * sin sincronización.
+     */
+    class PoliticaSimulador {
+    public:
+
+        virtual ~PoliticaSimulador () = default;
+
+        /*!
+         * \brief Crea una política por su nombre: "aleatoria", "guion", "expectimax" o "montecarlo".
+         * \param nombre Nombre de la política.
+         * \param hilos_busqueda Hilos de la búsqueda de "montecarlo", además de los del lote.
+         * \throw std::runtime_error si el nombre no corresponde a ninguna política.
+         */
+        static std::unique_ptr <PoliticaSimulador> crea (const std::string & nombre, int hilos_busqueda);
+
+        /*!
+         * \brief Elige el personaje que actúa entre los disponibles de un lado.
+         * \param estado Estado de la partida.
+         * \param disponibles Índices de los personajes con vitalidad y puntos de acción.
+         * \param azar Generador del hilo.
+         * \return Índice del personaje elegido.
+         */
+        virtual int eligePersonaje (
+                const reglas::EstadoReglas & estado,
+                const std::vector <int> &    disponibles,
+                AzarSimulador &              azar        ) = 0;
+
+        /*!
+         * \brief Elige la acción de un personaje.
+         * \param estado Estado de la partida.
+         * \param personaje Índice del personaje que actúa.
+         * \param turno Situación del turno en que actúa el personaje.
+         * \param acciones Enumerador de acciones válidas.
+         * \param azar Generador del hilo.
+         * \param accion Acción elegida, ya validada.
+         * \return false si el personaje no tiene ninguna acción útil y pasa.
+         */
+        virtual bool eligeAccion (
+                const reglas::EstadoReglas & estado,
+                int                          personaje,
+                const reglas::TurnoReglas &  turno,
+                reglas::GeneradorAcciones &  acciones,
+                AzarSimulador &              azar,
+                reglas::AccionReglas &       accion    ) = 0;
+
+    };
+
+
+    /*
+     * \class PoliticaAleatoria
+     * \brief Elige al azar: la mitad de las veces una habilidad válida y si no un desplazamiento.
+     */
+    class PoliticaAleatoria : public PoliticaSimulador {
+    public:
+
+        int eligePersonaje (
+                const reglas::EstadoReglas & estado,
+                const std::vector <int> &    disponibles,
+                AzarSimulador &              azar        ) override;
+
+        bool eligeAccion (
+                const reglas::EstadoReglas & estado,
+                int                          personaje,
+                const reglas::TurnoReglas &  turno,
+                reglas::GeneradorAcciones &  acciones,
+                AzarSimulador &              azar,
+                reglas::AccionReglas &       accion    ) override;
+
+    private:
+
+        std::vector <reglas::AccionReglas> habilidades {};
+
+    };
+
+
+    /*
+     * \class PoliticaGuion
+     * \brief Juega con un guion fijo, como un jugador prudente.
+     *
+     * Usa la habilidad que más daño neto hace en promedio (al oponente menos a los aliados); si no
+     * puede atacar, se acerca al oponente vivo más próximo guardando los puntos de su habilidad de
+     * ataque más barata; y si tampoco puede acercarse, usa una habilidad sobre sí mismo o un aliado.
+     * Actúa primero el personaje con más puntos de acción.
+     */
+    class PoliticaGuion : public PoliticaSimulador {
+    public:
+
+        int eligePersonaje (
+                const reglas::EstadoReglas & estado,
+                const std::vector <int> &    disponibles,
+                AzarSimulador &              azar        ) override;
+
+        bool eligeAccion (
+                const reglas::EstadoReglas & estado,
+                int                          personaje,
+                const reglas::TurnoReglas &  turno,
+                reglas::GeneradorAcciones &  acciones,
+                AzarSimulador &              azar,
+                reglas::AccionReglas &       accion    ) override;
+
+    private:
+
+        std::vector <reglas::AccionReglas> habilidades {};
+
+        reglas::EstadoReglas prueba {};
+
+        float danoEsperado (
+                const reglas::EstadoReglas & estado,
+                const reglas::AccionReglas & accion,
+                reglas::GeneradorAcciones &  acciones );
+
+        bool acercaPersonaje (
+                const reglas::EstadoReglas & estado,
+                int                          personaje,
+                int                          puntos,
+                reglas::GeneradorAcciones &  acciones,
+                reglas::AccionReglas &       accion    );
+
+    };
+
+
+    /*
+     * \class PoliticaExpectimax
+     * \brief Elige la acción con BusquedaExpectimax; el personaje que actúa, como PoliticaGuion.
+     *
+     * Busca a profundidad fija y sin límite de tiempo, para que un lote dé el mismo resultado con la
+     * misma semilla.
+     */
+    class PoliticaExpectimax : public PoliticaGuion {
+    public:
+
+        bool eligeAccion (
+                const reglas::EstadoReglas & estado,
+                int                          personaje,
+                const reglas::TurnoReglas &  turno,
+                reglas::GeneradorAcciones &  acciones,
+                AzarSimulador &              azar,
+                reglas::AccionReglas &       accion    ) override;
+
+    private:
+
+        static constexpr int profundidad = 3;
+
+        std::unique_ptr <reglas::BusquedaExpectimax> busqueda {};
+        reglas::GeneradorAcciones *                  acciones_busqueda {};
+
+    };
+
+
+    /*
+     * \class PoliticaMonteCarlo
+     * \brief Elige la acción con BusquedaMonteCarlo; el personaje que actúa, como PoliticaGuion.
+     *
+     * Hace un número fijo de simulaciones por jugada, sin límite de tiempo. Con un solo hilo de
+     * búsqueda el lote da el mismo resultado con la misma semilla; con más, el reparto de las
+     * simulaciones entre los hilos cambia de una ejecución a otra.
+     */
+    class PoliticaMonteCarlo : public PoliticaGuion {
+    public:
+
+        /*!
+         * \brief Constructor.
+         * \param hilos_busqueda Hilos de la búsqueda, contando el de la partida.
+         */
+        explicit PoliticaMonteCarlo (int hilos_busqueda);
+
+        bool eligeAccion (
+                const reglas::EstadoReglas & estado,
+                int                          personaje,
+                const reglas::TurnoReglas &  turno,
+                reglas::GeneradorAcciones &  acciones,
+                AzarSimulador &              azar,
+                reglas::AccionReglas &       accion    ) override;
+
+    private:
+
+        static constexpr int64_t simulaciones = 400;
+
+        int                                          hilos_busqueda;
+        std::unique_ptr <reglas::BusquedaMonteCarlo> busqueda {};
+        const reglas::CatalogoReglas *               catalogo_busqueda {};
+
+    };
+
+
+}
@@ -0,0 +1,5 @@
+﻿// proyecto: Grupal/Simulador
+// archivo:  pch.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "simulador.h"
@@ -0,0 +1,95 @@
+﻿// proyecto: Grupal/Simulador
+// archivo:  principal.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "simulador.h"
+
+using namespace simulador;
+
+
+static void escribeUso () {
+    std::cout << "Uso: Simulador [opciones]" << std::endl;
+    std::cout << "  --elenco    <archivo>    elenco de la partida (elenco.txt)" << std::endl;
+    std::cout << "  --modo      <modo>       pares, equipo, libre-doble o todos (todos)" << std::endl;
+    std::cout << "  --partidas  <número>     partidas por modo (1000)" << std::endl;
+    std::cout << "  --hilos     <número>     hilos de simulación (los núcleos del equipo)" << std::endl;
+    std::cout << "  --semilla   <número>     semilla del lote (aleatoria)" << std::endl;
+    std::cout << "  --izquierda <política>   aleatoria, guion, expectimax o montecarlo (guion)" << std::endl;
+    std::cout << "  --derecha   <política>   aleatoria, guion, expectimax o montecarlo (guion)" << std::endl;
+    std::cout << "  --rondas    <número>     rondas tras las que la partida es empate (30)" << std::endl;
+    std::cout << "  --hilos-busqueda <número> hilos de cada búsqueda montecarlo (1)" << std::endl;
+}
+
+
+int main (int argc, char * argv []) {
+    std::string archivo_elenco     {"elenco.txt"};
+    std::string nombre_modo        {"todos"};
+    int         partidas           {1000};
+    int         hilos              {static_cast <int> (std::max (1u, std::thread::hardware_concurrency ()))};
+    uint64_t    semilla            {(static_cast <uint64_t> (std::random_device {} ()) << 32) | std::random_device {} ()};
+    std::string politica_izquierda {"guion"};
+    std::string politica_derecha   {"guion"};
+    int         maximo_rondas      {30};
+    int         hilos_busqueda     {1};
+
+    try {
+        for (int indc = 1; indc < argc; ++ indc) {
+            std::string opcion {argv [indc]};
+            if (opcion == "--ayuda" || opcion == "-h") {
+                escribeUso ();
+                return 0;
+            }
+            if (indc + 1 >= argc) {
+                throw std::runtime_error ("falta el valor de la opción '" + opcion + "'");
+            }
+            std::string valor {argv [++ indc]};
+            if (opcion == "--elenco") {
+                archivo_elenco = valor;
+            } else if (opcion == "--modo") {
+                nombre_modo = valor;
+            } else if (opcion == "--partidas") {
+                partidas = std::stoi (valor);
+            } else if (opcion == "--hilos") {
+                hilos = std::stoi (valor);
+            } else if (opcion == "--semilla") {
+                semilla = std::stoull (valor);
+            } else if (opcion == "--izquierda") {
+                politica_izquierda = valor;
+            } else if (opcion == "--derecha") {
+                politica_derecha = valor;
+            } else if (opcion == "--rondas") {
+                maximo_rondas = std::stoi (valor);
+            } else if (opcion == "--hilos-busqueda") {
+                hilos_busqueda = std::stoi (valor);
+            } else {
+                throw std::runtime_error ("opción desconocida '" + opcion + "'");
+            }
+        }
+
+        std::vector <ModoSimulador> modos;
+        for (ModoSimulador modo : {ModoSimulador::pares, ModoSimulador::equipo, ModoSimulador::libre_doble}) {
+            if (nombre_modo == "todos" || nombre_modo == LoteSimulador::nombreModo (modo)) {
+                modos.push_back (modo);
+            }
+        }
+        if (modos.empty ()) {
+            throw std::runtime_error ("modo desconocido '" + nombre_modo + "'");
+        }
+
+        ElencoSimulador elenco = ElencoSimulador::carga (archivo_elenco);
+        LoteSimulador   lote {elenco, politica_izquierda, politica_derecha, maximo_rondas, hilos_busqueda};
+        std::cout << "Elenco: " << archivo_elenco << "   hilos: " << hilos << "   semilla: " << semilla << std::endl;
+        for (ModoSimulador modo : modos) {
+            auto inicio = std::chrono::steady_clock::now ();
+            EstadisticaSimulador estadistica = lote.ejecuta (modo, partidas, hilos, semilla);
+            std::chrono::duration <double> duracion = std::chrono::steady_clock::now () - inicio;
+            std::cout << std::endl;
+            lote.informa (std::cout, modo, estadistica, duracion.count ());
+        }
+    } catch (const std::exception & excepcion) {
+        std::cerr << "Error: " << excepcion.what () << std::endl;
+        escribeUso ();
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,32 @@
+﻿// proyecto: Grupal/Simulador
+// archivo:  simulador.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+// Simulador de partidas por lotes. Juega partidas completas sobre la biblioteca de reglas, sin
+// ventana ni recursos gráficos, para comparar ajustes del elenco en segundos. No reproduce los
+// diarios de partida del juego, que anotan entradas de la interfaz y no acciones de las reglas;
+// para eso está la opción --reproduce del juego (ver tapete::DiarioPartida).
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <reglas.h>
+
+#include "ElencoSimulador.h"
+#include "PoliticaSimulador.h"
+#include "PartidaSimulador.h"
+#include "LoteSimulador.h"
@@ -26,7 +26,7 @@ namespace tapete
 
         centro += PresenciaTablero::regionRejilla.posicion();
 
-        ficha.ponArchivoFicha(archivo_ficha);
+        ficha.ponArchivoFicha(juego->texturas(), archivo_ficha);
 
         ficha.posicionaEnCelda(pos);
         ficha.muestra(); // la hace visible
@@ -34,10 +34,7 @@ namespace tapete
 
     void ActorObjetoRecolectable::actualiza(double)
     {
-        if (recogido)
-            return;
-        Vector c = juego->tablero()->rejilla().centroHexagono(pos) + PresenciaTablero::regionRejilla.posicion();
-        ficha.posicionaEnCelda(pos);
+        // el objeto no se mueve: su ficha se coloca una sola vez, en inicia
     }
 
     void ActorObjetoRecolectable::termina()
@@ -66,6 +63,15 @@ namespace tapete
         return recogido;
     }
 
+    void ActorObjetoRecolectable::ponRecogido(bool valor)
+    {
+        bool anterior = recogido;
+        recogido = valor;
+        const std::vector<ActorObjetoRecolectable *> &objetos = juego->objetos();
+        int indice = static_cast<int>(std::find(objetos.begin(), objetos.end(), this) - objetos.begin());
+        juego->clavePartida().cambia(ClavePartida::Rasgo::tesoro, indice, anterior ? 1 : 0, recogido ? 1 : 0);
+    }
+
     Coord ActorObjetoRecolectable::sitioFicha() const
     {
         return pos;
@@ -84,6 +84,12 @@ namespace tapete {
          */
         bool estaRecogido() const;
 
+        /**
+         * @brief Marca el objeto como recolectado o no, y actualiza la clave de la partida.
+         * @param valor true si queda recogido.
+         */
+        void ponRecogido(bool valor);
+
         /**
          * @brief Obtiene la posición actual de la ficha en el tablero.
          * @return Coordenada de la ficha.
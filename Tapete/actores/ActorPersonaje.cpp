@@ -67,69 +67,75 @@ namespace tapete
 
     void ActorPersonaje::agregaAtaque(TipoAtaque *tipo_ataque, int valor)
     {
-        valores_tipo_ataque[tipo_ataque] = Multivalor{valor, 0};
+        juego_->estadisticas().agrega(TablaEstadisticas::Clase::ataque, indice_, tipo_ataque->indice(), valor);
     }
 
     bool ActorPersonaje::apareceAtaque(TipoAtaque *tipo_ataque) const
     {
-        return valores_tipo_ataque.contains(tipo_ataque);
+        return juego_->estadisticas().aparece(TablaEstadisticas::Clase::ataque, indice_, tipo_ataque->indice());
     }
 
     int ActorPersonaje::valorAtaque(TipoAtaque *tipo_ataque) const
     {
-        Multivalor multi = valores_tipo_ataque.at(tipo_ataque);
-        return multi.inicial + multi.cambio;
+        return juego_->estadisticas().valor(TablaEstadisticas::Clase::ataque, indice_, tipo_ataque->indice());
     }
 
     void ActorPersonaje::cambiaAtaque(TipoAtaque *tipo_ataque, int valor_cambio)
     {
-        valores_tipo_ataque.at(tipo_ataque).cambio = valor_cambio;
+        TablaEstadisticas &tabla = juego_->estadisticas();
+        int anterior = tabla.cambio(TablaEstadisticas::Clase::ataque, indice_, tipo_ataque->indice());
+        tabla.ponCambio(TablaEstadisticas::Clase::ataque, indice_, tipo_ataque->indice(), valor_cambio);
+        juego_->clavePartida().cambia(ClavePartida::Rasgo::cambioAtaque,
+                                      ClavePartida::indiceEstadistica(indice_, tipo_ataque->indice()), anterior, valor_cambio);
     }
 
     void ActorPersonaje::restauraAtaque(TipoAtaque *tipo_ataque)
     {
-        valores_tipo_ataque.at(tipo_ataque).cambio = 0;
+        cambiaAtaque(tipo_ataque, 0);
     }
 
     void ActorPersonaje::agregaDefensa(TipoDefensa *tipo_defensa, int valor)
     {
-        valores_tipo_defensa[tipo_defensa] = Multivalor{valor, 0};
+        juego_->estadisticas().agrega(TablaEstadisticas::Clase::defensa, indice_, tipo_defensa->indice(), valor);
     }
 
     bool ActorPersonaje::apareceDefensa(TipoDefensa *tipo_defensa) const
     {
-        return valores_tipo_defensa.contains(tipo_defensa);
+        return juego_->estadisticas().aparece(TablaEstadisticas::Clase::defensa, indice_, tipo_defensa->indice());
     }
 
     int ActorPersonaje::valorDefensa(TipoDefensa *tipo_defensa) const
     {
-        Multivalor multi = valores_tipo_defensa.at(tipo_defensa);
-        return multi.inicial + multi.cambio;
+        return juego_->estadisticas().valor(TablaEstadisticas::Clase::defensa, indice_, tipo_defensa->indice());
     }
 
     void ActorPersonaje::cambiaDefensa(TipoDefensa *tipo_defensa, int valor_cambio)
     {
-        valores_tipo_defensa.at(tipo_defensa).cambio = valor_cambio;
+        TablaEstadisticas &tabla = juego_->estadisticas();
+        int anterior = tabla.cambio(TablaEstadisticas::Clase::defensa, indice_, tipo_defensa->indice());
+        tabla.ponCambio(TablaEstadisticas::Clase::defensa, indice_, tipo_defensa->indice(), valor_cambio);
+        juego_->clavePartida().cambia(ClavePartida::Rasgo::cambioDefensa,
+                                      ClavePartida::indiceEstadistica(indice_, tipo_defensa->indice()), anterior, valor_cambio);
     }
 
     void ActorPersonaje::restauraDefensa(TipoDefensa *tipo_defensa)
     {
-        valores_tipo_defensa.at(tipo_defensa).cambio = 0;
+        cambiaDefensa(tipo_defensa, 0);
     }
 
     void ActorPersonaje::agregaReduceDano(TipoDano *tipo_dano, int valor)
     {
-        valores_tipo_reduce_dano[tipo_dano] = valor;
+        juego_->estadisticas().agrega(TablaEstadisticas::Clase::reduceDano, indice_, tipo_dano->indice(), valor);
     }
 
     bool ActorPersonaje::apareceReduceDano(TipoDano *tipo_dano) const
     {
-        return valores_tipo_reduce_dano.contains(tipo_dano);
+        return juego_->estadisticas().aparece(TablaEstadisticas::Clase::reduceDano, indice_, tipo_dano->indice());
     }
 
     int ActorPersonaje::valorReduceDano(TipoDano *tipo_dano) const
     {
-        return valores_tipo_reduce_dano.at(tipo_dano);
+        return juego_->estadisticas().valor(TablaEstadisticas::Clase::reduceDano, indice_, tipo_dano->indice());
     }
 
     const std::vector<Habilidad *> &ActorPersonaje::habilidades() const
@@ -164,7 +170,12 @@ namespace tapete
 
     void ActorPersonaje::ponSitioFicha(Coord valor)
     {
+        juego_->tablero()->ocupacion().mueveFicha(this, sitio_ficha, valor);
+        Coord anterior = sitio_ficha;
         sitio_ficha = valor;
+        cambio_sitio_ficha = true;
+        juego_->clavePartida().cambia(ClavePartida::Rasgo::sitio, indice_,
+                                      ClavePartida::valorCelda(anterior), ClavePartida::valorCelda(valor));
     }
 
     int ActorPersonaje::vitalidad() const
@@ -174,7 +185,9 @@ namespace tapete
 
     void ActorPersonaje::ponVitalidad(int valor)
     {
+        int anterior = vitalidad_;
         vitalidad_ = valor;
+        juego_->clavePartida().cambia(ClavePartida::Rasgo::vitalidad, indice_, anterior, valor);
     }
 
     int ActorPersonaje::puntosAccion() const
@@ -184,17 +197,9 @@ namespace tapete
 
     void ActorPersonaje::ponPuntosAccion(int valor)
     {
-        if (valor < 0)
-        {
-            puntos_accion = 0;
-            return;
-        }
-        if (ActorPersonaje::maximoPuntosAccion < valor)
-        {
-            puntos_accion = ActorPersonaje::maximoPuntosAccion;
-            return;
-        }
-        puntos_accion = valor;
+        int anterior = puntos_accion;
+        puntos_accion = std::clamp(valor, 0, ActorPersonaje::maximoPuntosAccion);
+        juego_->clavePartida().cambia(ClavePartida::Rasgo::puntosAccion, indice_, anterior, puntos_accion);
     }
 
     int ActorPersonaje::iniciativa() const
@@ -293,6 +298,7 @@ namespace tapete
         ponPosicion(Vector{0, 0});
 
         presencia_personaje.prepara();
+        cambio_sitio_ficha = true;
     }
 
     void ActorPersonaje::termina()
@@ -305,6 +311,10 @@ namespace tapete
     void ActorPersonaje::actualiza(double tiempo_seg)
     {
         refrescaFicha();
+        if (juego_->enReposo())
+        {
+            return;
+        }
         controlPersonajePulsacion();
         controlSobreFicha();
         controlFichaPulsacion();
@@ -312,6 +322,11 @@ namespace tapete
 
     void ActorPersonaje::refrescaFicha()
     {
+        if (!cambio_sitio_ficha)
+        {
+            return;
+        }
+        cambio_sitio_ficha = false;
         Vector poscn = RejillaTablero::centroHexagono(sitio_ficha);
         poscn += PresenciaTablero::regionRejilla.posicion();
         poscn -= PresenciaPersonaje::deslizaFicha;
@@ -325,6 +340,7 @@ namespace tapete
         {
             if (presencia_personaje.panel_lateral.contiene(unir2d::Raton::posicion()))
             {
+                juego_->diario().anota(SucesoDiario::personajeSeleccionado, this);
                 juego_->sucesos()->personajeSeleccionado(this);
             }
         }
@@ -377,10 +393,12 @@ namespace tapete
             {
                 if (dclic)
                 {
+                    juego_->diario().anota(SucesoDiario::fichaSeleccionada, this);
                     juego_->sucesos()->fichaSeleccionada(this);
                 }
                 if (sclic)
                 {
+                    juego_->diario().anota(SucesoDiario::fichaPulsada, this);
                     juego_->sucesos()->fichaPulsada(this);
                 }
             }
@@ -381,18 +381,9 @@ namespace tapete
         string archivo_retrato{};
         string archivo_ficha{};
 
-        struct Multivalor
-        {
-            int inicial;
-            int cambio;
-        };
-        std::map<TipoAtaque *, Multivalor> valores_tipo_ataque{};
-        std::map<TipoDefensa *, Multivalor> valores_tipo_defensa{};
-        std::map<TipoDano *, int> valores_tipo_reduce_dano{};
-
         std::vector<Habilidad *> lista_habilidades{};
 
-        int indice_;
+        int indice_{};
 
         Coord sitio_ficha{};
 
@@ -409,9 +400,11 @@ namespace tapete
         PresenciaPersonaje presencia_personaje{this};
 
         bool esta_sobre_ficha{false};
+        bool cambio_sitio_ficha{true}; ///< si la imagen de la ficha no está aún en sitio_ficha
 
         /*!
-         * \brief Refresca la representación de la ficha.
+         * \brief Coloca la imagen de la ficha en su celda, si la ficha se ha movido desde el último
+         *        refresco.
          */
         void refrescaFicha();
 
@@ -438,6 +431,8 @@ namespace tapete
         static void aserta(bool expresion, const string &mensaje);
 
         friend class CalculoCaminos;
+        friend class CapturaReglas;
+        friend class ClavePartida;
         friend class PresenciaPersonaje;
     };
 
@@ -70,6 +70,11 @@ namespace tapete
         return sitios_muros;
     }
 
+    OcupacionTablero &ActorTablero::ocupacion()
+    {
+        return ocupacion_tablero;
+    }
+
     void ActorTablero::situaMuros(const GraficoMuros &grafico_muros)
     {
         this->grafico_muros = &grafico_muros;
@@ -148,6 +153,7 @@ namespace tapete
                         if (ch == 'O')
                         {
                             sitios_muros.push_back(Coord{fila, coln});
+                            ocupacion_tablero.ponMuro(Coord{fila, coln});
                         }
                     }
                 }
@@ -350,6 +356,12 @@ namespace tapete
 
     void ActorTablero::actualiza(double tiempo_seg)
     {
+        if (juego->enReposo())
+        {
+            // sin entrada nueva los controles no cambiarían nada
+            rejilla_tablero.refrescaMarcaje();
+            return;
+        }
 
         controlSobreRetrato();
         controlSobreHabilidad();
@@ -490,10 +502,12 @@ namespace tapete
         {
             if (presencia_actuante_izqrd.panel_retrato.contiene(unir2d::Raton::posicion()))
             {
+                juego->diario().anota(SucesoDiario::actuanteSeleccionado, LadoTablero::Izquierda);
                 juego->sucesos()->actuanteSeleccionado(LadoTablero::Izquierda);
             }
             if (presencia_actuante_derch.panel_retrato.contiene(unir2d::Raton::posicion()))
             {
+                juego->diario().anota(SucesoDiario::actuanteSeleccionado, LadoTablero::Derecha);
                 juego->sucesos()->actuanteSeleccionado(LadoTablero::Derecha);
             }
         }
@@ -509,6 +523,7 @@ namespace tapete
             {
                 if (presencia_actuante_izqrd.paneles_habilidad[indc].contiene(unir2d::Raton::posicion()))
                 {
+                    juego->diario().anota(SucesoDiario::habilidadSeleccionada, LadoTablero::Izquierda, indc);
                     juego->sucesos()->habilidadSeleccionada(LadoTablero::Izquierda, indc);
                 }
             }
@@ -516,6 +531,7 @@ namespace tapete
             {
                 if (presencia_actuante_derch.paneles_habilidad[indc].contiene(unir2d::Raton::posicion()))
                 {
+                    juego->diario().anota(SucesoDiario::habilidadSeleccionada, LadoTablero::Derecha, indc);
                     juego->sucesos()->habilidadSeleccionada(LadoTablero::Derecha, indc);
                 }
             }
@@ -585,10 +601,12 @@ namespace tapete
             {
                 if (dclic)
                 {
+                    juego->diario().anota(SucesoDiario::celdaSeleccionada, coord);
                     juego->sucesos()->celdaSeleccionada(coord);
                 }
                 else if (sclic)
                 {
+                    juego->diario().anota(SucesoDiario::celdaPulsada, coord);
                     juego->sucesos()->celdaPulsada(coord);
                 }
             }
@@ -604,6 +622,7 @@ namespace tapete
             Vector separa{unir2d::Raton::posicion() - PresenciaTablero::centro_ayuda};
             if (unir2d::norma(separa) < PresenciaTablero::radio_ayuda)
             {
+                juego->diario().anota(SucesoDiario::ayudaSeleccionada);
                 juego->sucesos()->ayudaSeleccionada();
             }
         }
@@ -73,6 +73,12 @@ namespace tapete
          */
         const std::vector<Coord> &sitiosMuros() const;
 
+        /*!
+         * \brief Devuelve el mapa de ocupación de las celdas del tablero.
+         * \return Referencia al mapa de ocupación.
+         */
+        OcupacionTablero &ocupacion();
+
         /*!
          * \brief Sitúa los muros según un gráfico dado.
          * \param grafico_muros Gráfico de muros.
@@ -285,6 +291,7 @@ namespace tapete
         string archivo_escudo_derch{};
         const GraficoMuros *grafico_muros;
         std::vector<Coord> sitios_muros{};
+        OcupacionTablero ocupacion_tablero{};
         PresenciaTablero presencia_tablero{this};
         RejillaTablero rejilla_tablero{this};
         PresenciaHabilidades presencia_habilidades{this};
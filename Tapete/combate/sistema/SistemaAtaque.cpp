@@ -27,6 +27,9 @@ namespace tapete
     void SistemaAtaque::agregaEfectividad(GradoEfectividad *elemento)
     {
         grados_efectividad.push_back(elemento);
+        grados_reglas.push_back(reglas::GradoReglas{
+            elemento->valorSuperiorAtaque(),
+            static_cast<int16_t>(elemento->porcentajeDano())});
     }
 
     ActorPersonaje *SistemaAtaque::atacante() const
@@ -144,7 +147,7 @@ namespace tapete
     void SistemaAtaque::calcula(
         ActorPersonaje *atacante,
         Habilidad *habilidad,
-        std::vector<ActorPersonaje *> lista_oponentes,
+        const std::vector<ActorPersonaje *> &lista_oponentes,
         int aleatorio_100)
     {
         assert(habilidad->tipoEnfoque() == EnfoqueHabilidad::area);
@@ -157,17 +160,19 @@ namespace tapete
         this->atacante_ = atacante;
         this->habilidad_ = habilidad;
 
-        ataques_oponente.clear();
-        curaciones_oponente.clear();
-        cambios_efecto.clear();
-
-        for (ActorPersonaje *oponente : lista_oponentes)
+        // una sola pasada por los oponentes; los registros conservan su capacidad entre cálculos
+        if (habilidad_->antagonista() == Antagonista::oponente)
         {
-            if (habilidad_->antagonista() == Antagonista::oponente)
+            ataques_oponente.reserve(lista_oponentes.size());
+            for (ActorPersonaje *oponente : lista_oponentes)
             {
                 calculaAtaque(oponente, aleatorio_100);
             }
-            else
+        }
+        else
+        {
+            curaciones_oponente.reserve(lista_oponentes.size());
+            for (ActorPersonaje *oponente : lista_oponentes)
             {
                 calculaCuracion(oponente);
             }
@@ -188,27 +193,65 @@ namespace tapete
         assert(habilidad_->antagonista() == Antagonista::oponente);
 
         AtaqueOponente registro{};
+        preparaAtaque(atacante_, habilidad_, oponente, registro);
+
+        // el cálculo numérico es el de las reglas sin interfaz, para que el juego y las
+        // simulaciones den los mismos resultados
+        reglas::AtaqueReglas ataque{};
+        reglas::ReglasJuego::resuelveAtaque(
+            grados_reglas.data(), static_cast<int>(grados_reglas.size()),
+            registro.valor_ataque, registro.valor_defensa, aleatorio_100,
+            registro.valor_dano, registro.valor_reduce_dano,
+            oponente->vitalidad(), ataque);
+
+        registro.ventaja = ataque.ventaja;
+        registro.aleatorio_100 = ataque.aleatorio_100;
+        registro.valor_final_ataque = ataque.valor_final_ataque;
+        if (ataque.grado >= 0)
+        {
+            registro.efectividad = grados_efectividad[ataque.grado];
+            registro.porciento_dano = ataque.porciento_dano;
+        }
+        registro.valor_ajustado_dano = ataque.valor_ajustado_dano;
+        registro.valor_final_dano = ataque.valor_final_dano;
+
+        registro.vitalidad_origen = ataque.vitalidad_origen;
+        registro.vitalidad_final = ataque.vitalidad_final;
+        if (registro.vitalidad_origen > 0)
+        {
+            oponente->ponVitalidad(registro.vitalidad_final);
+        }
+
+        ataques_oponente.push_back(registro);
+    }
+
+    void SistemaAtaque::preparaAtaque(
+        ActorPersonaje *atacante,
+        Habilidad *habilidad,
+        ActorPersonaje *oponente,
+        AtaqueOponente &registro) const
+    {
         registro.oponente = oponente;
 
-        registro.tipo_ataque = habilidad_->tipoAtaque();
+        registro.tipo_ataque = habilidad->tipoAtaque();
 
         if (registro.tipo_ataque == nullptr)
         {
             throw std::logic_error{"Sistema de ataque mal configurado, aplicando ataque: tipo de ataque no establecido en la habilidad"};
         }
 
-        if (!atacante_->apareceAtaque(registro.tipo_ataque))
+        if (!atacante->apareceAtaque(registro.tipo_ataque))
         {
             throw std::logic_error{"Sistema de ataque mal configurado, aplicando ataque: tipo de ataque no admitido por el atacante"};
         }
-        registro.valor_ataque = atacante_->valorAtaque(registro.tipo_ataque);
+        registro.valor_ataque = atacante->valorAtaque(registro.tipo_ataque);
 
         if (registro.valor_ataque <= 0 || ActorPersonaje::maximaVitalidad < registro.valor_ataque)
         {
             throw std::logic_error{"Sistema de ataque mal configurado, aplicando ataque: valor de ataque inválido"};
         }
 
-        registro.tipo_defensa = habilidad_->tipoDefensa();
+        registro.tipo_defensa = habilidad->tipoDefensa();
 
         if (registro.tipo_defensa == nullptr)
         {
@@ -226,38 +269,23 @@ namespace tapete
             throw std::logic_error{"Sistema de ataque mal configurado, aplicando ataque: valor de defensa inválido"};
         }
 
-        registro.ventaja = registro.valor_ataque - registro.valor_defensa;
-        registro.aleatorio_100 = aleatorio_100;
-        registro.valor_final_ataque = registro.ventaja + registro.aleatorio_100;
-
         if (grados_efectividad.size() == 0)
         {
             throw std::logic_error{"Sistema de ataque mal configurado: grados de efectividad no configurados"};
         }
 
-        for (GradoEfectividad *efectividad : grados_efectividad)
-        {
-            if (registro.valor_final_ataque <= efectividad->valorSuperiorAtaque())
-            {
-                registro.efectividad = efectividad;
-                registro.porciento_dano = efectividad->porcentajeDano();
-                break;
-            }
-        }
-
-        registro.tipo_dano = habilidad_->tipoDano();
+        registro.tipo_dano = habilidad->tipoDano();
 
         if (registro.tipo_dano == nullptr)
         {
             throw std::logic_error{"Sistema de ataque mal configurado, aplicando ataque: tipo de daño no establecido en la habilidad"};
         }
-        registro.valor_dano = habilidad_->valorDano();
+        registro.valor_dano = habilidad->valorDano();
 
         if (registro.valor_dano <= 0 || ActorPersonaje::maximaVitalidad < registro.valor_dano)
         {
             throw std::logic_error{"Sistema de ataque mal configurado, aplicando ataque: valor de daño inválido"};
         }
-        registro.valor_ajustado_dano = (int)(registro.valor_dano * (((float)registro.porciento_dano) / 100.0f));
 
         if (!oponente->apareceReduceDano(registro.tipo_dano))
         {
@@ -269,25 +297,76 @@ namespace tapete
         {
             throw std::logic_error{"Sistema de ataque mal configurado, aplicando ataque: valor de reducción de daño inválido"};
         }
-        registro.valor_final_dano = registro.valor_ajustado_dano - registro.valor_reduce_dano;
+    }
+
+    SistemaAtaque::PronosticoAtaque SistemaAtaque::pronostica(
+        ActorPersonaje *atacante,
+        Habilidad *habilidad,
+        ActorPersonaje *oponente) const
+    {
+        assert(habilidad->antagonista() == Antagonista::oponente);
 
+        AtaqueOponente registro{};
+        preparaAtaque(atacante, habilidad, oponente, registro);
         registro.vitalidad_origen = oponente->vitalidad();
-        registro.vitalidad_final = oponente->vitalidad();
-        if (registro.vitalidad_final > 0)
+        return pronosticaRegistro(registro, habilidad);
+    }
+
+    SistemaAtaque::PronosticoAtaque SistemaAtaque::pronostica(const AtaqueOponente &registro) const
+    {
+        assert(habilidad_ != nullptr);
+
+        return pronosticaRegistro(registro, habilidad_);
+    }
+
+    SistemaAtaque::PronosticoAtaque SistemaAtaque::pronosticaRegistro(
+        const AtaqueOponente &registro, Habilidad *habilidad) const
+    {
+        PronosticoAtaque pronostico{};
+        pronostico.oponente = registro.oponente;
+        pronostico.probabilidad_efectividad.assign(grados_efectividad.size(), 0.0f);
+
+        // como en ModoJuegoBase::atacaOponente, el ataque a un oponente con coste 1 no sortea: usa 100
+        if (habilidad->tipoEnfoque() == EnfoqueHabilidad::personaje && habilidad->coste() == 1)
         {
-            registro.vitalidad_final -= registro.valor_final_dano;
-            if (registro.vitalidad_final < 0)
+            reglas::AtaqueReglas ataque{};
+            reglas::ReglasJuego::resuelveAtaque(
+                grados_reglas.data(), static_cast<int>(grados_reglas.size()),
+                registro.valor_ataque, registro.valor_defensa, 100,
+                registro.valor_dano, registro.valor_reduce_dano,
+                registro.vitalidad_origen, ataque);
+
+            pronostico.ventaja = ataque.ventaja;
+            if (ataque.grado >= 0)
             {
-                registro.vitalidad_final = 0;
+                pronostico.probabilidad_efectividad[ataque.grado] = 1.0f;
             }
-            if (registro.vitalidad_final > ActorPersonaje::maximaVitalidad)
+            else
             {
-                registro.vitalidad_final = ActorPersonaje::maximaVitalidad;
+                pronostico.probabilidad_fallo = 1.0f;
             }
-            oponente->ponVitalidad(registro.vitalidad_final);
+            pronostico.dano_esperado = static_cast<float>(ataque.vitalidad_origen - ataque.vitalidad_final);
+            pronostico.probabilidad_derriba =
+                (ataque.vitalidad_origen > 0 && ataque.vitalidad_final == 0) ? 1.0f : 0.0f;
+            return pronostico;
         }
 
-        ataques_oponente.push_back(registro);
+        reglas::DistribucionAtaque distribucion{};
+        reglas::ReglasJuego::distribuyeAtaque(
+            grados_reglas.data(), static_cast<int>(grados_reglas.size()),
+            registro.valor_ataque, registro.valor_defensa,
+            registro.valor_dano, registro.valor_reduce_dano,
+            registro.vitalidad_origen, distribucion);
+
+        pronostico.ventaja = distribucion.ventaja;
+        for (size_t indc = 0; indc < pronostico.probabilidad_efectividad.size(); ++indc)
+        {
+            pronostico.probabilidad_efectividad[indc] = distribucion.probabilidad_grado[indc];
+        }
+        pronostico.probabilidad_fallo = distribucion.probabilidad_fallo;
+        pronostico.dano_esperado = distribucion.dano_esperado;
+        pronostico.probabilidad_derriba = distribucion.probabilidad_derriba;
+        return pronostico;
     }
 
     void SistemaAtaque::calculaCuracion(ActorPersonaje *oponente)
@@ -305,18 +384,10 @@ namespace tapete
         registro.valor_curacion = habilidad_->valorCuracion();
 
         registro.vitalidad_origen = oponente->vitalidad();
-        registro.vitalidad_final = oponente->vitalidad();
-        if (registro.vitalidad_final > 0)
+        registro.vitalidad_final = reglas::ReglasJuego::resuelveCuracion(
+            registro.vitalidad_origen, registro.valor_curacion);
+        if (registro.vitalidad_origen > 0)
         {
-            registro.vitalidad_final += registro.valor_curacion;
-            if (registro.vitalidad_final < 0)
-            {
-                registro.vitalidad_final = 0;
-            }
-            if (registro.vitalidad_final > ActorPersonaje::maximaVitalidad)
-            {
-                registro.vitalidad_final = ActorPersonaje::maximaVitalidad;
-            }
             oponente->ponVitalidad(registro.vitalidad_final);
         }
 
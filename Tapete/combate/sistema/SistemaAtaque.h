@@ -115,6 +115,42 @@ namespace tapete
          */
         const std::vector<CambioEfecto> &cambiosEfecto() const;
 
+        /*!
+         * \struct PronosticoAtaque
+         * \brief Resultado esperado de un ataque a un oponente, sin sortear el valor aleatorio.
+         */
+        struct PronosticoAtaque
+        {
+            ActorPersonaje *oponente;
+            int ventaja;
+            std::vector<float> probabilidad_efectividad; ///< una por grado, en el orden de efectividades()
+            float probabilidad_fallo;                    ///< ningún grado admite el ataque final
+            float dano_esperado;
+            float probabilidad_derriba;                  ///< el oponente queda sin vitalidad
+        };
+
+        /*!
+         * \brief Pronostica un ataque a un oponente sin aplicarlo.
+         *
+         * Recorre los tramos del valor aleatorio que dan cada grado de efectividad en lugar de
+         * sortearlo, así que el coste no depende del número de tiradas.
+         * \param atacante Puntero al personaje atacante.
+         * \param habilidad Puntero a la habilidad de ataque.
+         * \param oponente Puntero al oponente, con su vitalidad actual.
+         * \return Pronóstico del ataque.
+         */
+        PronosticoAtaque pronostica(
+            ActorPersonaje *atacante,
+            Habilidad *habilidad,
+            ActorPersonaje *oponente) const;
+
+        /*!
+         * \brief Pronostica un ataque ya calculado, con la vitalidad que tenía el oponente antes.
+         * \param registro Registro del último cálculo.
+         * \return Pronóstico del ataque.
+         */
+        PronosticoAtaque pronostica(const AtaqueOponente &registro) const;
+
         /*!
          * \brief Calcula ataques, curaciones y efectos para múltiples oponentes.
          * \param atacante Puntero al personaje atacante.
@@ -147,12 +183,13 @@ namespace tapete
         void calcula(
             ActorPersonaje *atacante,
             Habilidad *habilidad,
-            std::vector<ActorPersonaje *> lista_oponentes,
+            const std::vector<ActorPersonaje *> &lista_oponentes,
             int aleatorio_100);
 
     private:
         JuegoMesaBase *juego{};
         std::vector<GradoEfectividad *> grados_efectividad{};
+        std::vector<reglas::GradoReglas> grados_reglas{};
 
         ActorPersonaje *atacante_{};
         Habilidad *habilidad_{};
@@ -173,6 +210,27 @@ namespace tapete
          */
         void calculaAtaque(ActorPersonaje *oponente, int aleatorio_100);
 
+        /*!
+         * \brief Comprueba la configuración de un ataque y anota sus valores de ataque, defensa y daño.
+         * \param atacante Puntero al personaje atacante.
+         * \param habilidad Puntero a la habilidad utilizada.
+         * \param oponente Puntero al oponente.
+         * \param registro Registro en el que se anotan los valores.
+         */
+        void preparaAtaque(
+            ActorPersonaje *atacante,
+            Habilidad *habilidad,
+            ActorPersonaje *oponente,
+            AtaqueOponente &registro) const;
+
+        /*!
+         * \brief Calcula el pronóstico de los valores anotados en un registro.
+         * \param registro Registro con los valores del ataque y la vitalidad de origen.
+         * \param habilidad Puntero a la habilidad utilizada.
+         * \return Pronóstico del ataque.
+         */
+        PronosticoAtaque pronosticaRegistro(const AtaqueOponente &registro, Habilidad *habilidad) const;
+
         /*!
          * \brief Calcula los detalles de una curación para un oponente dado.
          * \param oponente Puntero al oponente.
@@ -0,0 +1,81 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   TablaEstadisticas.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete
+{
+
+    bool TablaEstadisticas::aparece(Clase clase, int personaje, int tipo) const
+    {
+        if (personaje < 0 || personaje >= maximoPersonajes || tipo < 0 || tipo >= maximoTipos)
+        {
+            return false;
+        }
+        return (datos_.aparece[static_cast<int>(clase)][tipo] >> personaje) & 1u;
+    }
+
+    int TablaEstadisticas::valor(Clase clase, int personaje, int tipo) const
+    {
+        compruebaRegistro(clase, personaje, tipo);
+        int indc_clase = static_cast<int>(clase);
+        return datos_.inicial[indc_clase][tipo][personaje] + datos_.cambio[indc_clase][tipo][personaje];
+    }
+
+    int TablaEstadisticas::inicial(Clase clase, int personaje, int tipo) const
+    {
+        compruebaRegistro(clase, personaje, tipo);
+        return datos_.inicial[static_cast<int>(clase)][tipo][personaje];
+    }
+
+    int TablaEstadisticas::cambio(Clase clase, int personaje, int tipo) const
+    {
+        compruebaRegistro(clase, personaje, tipo);
+        return datos_.cambio[static_cast<int>(clase)][tipo][personaje];
+    }
+
+    void TablaEstadisticas::agrega(Clase clase, int personaje, int tipo, int valor_inicial)
+    {
+        aserta(personaje >= 0 && personaje < maximoPersonajes, "índice de personaje fuera de la tabla de estadísticas");
+        aserta(tipo >= 0 && tipo < maximoTipos, "índice de tipo fuera de la tabla de estadísticas");
+        aserta(valor_inicial >= INT16_MIN && valor_inicial <= INT16_MAX, "valor inicial de estadística inválido");
+        int indc_clase = static_cast<int>(clase);
+        datos_.inicial[indc_clase][tipo][personaje] = static_cast<int16_t>(valor_inicial);
+        datos_.cambio[indc_clase][tipo][personaje] = 0;
+        datos_.aparece[indc_clase][tipo] |= 1u << personaje;
+    }
+
+    void TablaEstadisticas::ponCambio(Clase clase, int personaje, int tipo, int valor_cambio)
+    {
+        compruebaRegistro(clase, personaje, tipo);
+        aserta(valor_cambio >= INT16_MIN && valor_cambio <= INT16_MAX, "cambio de estadística inválido");
+        datos_.cambio[static_cast<int>(clase)][tipo][personaje] = static_cast<int16_t>(valor_cambio);
+    }
+
+    const TablaEstadisticas::Datos &TablaEstadisticas::datos() const
+    {
+        return datos_;
+    }
+
+    void TablaEstadisticas::restaura(const Datos &datos)
+    {
+        std::memcpy(&datos_, &datos, sizeof(Datos));
+    }
+
+    void TablaEstadisticas::compruebaRegistro(Clase clase, int personaje, int tipo) const
+    {
+        // como el std::map::at de antes, consultar una estadística no registrada es un error
+        aserta(aparece(clase, personaje, tipo), "estadística no registrada para el personaje");
+    }
+
+    void TablaEstadisticas::aserta(bool expresion, const string &mensaje)
+    {
+        if (expresion)
+        {
+            return;
+        }
+        throw std::logic_error(mensaje);
+    }
+
+}
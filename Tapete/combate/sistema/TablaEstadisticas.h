@@ -0,0 +1,118 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  TablaEstadisticas.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+namespace tapete
+{
+
+    /*
+     * \class TablaEstadisticas
+     * \brief Valores de ataque, defensa y reducción de daño de todos los personajes.
+     *
+     * Sustituye a los mapas por puntero de tipo que tenía cada personaje: los valores se guardan en
+     * arrays indexados por clase de estadística, índice del tipo e índice del personaje, así que cada
+     * consulta es de tiempo constante. Los valores de un mismo tipo de todo el elenco están
+     * contiguos, y todo el contenido es trivialmente copiable, para guardarlo y restaurarlo de una vez.
+     */
+    class TablaEstadisticas
+    {
+    public:
+        static constexpr int maximoPersonajes = reglas::maximoPersonajes;
+        static constexpr int maximoTipos = reglas::maximoEstadisticas;
+
+        enum class Clase : uint8_t
+        {
+            ataque,
+            defensa,
+            reduceDano
+        };
+        static constexpr int cuentaClases = 3;
+
+        template <typename T>
+        using PorPersonaje = std::array<std::array<std::array<T, maximoPersonajes>, maximoTipos>, cuentaClases>;
+
+        /*!
+         * \struct Datos
+         * \brief Contenido de la tabla; el valor efectivo es el inicial más el cambio.
+         */
+        struct Datos
+        {
+            PorPersonaje<int16_t> inicial;
+            PorPersonaje<int16_t> cambio;
+            std::array<std::array<uint32_t, maximoTipos>, cuentaClases> aparece; ///< un bit por personaje
+        };
+        static_assert(std::is_trivially_copyable_v<Datos>);
+        static_assert(maximoPersonajes <= 32);
+
+        /*!
+         * \brief Comprueba si un personaje tiene registrada una estadística.
+         * \param clase Clase de la estadística.
+         * \param personaje Índice del personaje.
+         * \param tipo Índice del tipo de estadística.
+         */
+        bool aparece(Clase clase, int personaje, int tipo) const;
+
+        /*!
+         * \brief Devuelve el valor efectivo de una estadística: el inicial más el cambio.
+         * \param clase Clase de la estadística.
+         * \param personaje Índice del personaje.
+         * \param tipo Índice del tipo de estadística.
+         */
+        int valor(Clase clase, int personaje, int tipo) const;
+
+        /*!
+         * \brief Devuelve el valor inicial de una estadística.
+         * \param clase Clase de la estadística.
+         * \param personaje Índice del personaje.
+         * \param tipo Índice del tipo de estadística.
+         */
+        int inicial(Clase clase, int personaje, int tipo) const;
+
+        /*!
+         * \brief Devuelve el cambio aplicado a una estadística.
+         * \param clase Clase de la estadística.
+         * \param personaje Índice del personaje.
+         * \param tipo Índice del tipo de estadística.
+         */
+        int cambio(Clase clase, int personaje, int tipo) const;
+
+        /*!
+         * \brief Registra una estadística de un personaje, sin cambio.
+         * \param clase Clase de la estadística.
+         * \param personaje Índice del personaje.
+         * \param tipo Índice del tipo de estadística.
+         * \param valor_inicial Valor inicial.
+         */
+        void agrega(Clase clase, int personaje, int tipo, int valor_inicial);
+
+        /*!
+         * \brief Establece el cambio de una estadística registrada.
+         * \param clase Clase de la estadística.
+         * \param personaje Índice del personaje.
+         * \param tipo Índice del tipo de estadística.
+         * \param valor_cambio Cambio sobre el valor inicial.
+         */
+        void ponCambio(Clase clase, int personaje, int tipo, int valor_cambio);
+
+        /*!
+         * \brief Devuelve el contenido de la tabla.
+         */
+        const Datos &datos() const;
+
+        /*!
+         * \brief Sustituye el contenido de la tabla por uno guardado antes.
+         * \param datos Contenido guardado.
+         */
+        void restaura(const Datos &datos);
+
+    private:
+        Datos datos_{};
+
+        void compruebaRegistro(Clase clase, int personaje, int tipo) const;
+
+        static void aserta(bool expresion, const string &mensaje);
+    };
+
+}
@@ -0,0 +1,100 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   AlmacenTexturas.cpp
+// versión:  2.1  (Abril-2025)
+
+#include <filesystem>
+
+#include "tapete.h"
+
+namespace tapete
+{
+
+    AlmacenTexturas::~AlmacenTexturas()
+    {
+        for (auto &[archivo, entrada] : entradas)
+        {
+            delete entrada.textura;
+        }
+        entradas.clear();
+    }
+
+    unir2d::Textura *AlmacenTexturas::toma(const string &archivo)
+    {
+        auto encontrada = entradas.find(archivo);
+        if (encontrada != entradas.end())
+        {
+            Entrada &entrada = encontrada->second;
+            ++entrada.usuarios;
+            ++aciertos_;
+            bytes_ahorrados += entrada.bytes;
+            return entrada.textura;
+        }
+
+        unir2d::Textura *textura = new unir2d::Textura{};
+        textura->carga(archivo);
+        std::error_code error;
+        uintmax_t bytes = std::filesystem::file_size(archivo, error);
+        if (error)
+        {
+            bytes = 0;
+        }
+        entradas.emplace(archivo, Entrada{textura, 1, bytes});
+        ++fallos_;
+        return textura;
+    }
+
+    void AlmacenTexturas::suelta(unir2d::Textura *&textura)
+    {
+        if (textura == nullptr)
+        {
+            return;
+        }
+        auto encontrada = std::find_if(entradas.begin(), entradas.end(),
+                                       [textura](const auto &par) { return par.second.textura == textura; });
+        aserta(encontrada != entradas.end(), "la textura no es del almacén");
+        Entrada &entrada = encontrada->second;
+        if (--entrada.usuarios == 0)
+        {
+            aserta(textura->cuentaUsos() == 0, "recursos cautivos");
+            delete entrada.textura;
+            entradas.erase(encontrada);
+        }
+        textura = nullptr;
+    }
+
+    int AlmacenTexturas::cuentaTexturas() const
+    {
+        return static_cast<int>(entradas.size());
+    }
+
+    int AlmacenTexturas::aciertos() const
+    {
+        return aciertos_;
+    }
+
+    int AlmacenTexturas::fallos() const
+    {
+        return fallos_;
+    }
+
+    uintmax_t AlmacenTexturas::bytesAhorrados() const
+    {
+        return bytes_ahorrados;
+    }
+
+    void AlmacenTexturas::informa(std::ostream &salida) const
+    {
+        salida << "Texturas: " << aciertos_ << " aciertos, " << fallos_ << " fallos, "
+               << bytes_ahorrados << " bytes ahorrados" << std::endl;
+    }
+
+    void AlmacenTexturas::aserta(bool expresion, const string &mensaje)
+    {
+        if (expresion)
+        {
+            return;
+        }
+        throw std::logic_error(mensaje);
+    }
+
+}
@@ -0,0 +1,95 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  AlmacenTexturas.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+namespace tapete
+{
+
+    /*
+     * \class AlmacenTexturas
+     * \brief Texturas cargadas desde archivo y compartidas por todas las presencias que las usan.
+     *
+     * Cada archivo se carga una sola vez: toma devuelve la textura ya cargada si existe, y la cuenta
+     * de usuarios del archivo sube; suelta la baja, y la textura se borra cuando la suelta el último.
+     * Antes de borrarla se comprueba que ninguna imagen la sigue usando.
+     *
+     * Los sonidos no se comparten: unir2d::Sonido guarda su volumen y su estado de reproducción, y
+     * cada presencia los ajusta por su cuenta.
+     *
+     * Para el informe se cuentan los aciertos (archivos ya cargados), los fallos (archivos cargados)
+     * y los bytes de disco que no se han leído gracias a los aciertos.
+     */
+    class AlmacenTexturas
+    {
+    public:
+        /*!
+         * \brief Constructor.
+         */
+        AlmacenTexturas() = default;
+
+        /*!
+         * \brief Destructor: borra las texturas que no se han soltado.
+         */
+        ~AlmacenTexturas();
+
+        AlmacenTexturas(const AlmacenTexturas &) = delete;
+        AlmacenTexturas &operator=(const AlmacenTexturas &) = delete;
+
+        /*!
+         * \brief Devuelve la textura de un archivo, cargándola si nadie la usa todavía.
+         * \param archivo Ruta del archivo.
+         * \return Textura compartida; hay que devolverla con suelta.
+         */
+        unir2d::Textura *toma(const string &archivo);
+
+        /*!
+         * \brief Devuelve una textura obtenida con toma y la borra si era el último usuario.
+         * \param textura Textura que se suelta; queda a nulo. Si ya es nulo, no hace nada.
+         */
+        void suelta(unir2d::Textura *&textura);
+
+        /*!
+         * \brief Devuelve el número de texturas cargadas.
+         */
+        int cuentaTexturas() const;
+
+        /*!
+         * \brief Devuelve las veces que toma ha encontrado la textura ya cargada.
+         */
+        int aciertos() const;
+
+        /*!
+         * \brief Devuelve las veces que toma ha tenido que cargar la textura.
+         */
+        int fallos() const;
+
+        /*!
+         * \brief Devuelve los bytes de archivo que no se han leído gracias a los aciertos.
+         */
+        uintmax_t bytesAhorrados() const;
+
+        /*!
+         * \brief Escribe los aciertos, los fallos y los bytes ahorrados.
+         * \param salida Flujo de salida.
+         */
+        void informa(std::ostream &salida) const;
+
+    private:
+        struct Entrada
+        {
+            unir2d::Textura *textura;
+            int usuarios;
+            uintmax_t bytes;
+        };
+
+        std::unordered_map<string, Entrada> entradas{};
+        int aciertos_{};
+        int fallos_{};
+        uintmax_t bytes_ahorrados{};
+
+        static void aserta(bool expresion, const string &mensaje);
+    };
+
+}
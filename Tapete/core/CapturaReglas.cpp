@@ -0,0 +1,344 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   CapturaReglas.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete
+{
+
+    void CapturaReglas::capturaCatalogo(JuegoMesaBase *juego, reglas::CatalogoReglas &catalogo)
+    {
+        aserta(juego->personajes().size() <= reglas::maximoPersonajes, "demasiados personajes para las reglas");
+        aserta(juego->habilidades().size() <= reglas::maximoHabilidades, "demasiadas habilidades para las reglas");
+        aserta(juego->ataques().size() <= reglas::maximoEstadisticas &&
+                   juego->defensas().size() <= reglas::maximoEstadisticas &&
+                   juego->danos().size() <= reglas::maximoEstadisticas,
+               "demasiados tipos de estadística para las reglas");
+        aserta(juego->sistemaAtaque().efectividades().size() <= reglas::maximoGrados,
+               "demasiados grados de efectividad para las reglas");
+
+        catalogo = reglas::CatalogoReglas{};
+        catalogo.puntos_accion_de_desplaza = juego->modo()->puntosAccionDeDesplaza();
+
+        catalogo.cuenta_habilidades = static_cast<int>(juego->habilidades().size());
+        for (Habilidad *habilidad : juego->habilidades())
+        {
+            capturaHabilidad(habilidad, catalogo.habilidades[habilidad->indice()]);
+        }
+
+        catalogo.cuenta_grados = static_cast<int>(juego->sistemaAtaque().efectividades().size());
+        for (int indc = 0; indc < catalogo.cuenta_grados; ++indc)
+        {
+            GradoEfectividad *grado = juego->sistemaAtaque().efectividades()[indc];
+            catalogo.grados[indc].valor_superior = grado->valorSuperiorAtaque();
+            catalogo.grados[indc].porciento_dano = static_cast<int16_t>(grado->porcentajeDano());
+        }
+
+        catalogo.cuenta_personajes = static_cast<int>(juego->personajes().size());
+        for (ActorPersonaje *persj : juego->personajes())
+        {
+            capturaFicha(persj, catalogo.fichas[persj->indice()]);
+        }
+    }
+
+    void CapturaReglas::capturaEstado(JuegoMesaBase *juego, reglas::EstadoReglas &estado)
+    {
+        aserta(juego->personajes().size() <= reglas::maximoPersonajes, "demasiados personajes para las reglas");
+
+        estado.cuenta_personajes = static_cast<int>(juego->personajes().size());
+        estado.tablero.vacia();
+        for (Coord muro : juego->tablero()->sitiosMuros())
+        {
+            estado.tablero.ponMuro(celda(muro));
+        }
+        const TablaEstadisticas &tabla = juego->estadisticas();
+        for (ActorPersonaje *persj : juego->personajes())
+        {
+            reglas::PersonajeReglas &registro = estado.personajes[persj->indice()];
+            registro = reglas::PersonajeReglas{};
+            registro.sitio = celda(persj->sitioFicha());
+            registro.vitalidad = static_cast<int16_t>(persj->vitalidad());
+            registro.puntos_accion = static_cast<int8_t>(persj->puntosAccion());
+            for (int tipo = 0; tipo < TablaEstadisticas::maximoTipos; ++tipo)
+            {
+                if (tabla.aparece(TablaEstadisticas::Clase::ataque, persj->indice(), tipo))
+                {
+                    registro.cambio_ataque[tipo] = static_cast<int16_t>(
+                        tabla.cambio(TablaEstadisticas::Clase::ataque, persj->indice(), tipo));
+                }
+                if (tabla.aparece(TablaEstadisticas::Clase::defensa, persj->indice(), tipo))
+                {
+                    registro.cambio_defensa[tipo] = static_cast<int16_t>(
+                        tabla.cambio(TablaEstadisticas::Clase::defensa, persj->indice(), tipo));
+                }
+            }
+            estado.tablero.mueveFicha(reglas::CeldaReglas{0, 0}, registro.sitio);
+        }
+    }
+
+    reglas::CeldaReglas CapturaReglas::celda(Coord coord)
+    {
+        return reglas::CeldaReglas{
+            static_cast<int16_t>(coord.fila()),
+            static_cast<int16_t>(coord.coln())};
+    }
+
+    Coord CapturaReglas::coord(reglas::CeldaReglas celda)
+    {
+        return Coord{celda.fila, celda.coln};
+    }
+
+    void CapturaReglas::capturaHabilidad(Habilidad *habilidad, reglas::HabilidadReglas &registro)
+    {
+        aserta(habilidad->efectosAtaque().size() <= reglas::maximoEfectos &&
+                   habilidad->efectosDefensa().size() <= reglas::maximoEfectos,
+               "demasiados efectos de habilidad para las reglas");
+
+        // los enumerados de las reglas siguen el mismo orden que los del tapete
+        registro = reglas::HabilidadReglas{};
+        registro.enfoque = static_cast<reglas::EnfoqueReglas>(habilidad->tipoEnfoque());
+        registro.acceso = static_cast<reglas::AccesoReglas>(habilidad->tipoAcceso());
+        registro.antagonista = static_cast<reglas::AntagonistaReglas>(habilidad->antagonista());
+        registro.coste = static_cast<int8_t>(habilidad->coste());
+        registro.alcance = static_cast<int8_t>(habilidad->alcance());
+        registro.radio = static_cast<int8_t>(habilidad->radioAlcance());
+        registro.ataque = habilidad->tipoAtaque() == nullptr
+                              ? reglas::sinEstadistica
+                              : static_cast<int8_t>(habilidad->tipoAtaque()->indice());
+        registro.defensa = habilidad->tipoDefensa() == nullptr
+                               ? reglas::sinEstadistica
+                               : static_cast<int8_t>(habilidad->tipoDefensa()->indice());
+        registro.dano = habilidad->tipoDano() == nullptr
+                            ? reglas::sinEstadistica
+                            : static_cast<int8_t>(habilidad->tipoDano()->indice());
+        registro.valor_dano = static_cast<int16_t>(habilidad->valorDano());
+        registro.valor_curacion = static_cast<int16_t>(habilidad->valorCuracion());
+
+        for (const std::pair<TipoAtaque *, int> &pareja : habilidad->efectosAtaque())
+        {
+            reglas::EfectoReglas &efecto = registro.efectos_ataque[registro.cuenta_efectos_ataque++];
+            efecto.estadistica = static_cast<int8_t>(pareja.first->indice());
+            efecto.valor = static_cast<int16_t>(pareja.second);
+        }
+        for (const std::pair<TipoDefensa *, int> &pareja : habilidad->efectosDefensa())
+        {
+            reglas::EfectoReglas &efecto = registro.efectos_defensa[registro.cuenta_efectos_defensa++];
+            efecto.estadistica = static_cast<int8_t>(pareja.first->indice());
+            efecto.valor = static_cast<int16_t>(pareja.second);
+        }
+    }
+
+    void CapturaReglas::capturaFicha(ActorPersonaje *personaje, reglas::FichaReglas &ficha)
+    {
+        aserta(personaje->habilidades().size() <= reglas::maximoHabilidadesFicha,
+               "demasiadas habilidades de personaje para las reglas");
+
+        ficha = reglas::FichaReglas{};
+        ficha.lado = personaje->ladoTablero() == LadoTablero::Izquierda
+                         ? reglas::LadoReglas::izquierda
+                         : reglas::LadoReglas::derecha;
+        ficha.iniciativa = static_cast<int8_t>(personaje->iniciativa());
+        ficha.puntos_accion_ronda = static_cast<int8_t>(ModoJuegoBase::puntosAccionRonda(personaje));
+
+        for (Habilidad *habilidad : personaje->habilidades())
+        {
+            ficha.habilidades[ficha.cuenta_habilidades++] = static_cast<int8_t>(habilidad->indice());
+        }
+        const TablaEstadisticas &tabla = personaje->juego()->estadisticas();
+        int indice = personaje->indice();
+        for (int tipo = 0; tipo < TablaEstadisticas::maximoTipos; ++tipo)
+        {
+            if (tabla.aparece(TablaEstadisticas::Clase::ataque, indice, tipo))
+            {
+                ficha.con_ataque |= 1u << tipo;
+                ficha.ataque[tipo] = static_cast<int16_t>(tabla.inicial(TablaEstadisticas::Clase::ataque, indice, tipo));
+            }
+            if (tabla.aparece(TablaEstadisticas::Clase::defensa, indice, tipo))
+            {
+                ficha.con_defensa |= 1u << tipo;
+                ficha.defensa[tipo] = static_cast<int16_t>(tabla.inicial(TablaEstadisticas::Clase::defensa, indice, tipo));
+            }
+            if (tabla.aparece(TablaEstadisticas::Clase::reduceDano, indice, tipo))
+            {
+                ficha.con_reduce_dano |= 1u << tipo;
+                ficha.reduce_dano[tipo] = static_cast<int16_t>(tabla.inicial(TablaEstadisticas::Clase::reduceDano, indice, tipo));
+            }
+        }
+    }
+
+    void CapturaReglas::escribeElenco(JuegoMesaBase *juego, std::ostream &salida)
+    {
+        reglas::CatalogoReglas catalogo;
+        capturaCatalogo(juego, catalogo);
+
+        static const char *enfoques[]{"si_mismo", "personaje", "area"};
+        static const char *accesos[]{"ninguno", "directo", "indirecto"};
+        static const char *antagonistas[]{"oponente", "aliado", "si_mismo"};
+        std::vector<string> ataques{};
+        std::vector<string> defensas{};
+        std::vector<string> danos{};
+        for (TipoAtaque *tipo : juego->ataques())
+            ataques.push_back(palabraElenco(tipo->nombre()));
+        for (TipoDefensa *tipo : juego->defensas())
+            defensas.push_back(palabraElenco(tipo->nombre()));
+        for (TipoDano *tipo : juego->danos())
+            danos.push_back(palabraElenco(tipo->nombre()));
+
+        salida << "# elenco escrito por el juego con la opción --elenco (CapturaReglas::escribeElenco)\n\n";
+        salida << "lado izquierda " << palabraElenco(juego->tablero()->nombreEquipo(LadoTablero::Izquierda)) << "\n";
+        salida << "lado derecha " << palabraElenco(juego->tablero()->nombreEquipo(LadoTablero::Derecha)) << "\n\n";
+        salida << "desplaza " << catalogo.puntos_accion_de_desplaza << "\n\n";
+
+        for (const string &nombre : ataques)
+            salida << "ataque " << nombre << "\n";
+        for (const string &nombre : defensas)
+            salida << "defensa " << nombre << "\n";
+        for (const string &nombre : danos)
+            salida << "dano " << nombre << "\n";
+        salida << "\n";
+
+        for (int indc = 0; indc < catalogo.cuenta_grados; ++indc)
+        {
+            const reglas::GradoReglas &grado = catalogo.grados[indc];
+            salida << "grado " << palabraElenco(juego->sistemaAtaque().efectividades()[indc]->nombre()) << " ";
+            if (grado.valor_superior == INT_MAX)
+                salida << "max";
+            else
+                salida << grado.valor_superior;
+            salida << " " << grado.porciento_dano << "\n";
+        }
+        salida << "\n";
+
+        std::vector<string> habilidades{};
+        for (Habilidad *habilidad : juego->habilidades())
+            habilidades.push_back(palabraElenco(habilidad->nombre()));
+        for (int indc = 0; indc < catalogo.cuenta_habilidades; ++indc)
+        {
+            const reglas::HabilidadReglas &habilidad = catalogo.habilidades[indc];
+            salida << "habilidad " << habilidades[indc]
+                   << " " << enfoques[static_cast<int>(habilidad.enfoque)]
+                   << " " << accesos[static_cast<int>(habilidad.acceso)]
+                   << " " << antagonistas[static_cast<int>(habilidad.antagonista)]
+                   << " " << int{habilidad.coste} << " " << int{habilidad.alcance} << " " << int{habilidad.radio} << "\n";
+        }
+        salida << "\n";
+        for (int indc = 0; indc < catalogo.cuenta_habilidades; ++indc)
+        {
+            const reglas::HabilidadReglas &habilidad = catalogo.habilidades[indc];
+            if (habilidad.ataque != reglas::sinEstadistica)
+            {
+                aserta(habilidad.defensa != reglas::sinEstadistica && habilidad.dano != reglas::sinEstadistica,
+                       "habilidad de ataque sin defensa o sin daño");
+                salida << "ataca " << habilidades[indc] << " " << ataques[habilidad.ataque] << " "
+                       << defensas[habilidad.defensa] << " " << danos[habilidad.dano] << " "
+                       << habilidad.valor_dano << "\n";
+            }
+            if (habilidad.valor_curacion != 0)
+                salida << "cura " << habilidades[indc] << " " << habilidad.valor_curacion << "\n";
+            for (int efct = 0; efct < habilidad.cuenta_efectos_ataque; ++efct)
+                salida << "efecto " << habilidades[indc] << " ataque "
+                       << ataques[habilidad.efectos_ataque[efct].estadistica] << " "
+                       << habilidad.efectos_ataque[efct].valor << "\n";
+            for (int efct = 0; efct < habilidad.cuenta_efectos_defensa; ++efct)
+                salida << "efecto " << habilidades[indc] << " defensa "
+                       << defensas[habilidad.efectos_defensa[efct].estadistica] << " "
+                       << habilidad.efectos_defensa[efct].valor << "\n";
+        }
+        salida << "\n";
+
+        std::vector<string> personajes{};
+        for (ActorPersonaje *persj : juego->personajes())
+            personajes.push_back(palabraElenco(persj->nombre()));
+        for (ActorPersonaje *persj : juego->personajes())
+        {
+            const reglas::FichaReglas &ficha = catalogo.fichas[persj->indice()];
+            salida << "personaje " << personajes[persj->indice()]
+                   << (ficha.lado == reglas::LadoReglas::izquierda ? " izquierda " : " derecha ")
+                   << int{ficha.iniciativa} << " " << int{ficha.puntos_accion_ronda} << " "
+                   << persj->sitioFicha().fila() << " " << persj->sitioFicha().coln() << "\n";
+        }
+        salida << "\n";
+        for (int indc = 0; indc < catalogo.cuenta_personajes; ++indc)
+        {
+            const reglas::FichaReglas &ficha = catalogo.fichas[indc];
+            for (int tipo = 0; tipo < static_cast<int>(ataques.size()); ++tipo)
+                if ((ficha.con_ataque & (1u << tipo)) != 0)
+                    salida << "estadistica " << personajes[indc] << " ataque " << ataques[tipo] << " "
+                           << ficha.ataque[tipo] << "\n";
+            for (int tipo = 0; tipo < static_cast<int>(defensas.size()); ++tipo)
+                if ((ficha.con_defensa & (1u << tipo)) != 0)
+                    salida << "estadistica " << personajes[indc] << " defensa " << defensas[tipo] << " "
+                           << ficha.defensa[tipo] << "\n";
+            for (int tipo = 0; tipo < static_cast<int>(danos.size()); ++tipo)
+                if ((ficha.con_reduce_dano & (1u << tipo)) != 0)
+                    salida << "estadistica " << personajes[indc] << " reduce " << danos[tipo] << " "
+                           << ficha.reduce_dano[tipo] << "\n";
+        }
+        salida << "\n";
+        for (int indc = 0; indc < catalogo.cuenta_personajes; ++indc)
+        {
+            const reglas::FichaReglas &ficha = catalogo.fichas[indc];
+            salida << "usa " << personajes[indc];
+            for (int hblt = 0; hblt < ficha.cuenta_habilidades; ++hblt)
+                salida << " " << habilidades[ficha.habilidades[hblt]];
+            salida << "\n";
+        }
+        salida << "\n";
+
+        // los muros aleatorios se generan de nuevo en cada partida simulada
+        if (juego->murosAleatorios())
+        {
+            salida << "muros aleatorios\n";
+        }
+        else
+        {
+            for (Coord muro : juego->tablero()->sitiosMuros())
+                salida << "muro " << muro.fila() << " " << muro.coln() << "\n";
+        }
+        salida << "\n";
+        // el Simulador decide al azar si cada tesoro cura o daña, como el juego
+        for (ActorObjetoRecolectable *objeto : juego->objetos())
+            salida << "tesoro " << objeto->sitioFicha().fila() << " " << objeto->sitioFicha().coln() << " "
+                   << objeto->valorEfecto() << "\n";
+    }
+
+    string CapturaReglas::palabraElenco(const wstring &nombre)
+    {
+        // cada palabra empieza por mayúscula y se quitan los espacios y las tildes
+        static const wstring con_tilde{L"áéíóúüñÁÉÍÓÚÜÑ"};
+        static const string sin_tilde{"aeiouunAEIOUUN"};
+        string palabra{};
+        bool inicial = true;
+        for (wchar_t letra : nombre)
+        {
+            size_t posicion = con_tilde.find(letra);
+            char simple = posicion != wstring::npos ? sin_tilde[posicion]
+                          : (letra >= L'a' && letra <= L'z') || (letra >= L'A' && letra <= L'Z') ||
+                                  (letra >= L'0' && letra <= L'9')
+                              ? static_cast<char>(letra)
+                              : '\0';
+            if (simple == '\0')
+            {
+                inicial = true;
+                continue;
+            }
+            if (inicial && simple >= 'a' && simple <= 'z')
+                simple = static_cast<char>(simple - 'a' + 'A');
+            palabra += simple;
+            inicial = false;
+        }
+        aserta(!palabra.empty(), "nombre vacío en el elenco");
+        return palabra;
+    }
+
+    void CapturaReglas::aserta(bool expresion, const string &mensaje)
+    {
+        if (expresion)
+        {
+            return;
+        }
+        throw std::logic_error(mensaje);
+    }
+
+}
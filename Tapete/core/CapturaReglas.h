@@ -0,0 +1,76 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  CapturaReglas.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+namespace tapete
+{
+
+    class JuegoMesaBase;
+
+    /*
+     * \class CapturaReglas
+     * \brief Traduce la partida del tapete a los datos de la biblioteca de reglas.
+     *
+     * El catálogo recoge la configuración fija (personajes, habilidades, grados de efectividad) y el
+     * estado recoge lo que cambia durante la partida (sitios, vitalidad, puntos de acción, efectos
+     * de habilidades y muros). Los índices de personajes, habilidades y tipos de estadística son los
+     * mismos que asigna JuegoMesaBase.
+     */
+    class CapturaReglas
+    {
+    public:
+        /*!
+         * \brief Captura la configuración fija de la partida.
+         * \param juego Puntero al juego.
+         * \param catalogo Catálogo resultante.
+         */
+        static void capturaCatalogo(JuegoMesaBase *juego, reglas::CatalogoReglas &catalogo);
+
+        /*!
+         * \brief Captura el estado actual de la partida.
+         * \param juego Puntero al juego.
+         * \param estado Estado resultante.
+         */
+        static void capturaEstado(JuegoMesaBase *juego, reglas::EstadoReglas &estado);
+
+        /*!
+         * \brief Convierte una coordenada del tapete en una celda de las reglas.
+         * \param coord Coordenada de la celda.
+         */
+        static reglas::CeldaReglas celda(Coord coord);
+
+        /*!
+         * \brief Convierte una celda de las reglas en una coordenada del tapete.
+         * \param celda Celda de las reglas.
+         */
+        static Coord coord(reglas::CeldaReglas celda);
+
+        /*!
+         * \brief Captura los datos de una habilidad que intervienen en las reglas.
+         * \param habilidad Habilidad del tapete.
+         * \param registro Habilidad de las reglas resultante.
+         */
+        static void capturaHabilidad(Habilidad *habilidad, reglas::HabilidadReglas &registro);
+
+        /*!
+         * \brief Escribe el elenco de la partida en el formato que lee el Simulador.
+         *
+         * Los valores son los del catálogo capturado, más los sitios iniciales de los personajes y
+         * los tesoros; los nombres son los del juego, sin espacios ni tildes. Así el elenco del
+         * Simulador sale de la misma configuración que prepara el juego.
+         * \param juego Puntero al juego, ya configurado.
+         * \param salida Flujo donde se escribe el elenco.
+         */
+        static void escribeElenco(JuegoMesaBase *juego, std::ostream &salida);
+
+    private:
+        static void capturaFicha(ActorPersonaje *personaje, reglas::FichaReglas &ficha);
+
+        static string palabraElenco(const wstring &nombre);
+
+        static void aserta(bool expresion, const string &mensaje);
+    };
+
+}
@@ -0,0 +1,119 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   ClavePartida.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete
+{
+
+    ClavePartida::ClavePartida(JuegoMesaBase *juego) : juego_{juego}
+    {
+    }
+
+    void ClavePartida::inicia()
+    {
+        valor_ = calcula();
+        iniciada = true;
+    }
+
+    void ClavePartida::termina()
+    {
+        valor_ = 0;
+        iniciada = false;
+    }
+
+    uint64_t ClavePartida::valor() const
+    {
+        return valor_;
+    }
+
+    void ClavePartida::cambia(Rasgo rasgo, int indice, int anterior, int nuevo)
+    {
+        if (!iniciada || anterior == nuevo)
+        {
+            return;
+        }
+        valor_ ^= aleatorio(rasgo, indice, anterior) ^ aleatorio(rasgo, indice, nuevo);
+#ifdef _DEBUG
+        aserta(valor_ == calcula(), "la clave de la partida no coincide con el cálculo completo");
+#endif
+    }
+
+    uint64_t ClavePartida::calcula() const
+    {
+        uint64_t resultado = 0;
+        const TablaEstadisticas &tabla = juego_->estadisticas();
+        for (ActorPersonaje *persj : juego_->personajes())
+        {
+            int indice = persj->indice();
+            resultado ^= aleatorio(Rasgo::sitio, indice, valorCelda(persj->sitio_ficha));
+            resultado ^= aleatorio(Rasgo::vitalidad, indice, persj->vitalidad_);
+            resultado ^= aleatorio(Rasgo::puntosAccion, indice, persj->puntos_accion);
+            for (TipoAtaque *tipo : juego_->ataques())
+            {
+                if (tabla.aparece(TablaEstadisticas::Clase::ataque, indice, tipo->indice()))
+                {
+                    int cambio = tabla.cambio(TablaEstadisticas::Clase::ataque, indice, tipo->indice());
+                    resultado ^= aleatorio(Rasgo::cambioAtaque, indiceEstadistica(indice, tipo->indice()), cambio);
+                }
+            }
+            for (TipoDefensa *tipo : juego_->defensas())
+            {
+                if (tabla.aparece(TablaEstadisticas::Clase::defensa, indice, tipo->indice()))
+                {
+                    int cambio = tabla.cambio(TablaEstadisticas::Clase::defensa, indice, tipo->indice());
+                    resultado ^= aleatorio(Rasgo::cambioDefensa, indiceEstadistica(indice, tipo->indice()), cambio);
+                }
+            }
+        }
+
+        ModoJuegoBase *modo = juego_->modo();
+        if (modo != nullptr)
+        {
+            resultado ^= aleatorio(Rasgo::ronda, 0, modo->ronda());
+            resultado ^= aleatorio(Rasgo::turno, 0, modo->turno());
+            resultado ^= aleatorio(Rasgo::jugada, 0, modo->jugada());
+            resultado ^= aleatorio(Rasgo::ladoMueve, 0, static_cast<int>(modo->ladoMueve()));
+        }
+
+        const std::vector<ActorObjetoRecolectable *> &objetos = juego_->objetos();
+        for (int indc = 0; indc < static_cast<int>(objetos.size()); ++indc)
+        {
+            resultado ^= aleatorio(Rasgo::tesoro, indc, objetos[indc]->estaRecogido() ? 1 : 0);
+        }
+        return resultado;
+    }
+
+    int ClavePartida::indiceEstadistica(int personaje, int estadistica)
+    {
+        return (personaje << 8) | estadistica;
+    }
+
+    int ClavePartida::valorCelda(Coord celda)
+    {
+        return (celda.fila() << 8) | celda.coln();
+    }
+
+    uint64_t ClavePartida::aleatorio(Rasgo rasgo, int indice, int valor)
+    {
+        // splitmix64: cada combinación de rasgo, índice y valor da un número distinto y bien repartido
+        uint64_t mezcla = (static_cast<uint64_t>(rasgo) << 56) ^
+                          (static_cast<uint64_t>(static_cast<uint32_t>(indice)) << 32) ^
+                          static_cast<uint32_t>(valor);
+        mezcla += 0x9e3779b97f4a7c15ull;
+        mezcla = (mezcla ^ (mezcla >> 30)) * 0xbf58476d1ce4e5b9ull;
+        mezcla = (mezcla ^ (mezcla >> 27)) * 0x94d049bb133111ebull;
+        return mezcla ^ (mezcla >> 31);
+    }
+
+    void ClavePartida::aserta(bool expresion, const string &mensaje)
+    {
+        if (expresion)
+        {
+            return;
+        }
+        throw std::runtime_error(mensaje);
+    }
+
+}
@@ -0,0 +1,104 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  ClavePartida.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+namespace tapete
+{
+
+    class JuegoMesaBase;
+
+    /*
+     * \class ClavePartida
+     * \brief Clave Zobrist de 64 bits del estado de la partida, que se actualiza con cada cambio.
+     *
+     * La clave es la o exclusiva de un valor aleatorio por cada rasgo del estado: sitio, vitalidad,
+     * puntos de acción y cambios de ataque y defensa de cada personaje; ronda, turno y jugada; el
+     * lado que mueve (el del atacante o, si no hay, el del equipo actual) y los tesoros recogidos.
+     * Los valores aleatorios no se guardan en tablas: salen de mezclar el rasgo, el índice y el valor
+     * con splitmix64, así que no dependen del tamaño del tablero y son los mismos en cada ejecución.
+     *
+     * Quien cambia un rasgo avisa con cambia, que quita el valor anterior y pone el nuevo en tiempo
+     * constante: ActorPersonaje, ModoJuegoBase y ActorObjetoRecolectable. La clave empieza a
+     * seguir los cambios al comenzar la partida, con un cálculo completo; el catálogo de personajes,
+     * estadísticas y tesoros no cambia después. En las compilaciones de depuración (_DEBUG) cada
+     * cambio se comprueba contra el cálculo completo.
+     */
+    class ClavePartida
+    {
+    public:
+        enum class Rasgo : uint8_t
+        {
+            sitio,
+            vitalidad,
+            puntosAccion,
+            cambioAtaque,
+            cambioDefensa,
+            ronda,
+            turno,
+            jugada,
+            ladoMueve,
+            tesoro
+        };
+
+        /*!
+         * \brief Constructor.
+         * \param juego Puntero al juego.
+         */
+        explicit ClavePartida(JuegoMesaBase *juego);
+
+        /*!
+         * \brief Calcula la clave completa y empieza a seguir los cambios.
+         */
+        void inicia();
+
+        /*!
+         * \brief Deja de seguir los cambios.
+         */
+        void termina();
+
+        /*!
+         * \brief Devuelve la clave del estado actual, o 0 si la partida no ha comenzado.
+         */
+        uint64_t valor() const;
+
+        /*!
+         * \brief Actualiza la clave tras cambiar un rasgo; no hace nada si la partida no ha comenzado.
+         * \param rasgo Rasgo cambiado.
+         * \param indice Índice del rasgo: el del personaje, el del tesoro o 0; para los cambios de
+         *               ataque y defensa, el que devuelve indiceEstadistica.
+         * \param anterior Valor anterior del rasgo.
+         * \param nuevo Valor nuevo del rasgo.
+         */
+        void cambia(Rasgo rasgo, int indice, int anterior, int nuevo);
+
+        /*!
+         * \brief Calcula la clave recorriendo todo el estado.
+         */
+        uint64_t calcula() const;
+
+        /*!
+         * \brief Combina el índice de un personaje y el de un tipo de ataque o defensa.
+         * \param personaje Índice del personaje.
+         * \param estadistica Índice del tipo de estadística.
+         */
+        static int indiceEstadistica(int personaje, int estadistica);
+
+        /*!
+         * \brief Codifica una celda como valor de un rasgo.
+         * \param celda Coordenada de la celda.
+         */
+        static int valorCelda(Coord celda);
+
+    private:
+        JuegoMesaBase *juego_;
+        uint64_t valor_{};
+        bool iniciada{};
+
+        static uint64_t aleatorio(Rasgo rasgo, int indice, int valor);
+
+        static void aserta(bool expresion, const string &mensaje);
+    };
+
+}
@@ -0,0 +1,276 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   DiarioPartida.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete
+{
+
+    void DiarioPartida::graba(const string &archivo)
+    {
+        archivo_grabacion = archivo;
+    }
+
+    void DiarioPartida::reproduce(const string &archivo)
+    {
+        std::ifstream flujo{archivo, std::ios::binary};
+        aserta(flujo.good(), "no se puede leer el diario " + archivo);
+        char leida[4]{};
+        flujo.read(leida, 4);
+        aserta(flujo.good() && std::equal(leida, leida + 4, firma), archivo + " no es un diario de partida");
+        aserta(lee(flujo, 1) == version, "versión desconocida del diario " + archivo);
+        semilla_reproduccion = lee(flujo, 8);
+        aserta(flujo.good(), "diario " + archivo + " truncado");
+
+        registros.clear();
+        con_huella = false;
+        char bytes[4];
+        while (flujo.read(bytes, 4))
+        {
+            Registro registro{static_cast<SucesoDiario>(bytes[0]),
+                              static_cast<uint8_t>(bytes[1]),
+                              static_cast<uint8_t>(bytes[2]),
+                              static_cast<uint8_t>(bytes[3])};
+            aserta(registro.suceso <= SucesoDiario::fin, "suceso desconocido en el diario " + archivo);
+            if (registro.suceso == SucesoDiario::fin)
+            {
+                huella_grabada = static_cast<uint32_t>(lee(flujo, 4));
+                con_huella = flujo.good();
+                break;
+            }
+            registros.push_back(registro);
+        }
+        reproduciendo_ = true;
+    }
+
+    void DiarioPartida::comprueba(const string &archivo)
+    {
+        reproduce(archivo);
+        comprobando_ = true;
+    }
+
+    bool DiarioPartida::reproduciendo() const
+    {
+        return reproduciendo_;
+    }
+
+    bool DiarioPartida::comprobando() const
+    {
+        return comprobando_;
+    }
+
+    void DiarioPartida::inicia(AzarJuego &azar)
+    {
+        if (reproduciendo_)
+        {
+            azar.siembra(semilla_reproduccion);
+            return;
+        }
+        if (archivo_grabacion.empty())
+        {
+            return;
+        }
+        // semilla nueva para cada partida, pues al repetir el juego la secuencia ya ha avanzado
+        azar.siembra(azar.cosmetico()());
+        grabacion = std::ofstream{archivo_grabacion, std::ios::binary | std::ios::trunc};
+        aserta(grabacion.good(), "no se puede escribir el diario " + archivo_grabacion);
+        grabacion.write(firma, 4);
+        escribe(grabacion, version, 1);
+        escribe(grabacion, azar.semilla(), 8);
+        grabacion.flush();
+        con_ultimo = false;
+    }
+
+    void DiarioPartida::anota(SucesoDiario suceso)
+    {
+        anotaDatos(suceso, 0, 0);
+    }
+
+    void DiarioPartida::anota(SucesoDiario suceso, LadoTablero lado, int indice)
+    {
+        anotaDatos(suceso, lado == LadoTablero::Izquierda ? 0 : 1, indice);
+    }
+
+    void DiarioPartida::anota(SucesoDiario suceso, ActorPersonaje *personaje)
+    {
+        anotaDatos(suceso, personaje->indice(), 0);
+    }
+
+    void DiarioPartida::anota(SucesoDiario suceso, Coord celda)
+    {
+        anotaDatos(suceso, celda.fila(), celda.coln());
+    }
+
+    void DiarioPartida::anotaDatos(SucesoDiario suceso, int dato_1, int dato_2)
+    {
+        if (!grabacion.is_open())
+        {
+            return;
+        }
+        Registro registro{suceso, static_cast<uint8_t>(dato_1), static_cast<uint8_t>(dato_2), 1};
+        if (con_ultimo && ultimo.veces < UINT8_MAX &&
+            ultimo.suceso == registro.suceso && ultimo.dato_1 == registro.dato_1 && ultimo.dato_2 == registro.dato_2)
+        {
+            ++ultimo.veces;
+            grabacion.seekp(posicion_ultimo + std::streamoff{3});
+            grabacion.put(static_cast<char>(ultimo.veces));
+            grabacion.seekp(0, std::ios::end);
+        }
+        else
+        {
+            ultimo = registro;
+            con_ultimo = true;
+            posicion_ultimo = grabacion.tellp();
+            const char bytes[4]{static_cast<char>(registro.suceso),
+                                static_cast<char>(registro.dato_1),
+                                static_cast<char>(registro.dato_2),
+                                static_cast<char>(registro.veces)};
+            grabacion.write(bytes, 4);
+        }
+        grabacion.flush();
+    }
+
+    bool DiarioPartida::reproducePartida(JuegoMesaBase *juego, std::ostream &salida)
+    {
+        reproduciendo_ = false;
+        int sucesos = 0;
+        for (const Registro &registro : registros)
+        {
+            for (int vez = 0; vez < registro.veces; ++vez)
+            {
+                entrega(juego, registro);
+            }
+            sucesos += registro.veces;
+        }
+        salida << "Diario reproducido: " << sucesos << " sucesos";
+        if (!con_huella)
+        {
+            salida << "; la grabación no llegó al final de la partida." << std::endl;
+            return false;
+        }
+        if (huella(juego) != huella_grabada)
+        {
+            salida << "; el estado final NO coincide con el grabado." << std::endl;
+            return false;
+        }
+        salida << "; el estado final coincide con el grabado." << std::endl;
+        return true;
+    }
+
+    void DiarioPartida::entrega(JuegoMesaBase *juego, const Registro &registro)
+    {
+        SucesosJuegoComun *sucesos = juego->sucesos();
+        LadoTablero lado = registro.dato_1 == 0 ? LadoTablero::Izquierda : LadoTablero::Derecha;
+        Coord celda{registro.dato_1, registro.dato_2};
+        switch (registro.suceso)
+        {
+        case SucesoDiario::personajeSeleccionado:
+            sucesos->personajeSeleccionado(juego->personajes().at(registro.dato_1));
+            break;
+        case SucesoDiario::actuanteSeleccionado:
+            sucesos->actuanteSeleccionado(lado);
+            break;
+        case SucesoDiario::habilidadSeleccionada:
+            sucesos->habilidadSeleccionada(lado, registro.dato_2);
+            break;
+        case SucesoDiario::fichaSeleccionada:
+            sucesos->fichaSeleccionada(juego->personajes().at(registro.dato_1));
+            break;
+        case SucesoDiario::fichaPulsada:
+            sucesos->fichaPulsada(juego->personajes().at(registro.dato_1));
+            break;
+        case SucesoDiario::celdaSeleccionada:
+            sucesos->celdaSeleccionada(celda);
+            break;
+        case SucesoDiario::celdaPulsada:
+            sucesos->celdaPulsada(celda);
+            break;
+        case SucesoDiario::ayudaSeleccionada:
+            sucesos->ayudaSeleccionada();
+            break;
+        case SucesoDiario::pulsadoEspacio:
+            sucesos->pulsadoEspacio();
+            break;
+        case SucesoDiario::pulsadoEscape:
+            sucesos->pulsadoEscape();
+            break;
+        case SucesoDiario::pulsadoArriba:
+            sucesos->pulsadoArriba();
+            break;
+        case SucesoDiario::pulsadoAbajo:
+            sucesos->pulsadoAbajo();
+            break;
+        case SucesoDiario::calculoTerminado:
+            sucesos->alarmaCalculo(std::numeric_limits<double>::max());
+            break;
+        case SucesoDiario::fin:
+            break;
+        }
+    }
+
+    void DiarioPartida::termina(JuegoMesaBase *juego)
+    {
+        if (!grabacion.is_open())
+        {
+            return;
+        }
+        grabacion.put(static_cast<char>(SucesoDiario::fin));
+        grabacion.put(0);
+        grabacion.put(0);
+        grabacion.put(1);
+        escribe(grabacion, huella(juego), 4);
+        grabacion.close();
+        con_ultimo = false;
+    }
+
+    uint32_t DiarioPartida::huella(JuegoMesaBase *juego)
+    {
+        // FNV-1a sobre vitalidad, sitio y puntos de acción de cada personaje
+        uint32_t resultado = 2166136261u;
+        auto mezcla = [&resultado](int valor)
+        {
+            for (int byte = 0; byte < 4; ++byte)
+            {
+                resultado ^= static_cast<uint8_t>(valor >> (8 * byte));
+                resultado *= 16777619u;
+            }
+        };
+        for (ActorPersonaje *personaje : juego->personajes())
+        {
+            mezcla(personaje->vitalidad());
+            mezcla(personaje->sitioFicha().fila());
+            mezcla(personaje->sitioFicha().coln());
+            mezcla(personaje->puntosAccion());
+        }
+        return resultado;
+    }
+
+    void DiarioPartida::escribe(std::ostream &flujo, uint64_t valor, int bytes)
+    {
+        for (int byte = 0; byte < bytes; ++byte)
+        {
+            flujo.put(static_cast<char>(valor >> (8 * byte)));
+        }
+    }
+
+    uint64_t DiarioPartida::lee(std::istream &flujo, int bytes)
+    {
+        uint64_t valor = 0;
+        for (int byte = 0; byte < bytes; ++byte)
+        {
+            valor |= static_cast<uint64_t>(static_cast<uint8_t>(flujo.get())) << (8 * byte);
+        }
+        return valor;
+    }
+
+    void DiarioPartida::aserta(bool expresion, const string &mensaje)
+    {
+        if (expresion)
+        {
+            return;
+        }
+        throw std::runtime_error(mensaje);
+    }
+
+}
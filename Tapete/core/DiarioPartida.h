@@ -0,0 +1,187 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  DiarioPartida.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+#include <fstream>
+
+namespace tapete
+{
+
+    class JuegoMesaBase;
+    class SucesosJuegoComun;
+
+    /*!
+     * \enum SucesoDiario
+     * \brief Sucesos de entrada que se anotan en el diario de una partida.
+     *
+     * Son los que pueden cambiar el estado del modo de juego. Los de pasar el ratón por encima de
+     * retratos, habilidades, fichas y celdas solo cambian el dibujo y no se anotan.
+     */
+    enum class SucesoDiario : uint8_t
+    {
+        personajeSeleccionado, ///< índice del personaje
+        actuanteSeleccionado,  ///< lado
+        habilidadSeleccionada, ///< lado e índice de la habilidad
+        fichaSeleccionada,     ///< índice del personaje
+        fichaPulsada,          ///< índice del personaje
+        celdaSeleccionada,     ///< fila y columna
+        celdaPulsada,          ///< fila y columna
+        ayudaSeleccionada,
+        pulsadoEspacio,
+        pulsadoEscape,
+        pulsadoArriba,
+        pulsadoAbajo,
+        calculoTerminado,      ///< fin del tiempo de cálculo de una habilidad
+        fin                    ///< final de la partida, seguido de la huella del estado
+    };
+
+    /*
+     * \class DiarioPartida
+     * \brief Diario binario de una partida, para grabarla y reproducirla.
+     *
+     * El archivo empieza por una cabecera con la semilla del servicio de números aleatorios y sigue
+     * con un registro de cuatro bytes por suceso: tipo, dos datos y número de repeticiones seguidas,
+     * pues mientras se mantiene pulsado un botón el suceso llega en cada fotograma. Cada registro se
+     * escribe en cuanto ocurre, así que un diario sirve aunque el juego termine por una excepción.
+     *
+     * Como los sucesos anotados son todas las entradas del modo de juego y la partida solo usa la
+     * secuencia de números aleatorios de la partida, reproducir el diario con la misma semilla lleva
+     * al modo por los mismos estados. La reproducción entrega todos los sucesos de una vez, sin la
+     * introducción ni las esperas del cálculo, y al terminar compara la huella del estado con la
+     * grabada.
+     *
+     * La reproducción es cosa del juego, no del Simulador: los sucesos son entradas de la interfaz
+     * (pulsaciones sobre retratos, fichas y celdas, y teclas) que solo interpretan SucesosJuegoComun y
+     * los modos de juego, con sus estados de preparación y confirmación, y el Simulador juega
+     * directamente sobre las acciones de la biblioteca de reglas. Traducirlos allí supondría una
+     * segunda copia de esas máquinas de estados. Como UNIR-2D siempre abre la ventana, el juego con
+     * --reproduce la abre, pero la partida entera se reproduce en el primer fotograma.
+     *
+     * Para comprobar diarios por lotes, el juego con --comprueba reproduce el diario y termina el
+     * proceso en cuanto compara la huella, con código 0 si coincide y 1 si no. UNIR-2D no permite
+     * terminar una partida desde el juego, así que con varios diarios o una carpeta el juego lanza
+     * un proceso por diario y resume los resultados (ver Juego/principal.cpp).
+     */
+    class DiarioPartida
+    {
+    public:
+        /*!
+         * \brief Indica el archivo donde se grabarán las partidas.
+         * \param archivo Ruta del diario; cada partida sobrescribe la anterior.
+         */
+        void graba(const string &archivo);
+
+        /*!
+         * \brief Lee un diario para reproducirlo en la siguiente partida.
+         * \param archivo Ruta del diario.
+         * \throw std::runtime_error si el archivo no se puede leer o no es un diario.
+         */
+        void reproduce(const string &archivo);
+
+        /*!
+         * \brief Lee un diario para reproducirlo en la siguiente partida y terminar después el proceso.
+         * \param archivo Ruta del diario.
+         * \throw std::runtime_error si el archivo no se puede leer o no es un diario.
+         */
+        void comprueba(const string &archivo);
+
+        /*!
+         * \brief Indica si hay un diario pendiente de reproducir.
+         */
+        bool reproduciendo() const;
+
+        /*!
+         * \brief Indica si el proceso debe terminar al reproducir el diario.
+         */
+        bool comprobando() const;
+
+        /*!
+         * \brief Prepara el diario al iniciar una partida.
+         *
+         * Si se reproduce, siembra los números aleatorios con la semilla grabada; si se graba, los
+         * siembra con una semilla nueva y la escribe en la cabecera.
+         * \param azar Servicio de números aleatorios del juego.
+         */
+        void inicia(AzarJuego &azar);
+
+        /*!
+         * \brief Anota un suceso sin datos.
+         * \param suceso Tipo de suceso.
+         */
+        void anota(SucesoDiario suceso);
+
+        /*!
+         * \brief Anota un suceso sobre un lado del tablero.
+         * \param suceso Tipo de suceso.
+         * \param lado Lado del tablero.
+         * \param indice Índice de la habilidad, si lo hay.
+         */
+        void anota(SucesoDiario suceso, LadoTablero lado, int indice = 0);
+
+        /*!
+         * \brief Anota un suceso sobre un personaje.
+         * \param suceso Tipo de suceso.
+         * \param personaje Personaje.
+         */
+        void anota(SucesoDiario suceso, ActorPersonaje *personaje);
+
+        /*!
+         * \brief Anota un suceso sobre una celda.
+         * \param suceso Tipo de suceso.
+         * \param celda Coordenada de la celda.
+         */
+        void anota(SucesoDiario suceso, Coord celda);
+
+        /*!
+         * \brief Entrega a los sucesos del juego todos los registros del diario leído.
+         * \param juego Puntero al juego.
+         * \param salida Flujo donde se informa del resultado.
+         * \return true si el estado final coincide con el grabado; false si no coincide o si la
+         *         grabación no llegó al final de la partida.
+         */
+        bool reproducePartida(JuegoMesaBase *juego, std::ostream &salida);
+
+        /*!
+         * \brief Cierra la grabación de la partida con la huella del estado final.
+         * \param juego Puntero al juego.
+         */
+        void termina(JuegoMesaBase *juego);
+
+    private:
+        struct Registro
+        {
+            SucesoDiario suceso;
+            uint8_t dato_1;
+            uint8_t dato_2;
+            uint8_t veces;
+        };
+
+        static constexpr char firma[4]{'G', 'Y', 'B', 'D'};
+        static constexpr uint8_t version = 1;
+
+        string archivo_grabacion{};
+        std::ofstream grabacion{};
+        std::streampos posicion_ultimo{};
+        Registro ultimo{};
+        bool con_ultimo{};
+
+        std::vector<Registro> registros{};
+        uint64_t semilla_reproduccion{};
+        uint32_t huella_grabada{};
+        bool con_huella{};
+        bool reproduciendo_{};
+        bool comprobando_{};
+
+        void anotaDatos(SucesoDiario suceso, int dato_1, int dato_2);
+        void entrega(JuegoMesaBase *juego, const Registro &registro);
+
+        static uint32_t huella(JuegoMesaBase *juego);
+        static void escribe(std::ostream &flujo, uint64_t valor, int bytes);
+        static uint64_t lee(std::istream &flujo, int bytes);
+
+        static void aserta(bool expresion, const string &mensaje);
+    };
+
+}
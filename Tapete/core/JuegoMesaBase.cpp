@@ -37,7 +37,17 @@ namespace tapete
     SucesosJuegoComun *JuegoMesaBase::sucesos() { return sucesos_; }
     ModoJuegoBase *JuegoMesaBase::modo() { return modo_; }
     SistemaAtaque &JuegoMesaBase::sistemaAtaque() { return ataque_; }
+    TablaEstadisticas &JuegoMesaBase::estadisticas() { return estadisticas_; }
     unir2d::Tiempo &JuegoMesaBase::tiempoCalculo() { return tiempo_calculo; }
+    AzarJuego &JuegoMesaBase::azar() { return azar_; }
+    DiarioPartida &JuegoMesaBase::diario() { return diario_; }
+    JugadorAutomatico &JuegoMesaBase::jugadorAutomatico() { return jugador_; }
+    void JuegoMesaBase::exportaElenco(const string &archivo) { archivo_elenco_ = archivo; }
+    ClavePartida &JuegoMesaBase::clavePartida() { return clave_; }
+    const PrecargaActivos &JuegoMesaBase::precarga() const { return precarga_; }
+    AlmacenTexturas &JuegoMesaBase::texturas() { return texturas_; }
+    bool JuegoMesaBase::enReposo() const { return en_reposo_; }
+    const std::vector<ActorObjetoRecolectable *> &JuegoMesaBase::objetos() const { return objetos_; }
 
     void JuegoMesaBase::agregaObjeto(ActorObjetoRecolectable *obj)
     {
@@ -55,6 +65,7 @@ namespace tapete
     {
 
         valida_.Construccion();
+        diario_.inicia(azar_);
         preparaTablero();
         valida_.Tablero();
         preparaPersonajes();
@@ -73,6 +84,25 @@ namespace tapete
         valida_.SistemaAtaque();
         configuraJuego();
         valida_.ConfiguraJuego();
+        if (!archivo_elenco_.empty())
+        {
+            std::ofstream elenco{archivo_elenco_, std::ios::trunc};
+            if (!elenco.is_open())
+                throw std::runtime_error("no se puede escribir el elenco '" + archivo_elenco_ + "'");
+            CapturaReglas::escribeElenco(this, elenco);
+        }
+
+        if (diario_.reproduciendo())
+        {
+            estado_intro_ = EstadoIntro::Fin;
+            comienzaPartida();
+            return;
+        }
+
+        // los archivos de la partida se leen en otros hilos mientras se ve la introducción
+        agregaPrecarga();
+        precarga_.arranca(0);
+        leidos_precarga_ = -1;
 
         imgs_.push_back(new IntroJuegoImagen(carpeta_activos_comun + "estudio.png"));
         imgs_.push_back(new IntroJuegoImagen(carpeta_activos_comun + "portada.png"));
@@ -113,6 +143,7 @@ namespace tapete
 
                     img_actual_intro_ = imgs_[currentIntroIdx_];
                     agregaActor(img_actual_intro_);
+                    leidos_precarga_ = -1;
                     estado_intro_ = static_cast<EstadoIntro>(currentIntroIdx_);
                 }
                 else
@@ -122,6 +153,7 @@ namespace tapete
                 }
             }
             espacio_pulsado_intro_ = pulsado;
+            avisaPrecarga();
 
             if (estado_intro_ == EstadoIntro::Fin)
             {
@@ -133,23 +165,90 @@ namespace tapete
                     delete img;
                 imgs_.clear();
 
-                agregaActor(tablero_);
-                for (auto *p : personajes_)
-                    agregaActor(p);
-                agregaActor(musica_);
-                for (auto *o : objetos_)
-                    agregaActor(o);
-                sucesos_->iniciado();
+                comienzaPartida();
             }
             return;
         }
 
         controlTeclado();
+        jugador_.actua();
         controlTiempo();
     }
 
+    void JuegoMesaBase::comienzaPartida()
+    {
+        agregaActor(tablero_);
+        for (auto *p : personajes_)
+            agregaActor(p);
+        agregaActor(musica_);
+        for (auto *o : objetos_)
+            agregaActor(o);
+        clave_.inicia();
+        sucesos_->iniciado();
+        if (diario_.reproduciendo())
+        {
+            bool coincide = diario_.reproducePartida(this, std::cout);
+            // UNIR-2D no permite terminar la partida desde el juego: al comprobar termina el proceso
+            if (diario_.comprobando())
+                std::exit(coincide ? 0 : 1);
+        }
+    }
+
+    void JuegoMesaBase::agregaPrecarga()
+    {
+        precarga_.agrega(tablero_->archivoBaldosas());
+        precarga_.agrega(tablero_->ArchivoEscudo(LadoTablero::Izquierda));
+        precarga_.agrega(tablero_->ArchivoEscudo(LadoTablero::Derecha));
+        precarga_.agrega(tablero_->archivoSonidoEstablece());
+        precarga_.agrega(tablero_->archivoSonidoFracaso());
+        precarga_.agrega(tablero_->archivoSonidoExito());
+        precarga_.agrega(tablero_->archivoSonidoDesplaza());
+        for (const char *archivo : {"microdiana.png", "plancha_titulo.png", "marco_75.png", "barras_vida.png",
+                                    "barras_larga_vida.png", "muro_piedra.png", "panel_lateral.png", "panel_abajo.png",
+                                    "bandera_izquierda.png", "bandera_derecha.png", "monitor_fondo.png",
+                                    "marco_display.png", "digitos_display.png", "boton_ayuda.png",
+                                    "marco_personaje.png", "marco_habilidad.png", "piloto_colores.png",
+                                    "marca_amarilla_corta.png"})
+            precarga_.agrega(carpeta_activos_comun + archivo);
+        for (auto *p : personajes_)
+        {
+            precarga_.agrega(p->archivoRetrato());
+            precarga_.agrega(p->archivoFicha());
+            precarga_.agrega(p->archivoPersonajeSFX());
+            precarga_.agrega(p->archivoSeleccionSFX());
+            precarga_.agrega(p->archivoDesplazamientoSFX());
+        }
+        for (auto *h : habilidades_)
+        {
+            precarga_.agrega(h->archivoImagen());
+            precarga_.agrega(h->archivoFondoImagen());
+            precarga_.agrega(h->archivoSonido());
+        }
+        if (musica_)
+            precarga_.agrega(musica_->archivoMusica());
+    }
+
+    void JuegoMesaBase::progresoPrecarga(int leidos, int total)
+    {
+        if (img_actual_intro_ != nullptr)
+            img_actual_intro_->muestraProgreso(leidos, total);
+    }
+
+    void JuegoMesaBase::avisaPrecarga()
+    {
+        int leidos = precarga_.cuentaLeidos();
+        if (leidos == leidos_precarga_)
+            return;
+        leidos_precarga_ = leidos;
+        progresoPrecarga(leidos, precarga_.cuentaArchivos());
+    }
+
     void JuegoMesaBase::termina()
     {
+        diario_.termina(this);
+        clave_.termina();
+        precarga_.vacia();
+        jugador_.termina();
         sucesos_->terminado();
         sucesos_ = nullptr;
         for (auto *a : ataques_)
@@ -174,28 +273,86 @@ namespace tapete
         personajes_derch_.clear();
         delete tablero_;
         tablero_ = nullptr;
+#ifdef _DEBUG
+        texturas_.informa(std::cout);
+#endif
     }
 
     void JuegoMesaBase::preactualiza(double)
     {
+        controlReposo();
+    }
+
+    void JuegoMesaBase::controlReposo()
+    {
+        if (hayActividad() || !tiempo_quieto.iniciado())
+        {
+            tiempo_quieto.inicia();
+            en_reposo_ = false;
+            return;
+        }
+        en_reposo_ = tiempo_quieto.segundos() >= esperaReposo;
+        if (en_reposo_)
+        {
+            // el motor dibuja cada fotograma; en reposo se espera para no ocupar un núcleo entero
+            std::this_thread::sleep_for(std::chrono::milliseconds(pausaReposo));
+        }
+    }
+
+    bool JuegoMesaBase::hayActividad()
+    {
+        Vector raton = unir2d::Raton::posicion();
+        bool movido = unir2d::norma(raton - raton_quieto_) > 0.0f;
+        raton_quieto_ = raton;
+        if (movido)
+            return true;
+        if (unir2d::Raton::pulsando(unir2d::BotonRaton::izquierda) ||
+            unir2d::Raton::pulsando(unir2d::BotonRaton::derecha) ||
+            unir2d::Raton::dobleClic())
+            return true;
+        for (unir2d::Tecla tecla : {unir2d::Tecla::espacio, unir2d::Tecla::escape,
+                                    unir2d::Tecla::arriba, unir2d::Tecla::abajo})
+        {
+            if (unir2d::Teclado::pulsando(tecla))
+                return true;
+        }
+        return estado_intro_ != EstadoIntro::Fin || !precarga_.terminada() || tiempo_calculo.iniciado() ||
+               jugador_.ocupado() || diario_.reproduciendo();
     }
 
     void JuegoMesaBase::controlTeclado()
     {
         if (unir2d::Teclado::pulsando(unir2d::Tecla::espacio))
+        {
+            diario_.anota(SucesoDiario::pulsadoEspacio);
             sucesos_->pulsadoEspacio();
+        }
         else if (unir2d::Teclado::pulsando(unir2d::Tecla::escape))
+        {
+            diario_.anota(SucesoDiario::pulsadoEscape);
             sucesos_->pulsadoEscape();
+        }
         else if (unir2d::Teclado::pulsando(unir2d::Tecla::arriba))
+        {
+            diario_.anota(SucesoDiario::pulsadoArriba);
             sucesos_->pulsadoArriba();
+        }
         else if (unir2d::Teclado::pulsando(unir2d::Tecla::abajo))
+        {
+            diario_.anota(SucesoDiario::pulsadoAbajo);
             sucesos_->pulsadoAbajo();
+        }
     }
 
     void JuegoMesaBase::controlTiempo()
     {
         if (tiempo_calculo.iniciado())
+        {
             sucesos_->alarmaCalculo(tiempo_calculo);
+            // solo se anota la alarma que termina el cálculo; las anteriores únicamente animan el display
+            if (!tiempo_calculo.iniciado())
+                diario_.anota(SucesoDiario::calculoTerminado);
+        }
     }
 
     void JuegoMesaBase::agregaTablero(ActorTablero *v) { tablero_ = v; }
@@ -111,24 +111,121 @@ namespace tapete
          */
         SistemaAtaque &sistemaAtaque();
 
+        /*!
+         * \brief Accede a la tabla de estadísticas de los personajes.
+         * \return Referencia a la tabla.
+         */
+        TablaEstadisticas &estadisticas();
+
         /*!
          * \brief Accede al tiempo de cálculo interno.
          * \return Referencia al objeto de tiempo.
          */
         unir2d::Tiempo &tiempoCalculo();
 
+        /*!
+         * \brief Accede al servicio de números aleatorios.
+         *
+         * Para repetir una partida basta con sembrarlo con la misma semilla antes de iniciar el juego.
+         * \return Referencia al servicio de números aleatorios.
+         */
+        AzarJuego &azar();
+
+        /*!
+         * \brief Accede al diario de la partida, para grabarla o reproducirla.
+         *
+         * Hay que indicar el archivo antes de iniciar el juego.
+         * \return Referencia al diario.
+         */
+        DiarioPartida &diario();
+
+        /*!
+         * \brief Accede al jugador automático, que puede jugar por uno o los dos lados.
+         *
+         * Hay que indicar sus lados antes de iniciar el juego; por omisión no juega por ninguno.
+         * \return Referencia al jugador automático.
+         */
+        JugadorAutomatico &jugadorAutomatico();
+
+        /*!
+         * \brief Indica el archivo donde se escribirá el elenco de la partida para el Simulador.
+         *
+         * Hay que indicarlo antes de iniciar el juego; el elenco se escribe al terminar la
+         * configuración, con CapturaReglas::escribeElenco.
+         * \param archivo Ruta del elenco.
+         */
+        void exportaElenco(const string &archivo);
+
+        /*!
+         * \brief Accede a la clave Zobrist del estado de la partida.
+         *
+         * Solo sigue los cambios desde que comienza la partida hasta que termina.
+         * \return Referencia a la clave.
+         */
+        ClavePartida &clavePartida();
+
+        /*!
+         * \brief Accede a la precarga de los archivos de imágenes y sonidos.
+         *
+         * Arranca al comenzar la introducción; su progreso se avisa con progresoPrecarga.
+         * \return Referencia a la precarga.
+         */
+        const PrecargaActivos &precarga() const;
+
+        /*!
+         * \brief Accede al almacén de texturas compartidas por las presencias.
+         * \return Referencia al almacén.
+         */
+        AlmacenTexturas &texturas();
+
+        /*!
+         * \brief Indica si el juego está en reposo.
+         *
+         * El juego reposa cuando lleva esperaReposo segundos sin que se mueva el ratón ni se pulse
+         * un botón o una tecla de las que atiende, y sin nada en marcha: la introducción, la
+         * precarga, el cálculo de una habilidad, una búsqueda o una jugada pendiente del jugador
+         * automático (JugadorAutomatico::ocupado) o la reproducción de un diario. Mientras reposa,
+         * los actores no consultan la entrada en cada fotograma y el bucle se duerme pausaReposo
+         * milisegundos antes de cada uno; los dibujos que han cambiado se siguen refrescando, cada
+         * uno con su propia marca de cambio, así que lo que entrega el jugador automático se ve
+         * aunque el juego repose.
+         */
+        bool enReposo() const;
+
         /*!
          * \brief Agrega un objeto recolectable al juego.
          * \param obj Puntero al objeto recolectable.
          */
         void agregaObjeto(ActorObjetoRecolectable *obj);
 
+        /*!
+         * \brief Devuelve la lista de objetos recolectables.
+         * \return Vector de punteros a objetos.
+         */
+        const std::vector<ActorObjetoRecolectable *> &objetos() const;
+
         /*!
          * \brief Evento virtual que se ejecuta después de mover un personaje.
          * \param personaje Puntero al personaje que se ha movido.
          */
         virtual void despuesDeMover(ActorPersonaje *personaje) {}
 
+        /*!
+         * \brief Indica si los muros del tablero se generan al azar en cada partida.
+         *
+         * Por omisión no; entonces el elenco del Simulador lleva los muros de esta partida.
+         */
+        virtual bool murosAleatorios() const { return false; }
+
+        /*!
+         * \brief Evento virtual que se ejecuta durante la introducción cuando avanza la precarga.
+         *
+         * Por omisión muestra el progreso como una barra al pie de la imagen actual de la introducción.
+         * \param leidos Archivos ya leídos.
+         * \param total Archivos que hay que leer.
+         */
+        virtual void progresoPrecarga(int leidos, int total);
+
     protected:
         /*!
          * \brief Destructor protegido.
@@ -296,7 +393,22 @@ namespace tapete
         SucesosJuegoComun *sucesos_{nullptr};
         ModoJuegoBase *modo_{nullptr};
         SistemaAtaque ataque_{this};     ///< sistema de ataque del juego
+        TablaEstadisticas estadisticas_{}; ///< ataque, defensa y reducción de daño de los personajes
         unir2d::Tiempo tiempo_calculo{}; ///< tiempo interno para cálculos
+        AzarJuego azar_{};               ///< números aleatorios de la partida y cosméticos
+        DiarioPartida diario_{};         ///< grabación o reproducción de la partida
+        JugadorAutomatico jugador_{this}; ///< jugador que sustituye al humano en un lado
+        string archivo_elenco_{};         ///< elenco que se escribe al configurar, si lo hay
+        ClavePartida clave_{this};        ///< clave Zobrist del estado de la partida
+        PrecargaActivos precarga_{};       ///< lectura adelantada de imágenes y sonidos
+        AlmacenTexturas texturas_{};       ///< texturas cargadas una vez por archivo
+        int leidos_precarga_{-1};          ///< archivos leídos avisados con progresoPrecarga
+
+        static constexpr double esperaReposo = 0.5; ///< segundos sin actividad antes de reposar
+        static constexpr int pausaReposo = 50;      ///< milisegundos dormidos en cada fotograma de reposo
+        unir2d::Tiempo tiempo_quieto{};            ///< tiempo desde la última actividad
+        Vector raton_quieto_{};                    ///< posición del ratón en el fotograma anterior
+        bool en_reposo_{false};                    ///< si el juego está en reposo
 
         /*!
          * \brief Ajusta la región de la ventana según la posición y tamaño.
@@ -305,11 +417,36 @@ namespace tapete
          */
         void regionVentana(Vector &pos, Vector &tam) const override;
 
+        /*!
+         * \brief Agrega los actores de la partida al terminar la introducción y la inicia.
+         */
+        void comienzaPartida();
+
+        /*!
+         * \brief Agrega a la precarga los archivos de imágenes y sonidos que cargan los actores.
+         */
+        void agregaPrecarga();
+
+        /*!
+         * \brief Avisa del progreso de la precarga si ha cambiado.
+         */
+        void avisaPrecarga();
+
         /*!
          * \brief Procesa la entrada de teclado.
          */
         void controlTeclado();
 
+        /*!
+         * \brief Decide si el juego está en reposo y, si lo está, duerme hasta el siguiente fotograma.
+         */
+        void controlReposo();
+
+        /*!
+         * \brief Indica si en este fotograma ha llegado entrada o hay algo en marcha.
+         */
+        bool hayActividad();
+
         /*!
          * \brief Procesa eventos de tiempo.
          */
@@ -0,0 +1,481 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   JugadorAutomatico.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete
+{
+
+    JugadorAutomatico::JugadorAutomatico(JuegoMesaBase *juego) : juego_{juego}
+    {
+    }
+
+    JugadorAutomatico::~JugadorAutomatico()
+    {
+        detieneBusqueda();
+    }
+
+    void JugadorAutomatico::asignaLado(LadoTablero lado, bool automatico)
+    {
+        automaticos[lado == LadoTablero::Izquierda ? 0 : 1] = automatico;
+    }
+
+    bool JugadorAutomatico::automatico(LadoTablero lado) const
+    {
+        return lado != LadoTablero::nulo && automaticos[lado == LadoTablero::Izquierda ? 0 : 1];
+    }
+
+    bool JugadorAutomatico::activo() const
+    {
+        return automaticos[0] || automaticos[1];
+    }
+
+    bool JugadorAutomatico::ocupado() const
+    {
+        return hilo_busqueda.joinable() || !plan.empty();
+    }
+
+    void JugadorAutomatico::indicaPresupuesto(double segundos)
+    {
+        presupuesto = segundos;
+    }
+
+    void JugadorAutomatico::actua()
+    {
+        if (!automaticos[0] && !automaticos[1])
+        {
+            return;
+        }
+        if (juego_->diario().reproduciendo())
+        {
+            return;
+        }
+        if (ritmo.iniciado() && ritmo.segundos() < pausa)
+        {
+            return;
+        }
+        if (decide(juego_->sucesos()->modo()))
+        {
+            ritmo.inicia();
+        }
+    }
+
+    void JugadorAutomatico::termina()
+    {
+        detieneBusqueda();
+        montecarlo.reset();
+        busqueda.reset();
+        acciones.reset();
+        reglas_.reset();
+        catalogo.reset();
+        plan.clear();
+        repeticiones = 0;
+        ritmo.termina();
+    }
+
+    bool JugadorAutomatico::decide(ModoJuegoComun *modo)
+    {
+        int estado = modo->estado();
+        switch (estado)
+        {
+        case EstadoJuegoComun::inicial:
+        case EstadoJuegoComun::terminal:
+        case EstadoJuegoComun::finalPartida:
+        case EstadoJuegoComun::mostrandoAyuda:
+        case EstadoJuegoComun::oponenteHabilidadCalculando:
+        case EstadoJuegoComun::areaHabilidadCalculando:
+            return false;
+        }
+        if (estadoJugada(modo, estado) && modo->atacante() != nullptr)
+        {
+            if (!automatico(modo->atacante()->ladoTablero()))
+            {
+                plan.clear();
+                return false;
+            }
+            return decideJugada(modo, estado);
+        }
+        plan.clear();
+
+        if (dynamic_cast<ModoJuegoPares *>(modo) != nullptr)
+        {
+            if (estado == EstadoJuegoPares::inicioTurnoNoElegidos ||
+                estado == EstadoJuegoPares::inicioTurnoElegidoUno)
+            {
+                // cada lado automático elige su personaje; el humano puede elegir antes o después
+                for (LadoTablero lado : {LadoTablero::Izquierda, LadoTablero::Derecha})
+                {
+                    if (!automatico(lado) || modo->personajeElegido(lado) != nullptr)
+                    {
+                        continue;
+                    }
+                    reglas::TurnoReglas turno{reglas::ModoReglas::pares, ladoReglas(lado), 1,
+                                              {indice(modo->personajeElegido(LadoTablero::Izquierda)),
+                                               indice(modo->personajeElegido(LadoTablero::Derecha))}};
+                    return eligePersonaje(turno, lado);
+                }
+                return false;
+            }
+        }
+        else if (dynamic_cast<ModoJuegoLibreDoble *>(modo) != nullptr)
+        {
+            LadoTablero lado = modo->ladoEquipoActual();
+            if (estado == EstadoJuegoLibreDoble::inicioTurnoNoElegido)
+            {
+                if (!automatico(lado))
+                {
+                    return false;
+                }
+                reglas::TurnoReglas turno{reglas::ModoReglas::libre_doble, ladoReglas(lado), 2, {-1, -1}};
+                return eligePersonaje(turno, lado);
+            }
+            if (estado == EstadoJuegoLibreDoble::inicioTurnoConfirmacion)
+            {
+                if (!automatico(lado))
+                {
+                    return false;
+                }
+                entrega(Paso{SucesoDiario::pulsadoEspacio});
+                return true;
+            }
+        }
+        else if (dynamic_cast<ModoJuegoEquipo *>(modo) != nullptr)
+        {
+            // el modo elige el personaje que actúa; espacio lo confirma quien lo vaya a mover
+            LadoTablero lado = ladoFactorSiguiente(modo);
+            if (lado != LadoTablero::nulo)
+            {
+                if (!automatico(lado))
+                {
+                    return false;
+                }
+                entrega(Paso{SucesoDiario::pulsadoEspacio});
+                return true;
+            }
+        }
+
+        // inicio de ronda, confirmación de los personajes de pares y final de turno no son de
+        // ningún lado: los avanza el humano si lo hay
+        if (!automaticos[0] || !automaticos[1])
+        {
+            return false;
+        }
+        entrega(Paso{SucesoDiario::pulsadoEspacio});
+        return true;
+    }
+
+    bool JugadorAutomatico::decideJugada(ModoJuegoComun *modo, int estado)
+    {
+        if (!plan.empty())
+        {
+            Paso paso = plan.front();
+            plan.pop_front();
+            entrega(paso);
+            return true;
+        }
+        switch (estado)
+        {
+        case EstadoJuegoComun::inicioJugada:
+        case EstadoJuegoComun::preparacionDesplazamiento:
+        case EstadoJuegoComun::preparacionHabilidadOponente:
+        case EstadoJuegoComun::preparacionHabilidadArea:
+        {
+            reglas::AccionReglas accion;
+            if (!busca(turnoJugada(modo), modo->atacante()->ladoTablero(), accion))
+            {
+                return false;
+            }
+            planifica(modo, estado, accion);
+            return decideJugada(modo, estado);
+        }
+        case EstadoJuegoComun::marcacionCaminoFicha:
+        case EstadoJuegoComun::habilidadSimpleInvalida:
+        case EstadoJuegoComun::habilidadSimpleConfirmacion:
+        case EstadoJuegoComun::oponenteHabilidadInvalido:
+        case EstadoJuegoComun::oponenteHabilidadConfirmacion:
+        case EstadoJuegoComun::areaHabilidadInvalida:
+        case EstadoJuegoComun::areaHabilidadConfirmacion:
+            // el plan no ha llevado donde se esperaba: se deshace la acción y se busca de nuevo
+            entrega(Paso{SucesoDiario::pulsadoEscape});
+            return true;
+        default:
+            // resultados de habilidades y personaje agotado
+            entrega(Paso{SucesoDiario::pulsadoEspacio});
+            return true;
+        }
+    }
+
+    bool JugadorAutomatico::eligePersonaje(const reglas::TurnoReglas &turno, LadoTablero lado)
+    {
+        reglas::AccionReglas accion;
+        if (!busca(turno, lado, accion))
+        {
+            return false;
+        }
+        entrega(Paso{SucesoDiario::personajeSeleccionado, lado, 0, juego_->personajes().at(accion.personaje)});
+        return true;
+    }
+
+    bool JugadorAutomatico::busca(const reglas::TurnoReglas &turno, LadoTablero lado, reglas::AccionReglas &accion)
+    {
+        if (catalogo == nullptr)
+        {
+            catalogo = std::make_unique<reglas::CatalogoReglas>();
+            CapturaReglas::capturaCatalogo(juego_, *catalogo);
+            reglas_ = std::make_unique<reglas::ReglasJuego>(*catalogo);
+            acciones = std::make_unique<reglas::GeneradorAcciones>(*reglas_);
+            busqueda = std::make_unique<reglas::BusquedaExpectimax>(*acciones);
+            // la semilla de la búsqueda no consume números de la secuencia de la partida
+            int hilos = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+            montecarlo = std::make_unique<reglas::BusquedaMonteCarlo>(*catalogo, hilos, juego_->azar().semilla());
+        }
+        uint64_t clave = juego_->clavePartida().valor();
+        if (hilo_busqueda.joinable())
+        {
+            if (!busqueda_terminada)
+            {
+                // sigue buscando: se vuelve a mirar en el próximo fotograma
+                return false;
+            }
+            hilo_busqueda.join();
+            reloj.termina();
+            if (error_busqueda != nullptr)
+            {
+                std::exception_ptr error = error_busqueda;
+                error_busqueda = nullptr;
+                std::rethrow_exception(error);
+            }
+            if (clave == clave_busqueda && lado == lado_busqueda)
+            {
+                accion = resultado_busqueda.accion;
+                return busqueda_encontrada;
+            }
+            // la partida ha cambiado mientras se buscaba: el resultado ya no vale
+        }
+
+        // Si el modo rechaza las acciones elegidas, la partida vuelve una y otra vez al mismo
+        // estado; antes que bloquearla se deja el lado al jugador humano.
+        repeticiones = clave == clave_previa ? repeticiones + 1 : 1;
+        clave_previa = clave;
+        if (repeticiones > maximoRepeticiones)
+        {
+            std::cout << "El jugador automático no consigue jugar; el lado pasa al jugador humano." << std::endl;
+            asignaLado(lado, false);
+            repeticiones = 0;
+            return false;
+        }
+
+        CapturaReglas::capturaEstado(juego_, estado_reglas);
+        clave_busqueda = clave;
+        lado_busqueda = lado;
+        lanzaBusqueda(turno);
+        return false;
+    }
+
+    void JugadorAutomatico::lanzaBusqueda(const reglas::TurnoReglas &turno)
+    {
+        // el hilo solo lee estado_reglas y escribe el resultado; el hilo del juego no los toca
+        // hasta que busqueda_terminada lo indica
+        busqueda_terminada = false;
+        busqueda_cancelada = false;
+        reloj.inicia();
+        hilo_busqueda = std::thread{&JugadorAutomatico::ejecutaBusqueda, this, turno};
+    }
+
+    void JugadorAutomatico::ejecutaBusqueda(reglas::TurnoReglas turno)
+    {
+        const std::function<bool()> agotado = [this]()
+        {
+            return busqueda_cancelada || reloj.segundos() >= presupuesto;
+        };
+        try
+        {
+            if (turno.modo == reglas::ModoReglas::pares)
+            {
+                busqueda_encontrada = busqueda->busca(estado_reglas, turno, reglas::BusquedaExpectimax::profundidadMaxima,
+                                                      agotado, resultado_busqueda);
+            }
+            else
+            {
+                busqueda_encontrada = montecarlo->busca(estado_reglas, turno, INT64_MAX, agotado, resultado_busqueda);
+            }
+        }
+        catch (...)
+        {
+            // la excepción se relanza en el hilo del juego al recoger el resultado
+            busqueda_encontrada = false;
+            error_busqueda = std::current_exception();
+        }
+        busqueda_terminada = true;
+    }
+
+    void JugadorAutomatico::detieneBusqueda()
+    {
+        if (!hilo_busqueda.joinable())
+        {
+            return;
+        }
+        busqueda_cancelada = true;
+        hilo_busqueda.join();
+        reloj.termina();
+        error_busqueda = nullptr;
+    }
+
+    void JugadorAutomatico::planifica(ModoJuegoComun *modo, int estado, const reglas::AccionReglas &accion)
+    {
+        ActorPersonaje *atacante = modo->atacante();
+        LadoTablero lado = atacante->ladoTablero();
+        plan.clear();
+        if (accion.tipo == reglas::TipoAccionReglas::desplaza)
+        {
+            // desde la preparación de una habilidad se vuelve antes al desplazamiento
+            if (estado == EstadoJuegoComun::preparacionHabilidadOponente ||
+                estado == EstadoJuegoComun::preparacionHabilidadArea)
+            {
+                plan.push_back(Paso{SucesoDiario::actuanteSeleccionado, lado});
+            }
+            plan.push_back(Paso{SucesoDiario::fichaPulsada, lado, 0, atacante});
+            for (int etapa = 0; etapa < accion.cuenta_etapas; ++etapa)
+            {
+                plan.push_back(Paso{SucesoDiario::celdaPulsada, lado, 0, nullptr,
+                                    CapturaReglas::coord(accion.etapas[etapa])});
+            }
+            plan.push_back(Paso{SucesoDiario::pulsadoEspacio});
+            return;
+        }
+
+        // la habilidad se selecciona por su posición entre las del personaje
+        const reglas::FichaReglas &ficha = catalogo->fichas[accion.personaje];
+        int posicion = 0;
+        while (ficha.habilidades[posicion] != accion.habilidad)
+        {
+            ++posicion;
+        }
+        plan.push_back(Paso{SucesoDiario::habilidadSeleccionada, lado, posicion});
+        switch (catalogo->habilidades[accion.habilidad].enfoque)
+        {
+        case reglas::EnfoqueReglas::personaje:
+            plan.push_back(Paso{SucesoDiario::personajeSeleccionado, lado, 0,
+                                juego_->personajes().at(accion.objetivo)});
+            break;
+        case reglas::EnfoqueReglas::area:
+            plan.push_back(Paso{SucesoDiario::celdaSeleccionada, lado, 0, nullptr,
+                                CapturaReglas::coord(accion.celda_area)});
+            break;
+        default:
+            break;
+        }
+        plan.push_back(Paso{SucesoDiario::pulsadoEspacio});
+    }
+
+    void JugadorAutomatico::entrega(const Paso &paso)
+    {
+        SucesosJuegoComun *sucesos = juego_->sucesos();
+        DiarioPartida &diario = juego_->diario();
+        switch (paso.suceso)
+        {
+        case SucesoDiario::personajeSeleccionado:
+            diario.anota(paso.suceso, paso.personaje);
+            sucesos->personajeSeleccionado(paso.personaje);
+            break;
+        case SucesoDiario::actuanteSeleccionado:
+            diario.anota(paso.suceso, paso.lado);
+            sucesos->actuanteSeleccionado(paso.lado);
+            break;
+        case SucesoDiario::habilidadSeleccionada:
+            diario.anota(paso.suceso, paso.lado, paso.indice);
+            sucesos->habilidadSeleccionada(paso.lado, paso.indice);
+            break;
+        case SucesoDiario::fichaPulsada:
+            diario.anota(paso.suceso, paso.personaje);
+            sucesos->fichaPulsada(paso.personaje);
+            break;
+        case SucesoDiario::celdaSeleccionada:
+            diario.anota(paso.suceso, paso.celda);
+            sucesos->celdaSeleccionada(paso.celda);
+            break;
+        case SucesoDiario::celdaPulsada:
+            diario.anota(paso.suceso, paso.celda);
+            sucesos->celdaPulsada(paso.celda);
+            break;
+        case SucesoDiario::pulsadoEspacio:
+            diario.anota(paso.suceso);
+            sucesos->pulsadoEspacio();
+            break;
+        case SucesoDiario::pulsadoEscape:
+            diario.anota(paso.suceso);
+            sucesos->pulsadoEscape();
+            break;
+        default:
+            assert(false);
+            break;
+        }
+    }
+
+    reglas::TurnoReglas JugadorAutomatico::turnoJugada(ModoJuegoComun *modo) const
+    {
+        LadoTablero lado = modo->atacante()->ladoTablero();
+        reglas::TurnoReglas turno{reglas::ModoReglas::equipo, ladoReglas(lado), 1, {-1, -1}};
+        turno.elegidos[static_cast<int>(turno.lado)] = indice(modo->atacante());
+        if (dynamic_cast<ModoJuegoPares *>(modo) != nullptr)
+        {
+            turno.modo = reglas::ModoReglas::pares;
+            turno.elegidos = {indice(modo->personajeElegido(LadoTablero::Izquierda)),
+                              indice(modo->personajeElegido(LadoTablero::Derecha))};
+        }
+        else if (dynamic_cast<ModoJuegoLibreDoble *>(modo) != nullptr)
+        {
+            turno.modo = reglas::ModoReglas::libre_doble;
+            turno.acciones = modo->jugada() > 1 ? 1 : 2;
+        }
+        else
+        {
+            turno.inicial = ladoReglas(modo->ladoEquipoInicial());
+        }
+        return turno;
+    }
+
+    LadoTablero JugadorAutomatico::ladoFactorSiguiente(ModoJuegoComun *modo) const
+    {
+        // el mismo recorrido que ModoJuegoEquipo::buscaJugada, sin avanzar el índice
+        const std::vector<ActorPersonaje *> &factores = modo->factoresEquipos();
+        for (int indc = modo->indiceFactorEquipos() + 1; indc < static_cast<int>(factores.size()); ++indc)
+        {
+            if (factores[indc]->vitalidad() > 0 && factores[indc]->puntosAccion() > 0)
+            {
+                return factores[indc]->ladoTablero();
+            }
+        }
+        return LadoTablero::nulo;
+    }
+
+    bool JugadorAutomatico::estadoJugada(ModoJuegoComun *modo, int estado)
+    {
+        if (EstadoJuegoComun::inicioJugada <= estado && estado <= EstadoJuegoComun::areaHabilidadResultado)
+        {
+            return true;
+        }
+        // el personaje agotado sigue siendo el atacante hasta que se confirma
+        if (dynamic_cast<ModoJuegoPares *>(modo) != nullptr)
+        {
+            return estado == EstadoJuegoPares::agotadosPuntosAccion;
+        }
+        if (dynamic_cast<ModoJuegoLibreDoble *>(modo) != nullptr)
+        {
+            return estado == EstadoJuegoLibreDoble::agotadosPuntosAccion;
+        }
+        return false;
+    }
+
+    int8_t JugadorAutomatico::indice(ActorPersonaje *personaje)
+    {
+        return personaje == nullptr ? -1 : static_cast<int8_t>(personaje->indice());
+    }
+
+    reglas::LadoReglas JugadorAutomatico::ladoReglas(LadoTablero lado)
+    {
+        return lado == LadoTablero::Izquierda ? reglas::LadoReglas::izquierda : reglas::LadoReglas::derecha;
+    }
+
+}
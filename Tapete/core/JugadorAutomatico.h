@@ -0,0 +1,156 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  JugadorAutomatico.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+#include <deque>
+
+namespace tapete
+{
+
+    class JuegoMesaBase;
+    class ModoJuegoComun;
+
+    /*
+     * \class JugadorAutomatico
+     * \brief Juega por uno o los dos lados del tablero en lugar de un jugador humano.
+     *
+     * Decide cada jugada sobre el estado capturado con CapturaReglas: en el modo por pares con
+     * reglas::BusquedaExpectimax, y en los modos equipo y libre doble, que tienen muchas más jugadas
+     * por turno, con reglas::BusquedaMonteCarlo en un hilo por núcleo. Luego la convierte en los
+     * mismos sucesos que produce el ratón o el teclado: elegir la habilidad, el objetivo o la celda,
+     * marcar las etapas del camino y confirmar con espacio. Así el modo de juego no distingue al
+     * jugador automático de uno humano, y los sucesos se anotan en el diario de la partida como los
+     * demás.
+     *
+     * Entrega un suceso en cada fotograma, con una pausa entre uno y otro para que se pueda seguir la
+     * partida. La búsqueda corre en un hilo aparte y se detiene al agotar el presupuesto de tiempo de
+     * la jugada, medido con unir2d::Tiempo; mientras tanto cada fotograma solo mira si ha terminado,
+     * así que la partida se sigue dibujando. Si la partida cambia antes de que termine, el resultado
+     * se descarta y se busca de nuevo. Los estados que no son de ningún lado, como el inicio de
+     * ronda, solo los avanza si juega por los dos lados.
+     */
+    class JugadorAutomatico
+    {
+    public:
+        /*!
+         * \brief Constructor.
+         * \param juego Puntero al juego.
+         */
+        explicit JugadorAutomatico(JuegoMesaBase *juego);
+
+        /*!
+         * \brief Destructor: detiene la búsqueda en curso y espera a su hilo.
+         */
+        ~JugadorAutomatico();
+
+        JugadorAutomatico(const JugadorAutomatico &) = delete;
+        JugadorAutomatico &operator=(const JugadorAutomatico &) = delete;
+
+        /*!
+         * \brief Indica si el jugador automático juega por un lado.
+         * \param lado Lado del tablero.
+         * \param automatico true si juega por el lado; false si juega un humano.
+         */
+        void asignaLado(LadoTablero lado, bool automatico);
+
+        /*!
+         * \brief Indica si el jugador automático juega por un lado.
+         * \param lado Lado del tablero.
+         */
+        bool automatico(LadoTablero lado) const;
+
+        /*!
+         * \brief Indica si el jugador automático juega por algún lado.
+         */
+        bool activo() const;
+
+        /*!
+         * \brief Indica si el jugador automático tiene trabajo en marcha: una búsqueda en su hilo o
+         *        sucesos de una jugada pendientes de entregar.
+         *
+         * Mientras espera a que juegue un humano no está ocupado, aunque juegue por algún lado.
+         */
+        bool ocupado() const;
+
+        /*!
+         * \brief Indica el tiempo máximo de búsqueda de cada jugada.
+         * \param segundos Presupuesto en segundos.
+         */
+        void indicaPresupuesto(double segundos);
+
+        /*!
+         * \brief Entrega el siguiente suceso, si le toca a un lado automático y ha pasado la pausa.
+         *
+         * Se llama en cada fotograma de la partida. No hace nada mientras se reproduce un diario.
+         */
+        void actua();
+
+        /*!
+         * \brief Olvida la partida terminada: detiene la búsqueda y olvida el catálogo de reglas y la
+         *        jugada en curso.
+         */
+        void termina();
+
+    private:
+        /*
+         * Suceso de entrada pendiente de entregar al modo de juego.
+         */
+        struct Paso
+        {
+            SucesoDiario suceso;
+            LadoTablero lado;
+            int indice;
+            ActorPersonaje *personaje;
+            Coord celda;
+        };
+
+        static constexpr double pausa = 0.3;
+        static constexpr int maximoRepeticiones = 3;
+
+        JuegoMesaBase *juego_;
+        std::array<bool, 2> automaticos{};
+        double presupuesto{1.0};
+        unir2d::Tiempo ritmo{};
+        unir2d::Tiempo reloj{};
+
+        std::unique_ptr<reglas::CatalogoReglas> catalogo{};
+        std::unique_ptr<reglas::ReglasJuego> reglas_{};
+        std::unique_ptr<reglas::GeneradorAcciones> acciones{};
+        std::unique_ptr<reglas::BusquedaExpectimax> busqueda{};
+        std::unique_ptr<reglas::BusquedaMonteCarlo> montecarlo{};
+        reglas::EstadoReglas estado_reglas{};
+
+        std::deque<Paso> plan{};
+        uint64_t clave_previa{};
+        int repeticiones{};
+
+        std::thread hilo_busqueda{};
+        std::atomic<bool> busqueda_terminada{};
+        std::atomic<bool> busqueda_cancelada{};
+        bool busqueda_encontrada{};
+        std::exception_ptr error_busqueda{};
+        reglas::ResultadoBusqueda resultado_busqueda{};
+        uint64_t clave_busqueda{};
+        LadoTablero lado_busqueda{LadoTablero::nulo};
+
+        bool decide(ModoJuegoComun *modo);
+        bool decideJugada(ModoJuegoComun *modo, int estado);
+        bool eligePersonaje(const reglas::TurnoReglas &turno, LadoTablero lado);
+        bool busca(const reglas::TurnoReglas &turno, LadoTablero lado, reglas::AccionReglas &accion);
+        void lanzaBusqueda(const reglas::TurnoReglas &turno);
+        void ejecutaBusqueda(reglas::TurnoReglas turno);
+        void detieneBusqueda();
+        void planifica(ModoJuegoComun *modo, int estado, const reglas::AccionReglas &accion);
+        void entrega(const Paso &paso);
+
+        reglas::TurnoReglas turnoJugada(ModoJuegoComun *modo) const;
+        LadoTablero ladoFactorSiguiente(ModoJuegoComun *modo) const;
+
+        static bool estadoJugada(ModoJuegoComun *modo, int estado);
+        static int8_t indice(ActorPersonaje *personaje);
+        static reglas::LadoReglas ladoReglas(LadoTablero lado);
+    };
+
+}
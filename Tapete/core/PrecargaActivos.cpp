@@ -0,0 +1,104 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   PrecargaActivos.cpp
+// versión:  2.1  (Abril-2025)
+
+#include <fstream>
+
+#include "tapete.h"
+
+namespace tapete
+{
+
+    PrecargaActivos::~PrecargaActivos()
+    {
+        espera();
+    }
+
+    void PrecargaActivos::agrega(const string &archivo)
+    {
+        aserta(!arrancada, "no se pueden agregar archivos a una precarga arrancada");
+        if (archivo.empty() || std::find(archivos.begin(), archivos.end(), archivo) != archivos.end())
+        {
+            return;
+        }
+        archivos.push_back(archivo);
+    }
+
+    void PrecargaActivos::arranca(int hilos)
+    {
+        aserta(!arrancada, "la precarga ya está arrancada");
+        arrancada = true;
+        if (hilos < 1)
+        {
+            hilos = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+        hilos = std::min(hilos, static_cast<int>(archivos.size()));
+        hilos_.reserve(hilos);
+        for (int indc = 0; indc < hilos; ++indc)
+        {
+            hilos_.emplace_back(&PrecargaActivos::trabaja, this);
+        }
+    }
+
+    int PrecargaActivos::cuentaArchivos() const
+    {
+        return static_cast<int>(archivos.size());
+    }
+
+    int PrecargaActivos::cuentaLeidos() const
+    {
+        return leidos.load(std::memory_order_acquire);
+    }
+
+    bool PrecargaActivos::terminada() const
+    {
+        return cuentaLeidos() == cuentaArchivos();
+    }
+
+    void PrecargaActivos::espera()
+    {
+        for (std::thread &hilo : hilos_)
+        {
+            hilo.join();
+        }
+        hilos_.clear();
+    }
+
+    void PrecargaActivos::vacia()
+    {
+        espera();
+        archivos.clear();
+        siguiente.store(0);
+        leidos.store(0);
+        arrancada = false;
+    }
+
+    void PrecargaActivos::trabaja()
+    {
+        int total = static_cast<int>(archivos.size());
+        for (int indc = siguiente.fetch_add(1); indc < total; indc = siguiente.fetch_add(1))
+        {
+            lee(archivos[indc]);
+            leidos.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    void PrecargaActivos::lee(const string &archivo)
+    {
+        std::ifstream flujo{archivo, std::ios::binary};
+        char bloque[64 * 1024];
+        while (flujo.read(bloque, sizeof(bloque)))
+        {
+        }
+    }
+
+    void PrecargaActivos::aserta(bool expresion, const string &mensaje)
+    {
+        if (expresion)
+        {
+            return;
+        }
+        throw std::logic_error(mensaje);
+    }
+
+}
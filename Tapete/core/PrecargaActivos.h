@@ -0,0 +1,92 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  PrecargaActivos.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+namespace tapete
+{
+
+    /*
+     * \class PrecargaActivos
+     * \brief Lee en paralelo los archivos de imágenes y sonidos del juego mientras se ve la introducción.
+     *
+     * UNIR-2D solo carga texturas y sonidos desde una ruta, en el hilo principal, y decodifica y
+     * sube a la tarjeta gráfica en la misma llamada; no se puede repartir la decodificación. Lo que
+     * sí se puede adelantar es la lectura del disco: varios hilos leen los archivos de principio a
+     * fin y descartan lo leído, de modo que cuando los actores los cargan al comenzar la partida ya
+     * están en la caché del sistema operativo.
+     *
+     * Los archivos se agregan antes de arrancar; cada ruta se lee una sola vez. Los hilos toman el
+     * siguiente archivo de un índice atómico y terminan cuando no quedan. Un archivo que no se puede
+     * abrir cuenta como leído: el error lo dará la carga de verdad. El destructor espera a los hilos.
+     * Para precargar otra partida con el mismo objeto, se vacía antes de agregar sus archivos.
+     */
+    class PrecargaActivos
+    {
+    public:
+        /*!
+         * \brief Constructor.
+         */
+        PrecargaActivos() = default;
+
+        /*!
+         * \brief Destructor: espera a que terminen los hilos.
+         */
+        ~PrecargaActivos();
+
+        PrecargaActivos(const PrecargaActivos &) = delete;
+        PrecargaActivos &operator=(const PrecargaActivos &) = delete;
+
+        /*!
+         * \brief Agrega un archivo a la precarga; las rutas vacías y repetidas se ignoran.
+         * \param archivo Ruta del archivo.
+         */
+        void agrega(const string &archivo);
+
+        /*!
+         * \brief Arranca los hilos que leen los archivos.
+         * \param hilos Número de hilos; si es menor que uno, uno por núcleo.
+         */
+        void arranca(int hilos);
+
+        /*!
+         * \brief Devuelve el número de archivos agregados.
+         */
+        int cuentaArchivos() const;
+
+        /*!
+         * \brief Devuelve el número de archivos ya leídos.
+         */
+        int cuentaLeidos() const;
+
+        /*!
+         * \brief Indica si se han leído todos los archivos.
+         */
+        bool terminada() const;
+
+        /*!
+         * \brief Espera a que terminen los hilos.
+         */
+        void espera();
+
+        /*!
+         * \brief Espera a que terminen los hilos y olvida los archivos, para arrancar otra precarga.
+         */
+        void vacia();
+
+    private:
+        std::vector<string> archivos{};
+        std::vector<std::thread> hilos_{};
+        std::atomic<int> siguiente{};
+        std::atomic<int> leidos{};
+        bool arrancada{};
+
+        void trabaja();
+
+        static void lee(const string &archivo);
+
+        static void aserta(bool expresion, const string &mensaje);
+    };
+
+}
@@ -313,12 +313,16 @@ namespace tapete {
     }
 
     void SucesosJuegoComun::alarmaCalculo (unir2d::Tiempo & tiempo) {
+        alarmaCalculo (tiempo.segundos ());
+    }
+
+    void SucesosJuegoComun::alarmaCalculo (double segundos) {
         switch (modo ()->estado ()) {
         case EstadoJuegoComun::oponenteHabilidadCalculando:
-            modo ()->calculaHabilidadOponente (tiempo);
+            modo ()->calculaHabilidadOponente (segundos);
             break;
         case EstadoJuegoComun::areaHabilidadCalculando:
-            modo ()->calculaHabilidadArea (tiempo);
+            modo ()->calculaHabilidadArea (segundos);
             break;
         }
     }
@@ -178,6 +178,12 @@ namespace tapete
          */
         virtual void alarmaCalculo(unir2d::Tiempo &tiempo);
 
+        /*!
+         * \brief Evento de alarma para cálculos temporizados.
+         * \param segundos Tiempo transcurrido desde que empezó el cálculo.
+         */
+        virtual void alarmaCalculo(double segundos);
+
     private:
         JuegoMesaBase *juego_{};
         ModoJuegoComun *modo_{};
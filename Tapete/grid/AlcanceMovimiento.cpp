@@ -0,0 +1,97 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   AlcanceMovimiento.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete {
+
+    AlcanceMovimiento::AlcanceMovimiento () {
+        puntos_celdas     .resize (OcupacionTablero::celdas, sinAlcance);
+        celdas_alcanzables.reserve (OcupacionTablero::celdas);
+    }
+
+    bool AlcanceMovimiento::vigente (
+            Coord celda_origen, float distancia_previa, int puntos_accion, unsigned int version_ocupacion) const {
+        return calculado_                                    &&
+               this->celda_origen      == celda_origen       &&
+               this->distancia_previa  == distancia_previa   &&
+               this->puntos_accion     == puntos_accion      &&
+               this->version_ocupacion == version_ocupacion;
+    }
+
+    void AlcanceMovimiento::calcula (
+            JuegoMesaBase *                 juego,
+            const reglas::DistanciaCamino & camino,
+            int                             puntos_accion,
+            float                           puntos_accion_de_desplaza) {
+
+        const OcupacionTablero & ocupacion = juego->tablero ()->ocupacion ();
+        Coord celda_origen      = CapturaReglas::coord (camino.ultima ());
+        float distancia_previa  = camino.longitud ();
+        this->celda_origen      = celda_origen;
+        this->distancia_previa  = distancia_previa;
+        this->puntos_accion     = puntos_accion;
+        this->version_ocupacion = ocupacion.version ();
+        calculado_              = true;
+        std::fill (puntos_celdas.begin (), puntos_celdas.end (), sinAlcance);
+        celdas_alcanzables.clear ();
+
+        // Ninguna etapa más larga que este radio cabe en los puntos de acción; se deja un punto de
+        // margen para el redondeo y se recorre solo el rectángulo de filas y columnas que lo contiene.
+        float radio = (puntos_accion + 1) * puntos_accion_de_desplaza - distancia_previa;
+        if (radio <= 0.0f) {
+            return;
+        }
+        constexpr float alto_fila  = RejillaTablero::ladoHexagono * RejillaTablero::seno60;
+        constexpr float ancho_coln = RejillaTablero::ladoHexagono * 1.5f;
+        int filas = static_cast <int> (radio / alto_fila)  + 1;
+        int colns = static_cast <int> (radio / ancho_coln) + 1;
+        int fila_desde = std::max (1,                        celda_origen.fila () - filas);
+        int fila_hasta = std::min (RejillaTablero::filas,    celda_origen.fila () + filas);
+        int coln_desde = std::max (1,                        celda_origen.coln () - colns);
+        int coln_hasta = std::min (RejillaTablero::columnas, celda_origen.coln () + colns);
+
+        for (int fila = fila_desde; fila <= fila_hasta; ++ fila) {
+            int coln_inicio = coln_desde;
+            if ((fila % 2 == 0) != (coln_inicio % 2 == 0)) {
+                ++ coln_inicio;
+            }
+            for (int coln = coln_inicio; coln <= coln_hasta; coln += 2) {
+                Coord celda {fila, coln};
+                int indc = OcupacionTablero::indiceCelda (celda);
+                if (indc < 0) {
+                    continue;
+                }
+                if (ocupacion.ocupada (celda)) {
+                    continue;
+                }
+                // la misma cuenta que ModoJuegoBase::puntosEnJuegoCamino
+                int punts = camino.puntosHasta (CapturaReglas::celda (celda), puntos_accion_de_desplaza);
+                if (punts > puntos_accion) {
+                    continue;
+                }
+                if (! CalculoCaminos::segmentoValido (juego, celda_origen, celda)) {
+                    continue;
+                }
+                puntos_celdas [indc] = static_cast <signed char> (punts);
+                celdas_alcanzables.push_back (celda);
+            }
+        }
+    }
+
+    void AlcanceMovimiento::consulta (Coord celda, bool & etapa_valida, int & puntos_en_juego) const {
+        int indc = OcupacionTablero::indiceCelda (celda);
+        if (indc < 0 || puntos_celdas [indc] == sinAlcance) {
+            etapa_valida = false;
+            return;
+        }
+        puntos_en_juego = puntos_celdas [indc];
+        etapa_valida = true;
+    }
+
+    const std::vector <Coord> & AlcanceMovimiento::celdasAlcanzables () const {
+        return celdas_alcanzables;
+    }
+
+}
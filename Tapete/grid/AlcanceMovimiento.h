@@ -0,0 +1,87 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  AlcanceMovimiento.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace tapete {
+
+
+    class JuegoMesaBase;
+
+
+    /*
+     * \class AlcanceMovimiento
+     * \brief Tabla de las etapas de camino que puede recorrer el atacante desde la última etapa.
+     *
+     * Para una celda de origen, una distancia ya recorrida y unos puntos de acción, calcula en una
+     * sola pasada, limitada al círculo que permiten los puntos de acción, qué celdas son destino de
+     * una etapa recta válida y cuántos puntos en juego supondría el camino al llegar a ellas. La
+     * tabla se conserva mientras no cambien esos datos ni la ocupación del tablero, de modo que
+     * validar la celda bajo el ratón se reduce a una consulta.
+     */
+    class AlcanceMovimiento {
+    public:
+        /*!
+         * \brief Constructor. Reserva la tabla de celdas.
+         */
+        AlcanceMovimiento ();
+
+        /*!
+         * \brief Comprueba si la tabla corresponde a los datos indicados.
+         * \param celda_origen Celda de partida de la próxima etapa.
+         * \param distancia_previa Longitud del camino ya trazado, en píxeles.
+         * \param puntos_accion Puntos de acción disponibles.
+         * \param version_ocupacion Versión actual del mapa de ocupación.
+         */
+        bool vigente (
+                Coord        celda_origen,
+                float        distancia_previa,
+                int          puntos_accion,
+                unsigned int version_ocupacion ) const;
+
+        /*!
+         * \brief Calcula la tabla de etapas válidas.
+         * \param juego Puntero al juego.
+         * \param camino Camino ya trazado; la próxima etapa sale de su última celda.
+         * \param puntos_accion Puntos de acción disponibles.
+         * \param puntos_accion_de_desplaza Píxeles que se recorren por cada punto de acción.
+         */
+        void calcula (
+                JuegoMesaBase *                 juego,
+                const reglas::DistanciaCamino & camino,
+                int                             puntos_accion,
+                float                           puntos_accion_de_desplaza );
+
+        /*!
+         * \brief Consulta una celda de la tabla.
+         * \param celda Celda destino de la etapa.
+         * \param etapa_valida Si la etapa es válida.
+         * \param puntos_en_juego Puntos en juego del camino (solo si la etapa es válida).
+         */
+        void consulta (Coord celda, bool & etapa_valida, int & puntos_en_juego) const;
+
+        /*!
+         * \brief Devuelve las celdas que son destino de una etapa válida.
+         */
+        const std::vector <Coord> & celdasAlcanzables () const;
+
+    private:
+
+        static constexpr signed char sinAlcance = -1;
+
+        bool         calculado_ {};
+        Coord        celda_origen {};
+        float        distancia_previa {};
+        int          puntos_accion {};
+        unsigned int version_ocupacion {};
+
+        std::vector <signed char> puntos_celdas {};
+        std::vector <Coord>       celdas_alcanzables {};
+
+    };
+
+
+}
@@ -0,0 +1,28 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   BuscadorCaminos.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete {
+
+    bool BuscadorCaminos::busca (
+            JuegoMesaBase * juego, Coord celda_origen, Coord celda_destino, std::vector <Coord> & etapas) {
+        etapas.clear ();
+        const OcupacionTablero & ocupacion = juego->tablero ()->ocupacion ();
+        if (! busqueda_.busca (ocupacion.tablero (), ocupacion.planoCamino (),
+                               CapturaReglas::celda (celda_origen), CapturaReglas::celda (celda_destino),
+                               etapas_reglas                                                          )) {
+            return false;
+        }
+        for (reglas::CeldaReglas celda : etapas_reglas) {
+            etapas.push_back (CapturaReglas::coord (celda));
+        }
+        return true;
+    }
+
+    float BuscadorCaminos::longitud () const {
+        return busqueda_.longitud ();
+    }
+
+}
@@ -0,0 +1,52 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  BuscadorCaminos.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace tapete {
+
+
+    class JuegoMesaBase;
+
+
+    /*
+     * \class BuscadorCaminos
+     * \brief Busca el camino más corto entre dos celdas de la rejilla.
+     *
+     * Traslada la consulta a reglas::BusquedaCamino, el A* de la biblioteca de reglas, con los
+     * muros, las fichas y las etapas del camino en curso del mapa de ocupación del tablero. Los
+     * búferes de la búsqueda y el de las etapas se reservan una sola vez y se reutilizan.
+     */
+    class BuscadorCaminos {
+    public:
+        /*!
+         * \brief Busca el camino más corto entre dos celdas.
+         * \param juego Puntero al juego.
+         * \param celda_origen Celda de partida (puede estar ocupada por la ficha que se mueve).
+         * \param celda_destino Celda de llegada.
+         * \param etapas Etapas del camino, empezando por la celda de origen.
+         * \return true si existe un camino, false en caso contrario.
+         */
+        bool busca (
+                JuegoMesaBase *       juego,
+                Coord                 celda_origen,
+                Coord                 celda_destino,
+                std::vector <Coord> & etapas        );
+
+        /*!
+         * \brief Devuelve la longitud del último camino encontrado, en píxeles.
+         */
+        float longitud () const;
+
+    private:
+
+        reglas::BusquedaCamino             busqueda_ {};
+        std::vector <reglas::CeldaReglas>  etapas_reglas {};
+
+    };
+
+
+}
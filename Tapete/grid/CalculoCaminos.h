@@ -17,7 +17,9 @@ namespace tapete {
     // El resto de las celdas aparecen cuando:
     //      no estan fuera del tablero y 
     //      no están en los muros
-    using AreaCentradaCeldas = std::vector <std::vector <Coord>>;
+    // La celda central es la primera; después van las celdas anillo a anillo, en un único vector
+    // que se reutiliza de un área a la siguiente
+    using AreaCentradaCeldas = std::vector <Coord>;
 
 
     /* 
@@ -26,7 +28,8 @@ namespace tapete {
      *
      * Incluye métodos estáticos para comprobar si una celda está en el tablero, en un muro u ocupada,
      * validar etapas y segmentos de camino, calcular áreas centradas en una celda y gestionar la geometría
-     * necesaria para el movimiento y alcance en el juego.
+     * necesaria para el movimiento y alcance en el juego. Los límites del tablero y los segmentos se
+     * calculan con reglas::TableroReglas, la misma implementación que usan las reglas.
      */
     class CalculoCaminos {
     public:
@@ -75,7 +78,8 @@ namespace tapete {
          * \param juego Puntero al juego.
          * \param celda_central Celda central.
          * \param radio_area Radio del área.
-         * \param area_celdas Referencia al área de celdas resultante.
+         * \param area_celdas Referencia al área de celdas resultante; se vacía antes, conservando
+         *                    su capacidad.
          */
         static void areaCeldas (
                 JuegoMesaBase *      juego, 
@@ -84,89 +88,6 @@ namespace tapete {
                 AreaCentradaCeldas & area_celdas    );
 
     private:
-        /*!
-         * \struct EcuacionRecta
-         * \brief Representa la ecuación de una recta en el plano.
-         */
-        struct EcuacionRecta {
-            float a; /*!< Coeficiente de x */
-            float b; /*!< Coeficiente de y */
-            float c; /*!< Término independiente */
-            float d; /*!< Magnitud del vector director */
-        };
-
-        /*!
-         * \brief Calcula la dirección exacta y el cuadrante entre dos celdas.
-         * \param celda_origen_etapa Celda de origen.
-         * \param celda_destino_etapa Celda de destino.
-         * \param direccion_exacta Dirección exacta resultante.
-         * \param direccion_cuadrante Dirección de cuadrante resultante.
-         */
-        static void calculoDireccion (
-                Coord celda_origen_etapa, Coord celda_destino_etapa,
-                int & direccion_exacta, int & direccion_cuadrante   );
-
-        /*!
-         * \brief Valida si una etapa de camino exacto es válida.
-         * \param juego Puntero al juego.
-         * \param celda_origen_etapa Celda de origen.
-         * \param celda_destino_etapa Celda de destino.
-         * \param direccion_exacta Dirección exacta.
-         * \return true si la etapa es válida, false en caso contrario.
-         */
-        static bool etapaValidaCaminoExacto (
-                JuegoMesaBase * juego, 
-                Coord celda_origen_etapa, Coord celda_destino_etapa, 
-                int direccion_exacta                                );
-        /*!
-         * \brief Calcula la celda próxima en un camino exacto.
-         * \param celda_sale Celda de salida.
-         * \param direccion_exacta Dirección exacta.
-         * \param celda_llega Celda de llegada resultante.
-         */
-        static void celdaProximaCaminoExacto (
-                Coord celda_sale, int direccion_exacta,
-                Coord & celda_llega                    );
-        /*!
-         * \brief Valida si una etapa de camino por cuadrante es válida.
-         * \param juego Puntero al juego.
-         * \param celda_origen_etapa Celda de origen.
-         * \param celda_destino_etapa Celda de destino.
-         * \param direccion_cuadrante Dirección de cuadrante.
-         * \return true si la etapa es válida, false en caso contrario.
-         */
-        static bool etapaValidaCaminoCuadrante (
-                JuegoMesaBase * juego, 
-                Coord celda_origen_etapa, Coord celda_destino_etapa, 
-                int direccion_cuadrante                             );
-        /*!
-         * \brief Calcula la celda próxima en un camino por cuadrante.
-         * \param celda_sale Celda de salida.
-         * \param direccion_cuadrante Dirección de cuadrante.
-         * \param recta_etapa Ecuación de la recta de la etapa.
-         * \param celda_llega Celda de llegada resultante.
-         */
-        static void celdaProximaCaminoCuadrante (
-                Coord celda_sale, int direccion_cuadrante,
-                const EcuacionRecta & recta_etapa, Coord & celda_llega);
-
-        /*!
-         * \brief Calcula la ecuación de una recta a partir de un vector director y un punto.
-         * \param vector_director Vector director.
-         * \param punto_recta Punto por el que pasa la recta.
-         * \param recta Ecuación de la recta resultante.
-         */
-        static void calculaRecta (
-                Vector vector_director, Vector punto_recta,
-                CalculoCaminos::EcuacionRecta & recta      );
-        /*!
-         * \brief Calcula la distancia de un punto a una recta.
-         * \param recta Ecuación de la recta.
-         * \param punto Punto a medir.
-         * \return Distancia.
-         */
-        static float distancia (const EcuacionRecta & recta, Vector punto);
-
         /*!
          * \brief Agrega un lado al área de celdas centrada.
          * \param juego Puntero al juego.
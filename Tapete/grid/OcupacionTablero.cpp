@@ -0,0 +1,105 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   OcupacionTablero.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete {
+
+    static_assert (RejillaTablero::filas    == reglas::TableroReglas::filas    &&
+                   RejillaTablero::columnas == reglas::TableroReglas::columnas,
+                   "la rejilla y el tablero de las reglas deben tener las mismas dimensiones");
+    static_assert (RejillaTablero::ladoHexagono == reglas::TableroReglas::ladoHexagono &&
+                   RejillaTablero::seno60       == reglas::TableroReglas::seno60       &&
+                   RejillaTablero::seno60_exacto == reglas::TableroReglas::seno60_exacto,
+                   "la rejilla y el tablero de las reglas deben tener la misma geometría");
+
+    int OcupacionTablero::indiceCelda (Coord celda) {
+        return reglas::TableroReglas::indiceCelda (CapturaReglas::celda (celda));
+    }
+
+    bool OcupacionTablero::enMuro (Coord celda) const {
+        return tablero_.enMuro (CapturaReglas::celda (celda));
+    }
+
+    bool OcupacionTablero::conFicha (Coord celda) const {
+        return personaje (celda) != nullptr;
+    }
+
+    bool OcupacionTablero::enCamino (Coord celda) const {
+        int indc = indiceCelda (celda);
+        if (indc < 0) {
+            return false;
+        }
+        return plano_camino.test (indc);
+    }
+
+    bool OcupacionTablero::ocupada (Coord celda) const {
+        int indc = indiceCelda (celda);
+        if (indc < 0) {
+            return false;
+        }
+        return tablero_.ocupada (CapturaReglas::celda (celda)) || plano_camino.test (indc);
+    }
+
+    ActorPersonaje * OcupacionTablero::personaje (Coord celda) const {
+        int indc = indiceCelda (celda);
+        if (indc < 0) {
+            return nullptr;
+        }
+        return fichas_celda [indc];
+    }
+
+    void OcupacionTablero::ponMuro (Coord celda) {
+        if (indiceCelda (celda) < 0) {
+            return;
+        }
+        tablero_.ponMuro (CapturaReglas::celda (celda));
+        ++ version_;
+    }
+
+    void OcupacionTablero::mueveFicha (ActorPersonaje * persj, Coord origen, Coord destino) {
+        int indc_origen  = indiceCelda (origen);
+        int indc_destino = indiceCelda (destino);
+        if (indc_origen >= 0 && fichas_celda [indc_origen] == persj) {
+            fichas_celda [indc_origen] = nullptr;
+        }
+        if (indc_destino >= 0) {
+            fichas_celda [indc_destino] = persj;
+        }
+        tablero_.mueveFicha (CapturaReglas::celda (origen), CapturaReglas::celda (destino));
+        ++ version_;
+    }
+
+    void OcupacionTablero::ponEtapaCamino (Coord celda) {
+        int indc = indiceCelda (celda);
+        if (indc < 0) {
+            return;
+        }
+        plano_camino.set (indc);
+        ++ version_;
+    }
+
+    void OcupacionTablero::vaciaCamino () {
+        plano_camino.reset ();
+        ++ version_;
+    }
+
+    bool OcupacionTablero::segmentoValido (Coord celda_origen, Coord celda_destino) const {
+        return tablero_.segmentoValido (
+                CapturaReglas::celda (celda_origen), CapturaReglas::celda (celda_destino), plano_camino);
+    }
+
+    const reglas::TableroReglas::PlanoCeldas & OcupacionTablero::planoCamino () const {
+        return plano_camino;
+    }
+
+    const reglas::TableroReglas & OcupacionTablero::tablero () const {
+        return tablero_;
+    }
+
+    unsigned int OcupacionTablero::version () const {
+        return version_;
+    }
+
+}
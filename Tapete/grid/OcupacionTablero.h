@@ -0,0 +1,132 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  OcupacionTablero.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace tapete {
+
+
+    /*
+     * \class OcupacionTablero
+     * \brief Mapa denso de ocupación de las celdas de la rejilla del tablero.
+     *
+     * Mantiene tres planos de bits, uno por celda de la rejilla: muros, fichas de los personajes y
+     * etapas del camino en curso. Los planos se actualizan de forma incremental al situar los muros,
+     * al mover una ficha y al agregar etapas al camino, de modo que las consultas de ocupación que
+     * hace CalculoCaminos son de tiempo constante en lugar de recorrer las listas completas.
+     *
+     * Los muros y las fichas se guardan en un reglas::TableroReglas, y los segmentos rectos se validan
+     * con él: el tapete y la biblioteca de reglas comparten así una única implementación.
+     *
+     * Junto al plano de fichas guarda qué personaje ocupa cada celda, para recoger los personajes
+     * de un área sin recorrer la lista de personajes por cada celda.
+     */
+    class OcupacionTablero {
+    public:
+        /*!
+         * \brief Número de celdas de la rejilla (filas por columnas).
+         */
+        static constexpr int celdas = RejillaTablero::filas * RejillaTablero::columnas;
+
+        /*!
+         * \brief Calcula el índice lineal de una celda en los planos de ocupación.
+         * \param celda Coordenada de la celda.
+         * \return Índice de la celda, o -1 si está fuera del tablero.
+         */
+        static int indiceCelda (Coord celda);
+
+        /*!
+         * \brief Comprueba si una celda está ocupada por un muro.
+         * \param celda Coordenada de la celda.
+         */
+        bool enMuro   (Coord celda) const;
+
+        /*!
+         * \brief Comprueba si una celda está ocupada por la ficha de un personaje.
+         * \param celda Coordenada de la celda.
+         */
+        bool conFicha (Coord celda) const;
+
+        /*!
+         * \brief Comprueba si una celda es una etapa del camino en curso.
+         * \param celda Coordenada de la celda.
+         */
+        bool enCamino (Coord celda) const;
+
+        /*!
+         * \brief Comprueba si una celda está ocupada por un muro, una ficha o una etapa del camino.
+         * \param celda Coordenada de la celda.
+         */
+        bool ocupada  (Coord celda) const;
+
+        /*!
+         * \brief Devuelve el personaje cuya ficha ocupa una celda.
+         * \param celda Coordenada de la celda.
+         * \return Puntero al personaje, o nullptr si no hay ficha o la celda está fuera del tablero.
+         */
+        ActorPersonaje * personaje (Coord celda) const;
+
+        /*!
+         * \brief Marca una celda como muro.
+         * \param celda Coordenada de la celda.
+         */
+        void ponMuro (Coord celda);
+
+        /*!
+         * \brief Traslada una ficha de una celda a otra.
+         * \param persj Personaje de la ficha.
+         * \param origen Celda que deja la ficha (puede estar fuera del tablero).
+         * \param destino Celda que ocupa la ficha (puede estar fuera del tablero).
+         */
+        void mueveFicha (ActorPersonaje * persj, Coord origen, Coord destino);
+
+        /*!
+         * \brief Marca una celda como etapa del camino en curso.
+         * \param celda Coordenada de la celda.
+         */
+        void ponEtapaCamino (Coord celda);
+
+        /*!
+         * \brief Vacía el plano de etapas del camino.
+         */
+        void vaciaCamino ();
+
+        /*!
+         * \brief Valida un segmento recto entre dos celdas; las etapas del camino cuentan como ocupadas.
+         * \param celda_origen Celda de origen.
+         * \param celda_destino Celda de destino, distinta del origen.
+         * \return true si todas las celdas intermedias están en el tablero y libres.
+         */
+        bool segmentoValido (Coord celda_origen, Coord celda_destino) const;
+
+        /*!
+         * \brief Devuelve el plano de las etapas del camino en curso.
+         */
+        const reglas::TableroReglas::PlanoCeldas & planoCamino () const;
+
+        /*!
+         * \brief Devuelve los muros y las fichas como tablero de las reglas (sin las etapas del camino).
+         */
+        const reglas::TableroReglas & tablero () const;
+
+        /*!
+         * \brief Devuelve la versión del mapa, que cambia con cada modificación de los planos.
+         */
+        unsigned int version () const;
+
+    private:
+
+        reglas::TableroReglas              tablero_     {};
+        reglas::TableroReglas::PlanoCeldas plano_camino {};
+
+        std::array <ActorPersonaje *, celdas> fichas_celda {};
+
+        unsigned int version_ {};
+
+    };
+
+
+}
@@ -46,109 +46,7 @@ namespace tapete {
     }
 
     void RejillaTablero::localizaCelda (Vector punto, Coord & localizada) {
-
-        float x = punto.x ();
-        float y = punto.y ();
-        if (x < 0.0f || y < 0.0f) {
-            localizada = Coord {0, 0};
-            return;
-        }
-
-        x /= RejillaTablero::ladoHexagono;
-        x -= 0.5f;
-
-        int coln_1;
-        if (x < 0.0f) {
-            coln_1 = 1;
-        } else {
-            coln_1 = static_cast <int> (x / 1.5f);
-            coln_1 += 1;
-        }
-        if (coln_1 > RejillaTablero::columnas) {
-            localizada = Coord {0, 0};
-            return;
-        }
-
-        int coln_2;
-        if (x < 0.0f) {
-            coln_2 = 0;
-        } else {
-            float m = std::fmodf (x, 1.5f);
-            if (m <= 1.0f) {
-                coln_2 = 0;
-            } else {
-                if (coln_1 + 1 > RejillaTablero::columnas) {
-                    coln_2 = 0;
-                } else {
-                    coln_2 = coln_1 + 1;
-                }
-            }
-        }
-
-        y /= RejillaTablero::ladoHexagono;
-        y /= RejillaTablero::seno60;
-        int fila_1;
-        int fila_2;
-        fila_1 = static_cast <int> (y);
-        fila_2 = fila_1;
-        if (fila_1 % 2 == 0) {
-            fila_1 ++;
-        } else {
-            fila_2 ++;
-        }
-        if (fila_1 > RejillaTablero::filas) {
-            localizada = Coord {0, 0};
-            return;
-        }
-        if (fila_2 > RejillaTablero::filas - 1) {
-            fila_2 = 0;
-        }
-
-        if (fila_2 == 0 && coln_2 == 0) {
-            if (coln_1 % 2 == 0) {
-                localizada = Coord {0, 0};
-            } else {
-                localizada = Coord {fila_1, coln_1};
-            }
-            return;
-        }
-
-        if (fila_2 == 0) {
-            if (coln_1 % 2 == 0) {
-                localizada = Coord {fila_1, coln_2};
-            } else {
-                localizada = Coord {fila_1, coln_1};
-            }
-            return;
-        }
-
-        if (coln_2 == 0) {
-            if (coln_1 % 2 == 0) {
-                localizada = Coord {fila_2, coln_1};
-            } else {
-                localizada = Coord {fila_1, coln_1};
-            }
-            return;
-        }
-
-        Coord coord_1 {0, 0};
-        Coord coord_2 {0, 0};
-        if (coln_1 % 2 == 0) {
-            coord_1 = Coord {fila_1, coln_2};
-            coord_2 = Coord {fila_2, coln_1};
-        } else {
-            coord_1 = Coord {fila_1, coln_1};
-            coord_2 = Coord {fila_2, coln_2};
-        }
-        Vector punto_1 = RejillaTablero::centroHexagono (coord_1);
-        Vector punto_2 = RejillaTablero::centroHexagono (coord_2);
-        float norma_1 = unir2d::norma (punto_1 - punto);
-        float norma_2 = unir2d::norma (punto_2 - punto);
-        if (norma_1 < norma_2) {
-            localizada = coord_1;
-        } else {
-            localizada = coord_2;
-        }
+        localizada = CapturaReglas::coord (reglas::TableroReglas::localizaCelda (punto.x (), punto.y ()));
     }
 
     void RejillaTablero::prepara () {
@@ -194,9 +92,15 @@ namespace tapete {
 
         trazos_marcaje = new unir2d::Trazos {};
         trazos_marcaje->ponPosicion (PresenciaTablero::regionRejilla.posicion ());
+        marcaje_celdas.fill (MarcajeCelda {Color {0, 0, 0, 0}, false, false});
+        ranura_celda.fill (-1);
+        posicion_marcada.fill (-1);
+        celdas_ranura.clear ();
+        celdas_marcadas.clear ();
+        celdas_cambiadas.clear ();
         cambio_trazos_marcaje = false;
 
-        actor_tablero->agregaDibujo (trazos_rejilla);
+        // la rejilla no cambia: PresenciaTablero la compone en su capa fija en lugar de dibujarla
         actor_tablero->agregaDibujo (trazos_marcaje);
     }
 
@@ -212,84 +116,153 @@ namespace tapete {
     }
 
     void RejillaTablero::marcaCelda (Coord posicion, Color color, bool grueso) {
-        std::vector <MarcajeCelda>::iterator iter = buscaMarcaCelda (posicion);
-        if (iter != marcaje_celdas.end ()) {
-            iter->color  = color;
-            iter->grueso = grueso;
-        } else {
-            MarcajeCelda marcj {posicion, color, grueso};
-            marcaje_celdas.push_back (marcj);
+        // como en la rejilla, solo hay hexágono donde la fila y la columna tienen la misma paridad
+        int indc = OcupacionTablero::indiceCelda (posicion);
+        if (indc < 0 || (posicion.fila () + posicion.coln ()) % 2 != 0) {
+            return;
+        }
+        MarcajeCelda & marcj = marcaje_celdas [indc];
+        if (! marcj.marcada) {
+            posicion_marcada [indc] = static_cast <int> (celdas_marcadas.size ());
+            celdas_marcadas.push_back (posicion);
+        }
+        marcj = MarcajeCelda {color, true, grueso};
+        cambiaMarcaje (indc);
+    }
+
+    void RejillaTablero::marcaCeldas (const std::vector <Coord> & posiciones, Color color, bool grueso) {
+        for (Coord posicion : posiciones) {
+            marcaCelda (posicion, color, grueso);
         }
-        cambio_trazos_marcaje = true;
     }
 
     void RejillaTablero::desmarcaCelda (Coord posicion) {
-        std::vector <MarcajeCelda>::iterator iter = buscaMarcaCelda (posicion);
-        if (iter == marcaje_celdas.end ()) {
+        int indc = OcupacionTablero::indiceCelda (posicion);
+        if (indc < 0 || ! marcaje_celdas [indc].marcada) {
             return;
         }
-        marcaje_celdas.erase (iter);
-        cambio_trazos_marcaje = true;
+        marcaje_celdas [indc].marcada = false;
+        // la última celda de la lista ocupa el hueco de la que se desmarca
+        int posicion_hueco = posicion_marcada [indc];
+        Coord ultima = celdas_marcadas.back ();
+        celdas_marcadas [posicion_hueco] = ultima;
+        posicion_marcada [OcupacionTablero::indiceCelda (ultima)] = posicion_hueco;
+        celdas_marcadas.pop_back ();
+        posicion_marcada [indc] = -1;
+        cambiaMarcaje (indc);
     }
 
-    void RejillaTablero::desmarcaCeldas () {
-        marcaje_celdas.clear ();
-        cambio_trazos_marcaje = true;
+    void RejillaTablero::desmarcaCeldas (const std::vector <Coord> & posiciones) {
+        for (Coord posicion : posiciones) {
+            desmarcaCelda (posicion);
+        }
     }
 
-    std::vector <RejillaTablero::MarcajeCelda>::iterator RejillaTablero::buscaMarcaCelda (Coord posicion) {
-        for (std::vector <MarcajeCelda>::iterator iter = marcaje_celdas.begin (); iter < marcaje_celdas.end (); ++ iter) {
-            if (iter->posicion == posicion) {
-                return iter;
-            }
+    void RejillaTablero::desmarcaCeldas () {
+        for (Coord posicion : celdas_marcadas) {
+            int indc = OcupacionTablero::indiceCelda (posicion);
+            marcaje_celdas   [indc].marcada = false;
+            posicion_marcada [indc]         = -1;
+            cambiaMarcaje (indc);
         }
-        return marcaje_celdas.end (); 
+        celdas_marcadas.clear ();
+    }
+
+    void RejillaTablero::cambiaMarcaje (int indice) {
+        celdas_cambiadas.push_back (indice);
+        cambio_trazos_marcaje = true;
     }
 
     void RejillaTablero::refrescaMarcaje () {
         if (! cambio_trazos_marcaje) {
             return;
         }
+        cambio_trazos_marcaje = false;
+        for (int indc : celdas_cambiadas) {
+            if (ranura_celda [indc] >= 0) {
+                coloreaRanura (indc);
+            } else if (marcaje_celdas [indc].marcada) {
+                agregaRanura (indc);
+            }
+        }
+        celdas_cambiadas.clear ();
+        // cada fotograma dibuja todas las ranuras, también las transparentes: se compactan cuando
+        // las libres superan a las marcadas, así que el coste queda repartido entre los desmarcados
+        int ranuras_libres = static_cast <int> (celdas_ranura.size () - celdas_marcadas.size ());
+        if (ranuras_libres > static_cast <int> (celdas_marcadas.size ()) + ranurasLibres) {
+            compactaRanuras ();
+        }
+    }
+
+    void RejillaTablero::agregaRanura (int indice) {
+        ranura_celda [indice] = static_cast <int> (celdas_ranura.size ());
+        celdas_ranura.push_back (indice);
+        Coord posicion {indice / columnas + 1, indice % columnas + 1};
+        trazaHexagono (posicion, marcaje_celdas [indice]);
+    }
+
+    void RejillaTablero::compactaRanuras () {
+        for (int indc : celdas_ranura) {
+            ranura_celda [indc] = -1;
+        }
+        celdas_ranura.clear ();
         trazos_marcaje->borraLineas ();
-        for (MarcajeCelda marcj : marcaje_celdas) {
-            trazaHexagono (marcj);
+        for (Coord posicion : celdas_marcadas) {
+            agregaRanura (OcupacionTablero::indiceCelda (posicion));
+        }
+    }
+
+    void RejillaTablero::coloreaRanura (int indice) {
+        const MarcajeCelda & marcj = marcaje_celdas [indice];
+        int primera = ranura_celda [indice] * lineasRanura;
+        for (int indc = 0; indc < lineasRanura; ++ indc) {
+            trazos_marcaje->ponColorLinea (primera + indc, colorLinea (marcj, indc >= lineasRanura / 2));
         }
     }
 
-    void RejillaTablero::trazaHexagono (const MarcajeCelda & marcaje) {
-        Vector centro = centroHexagono (marcaje.posicion);
-        Vector punto1 = verticeHexagono (marcaje.posicion, 1);
-        Vector punto2 = verticeHexagono (marcaje.posicion, 2);
-        Vector punto3 = verticeHexagono (marcaje.posicion, 3);
-        Vector punto4 = verticeHexagono (marcaje.posicion, 4);
-        Vector punto5 = verticeHexagono (marcaje.posicion, 5);
-        Vector punto6 = verticeHexagono (marcaje.posicion, 6);
+    Color RejillaTablero::colorLinea (const MarcajeCelda & marcaje, bool gruesa) {
+        if (! marcaje.marcada || (gruesa && ! marcaje.grueso)) {
+            return Color {0, 0, 0, 0};
+        }
+        return marcaje.color;
+    }
+
+    void RejillaTablero::trazaHexagono (Coord posicion, const MarcajeCelda & marcaje) {
+        Vector centro = centroHexagono (posicion);
+        Vector punto1 = verticeHexagono (posicion, 1);
+        Vector punto2 = verticeHexagono (posicion, 2);
+        Vector punto3 = verticeHexagono (posicion, 3);
+        Vector punto4 = verticeHexagono (posicion, 4);
+        Vector punto5 = verticeHexagono (posicion, 5);
+        Vector punto6 = verticeHexagono (posicion, 6);
         punto1 += Vector { 1,  1};
         punto2 += Vector {-1,  1};
         punto3 += Vector {-1,  0};
         punto4 += Vector { 0, -1};
         punto5 += Vector { 0, -1};
         punto6 += Vector { 1,  0};
-        trazos_marcaje->agrega (unir2d::TrazoLinea {punto1, punto2, marcaje.color});    
-        trazos_marcaje->agrega (unir2d::TrazoLinea {punto2, punto3, marcaje.color});
-        trazos_marcaje->agrega (unir2d::TrazoLinea {punto3, punto4, marcaje.color});
-        trazos_marcaje->agrega (unir2d::TrazoLinea {punto4, punto5, marcaje.color});    
-        trazos_marcaje->agrega (unir2d::TrazoLinea {punto5, punto6, marcaje.color});
-        trazos_marcaje->agrega (unir2d::TrazoLinea {punto6, punto1, marcaje.color});
-        if (marcaje.grueso) {
-            punto1 += Vector { 0,  1};
-            punto2 += Vector { 0,  1};
-            punto3 += Vector {-1,  0};
-            punto4 += Vector { 0, -1};
-            punto5 += Vector { 0, -1};
-            punto6 += Vector { 1,  0};
-            trazos_marcaje->agrega (unir2d::TrazoLinea {punto1, punto2, marcaje.color});    
-            trazos_marcaje->agrega (unir2d::TrazoLinea {punto2, punto3, marcaje.color});
-            trazos_marcaje->agrega (unir2d::TrazoLinea {punto3, punto4, marcaje.color});
-            trazos_marcaje->agrega (unir2d::TrazoLinea {punto4, punto5, marcaje.color});    
-            trazos_marcaje->agrega (unir2d::TrazoLinea {punto5, punto6, marcaje.color});
-            trazos_marcaje->agrega (unir2d::TrazoLinea {punto6, punto1, marcaje.color});
-        }
+        Color color = colorLinea (marcaje, false);
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto1, punto2, color});    
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto2, punto3, color});
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto3, punto4, color});
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto4, punto5, color});    
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto5, punto6, color});
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto6, punto1, color});
+        // las líneas del marcado grueso se trazan siempre, transparentes si no se ven, para que
+        // cambiar de grosor sea solo cambiar de color
+        color = colorLinea (marcaje, true);
+        punto1 += Vector { 0,  1};
+        punto2 += Vector { 0,  1};
+        punto3 += Vector {-1,  0};
+        punto4 += Vector { 0, -1};
+        punto5 += Vector { 0, -1};
+        punto6 += Vector { 1,  0};
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto1, punto2, color});    
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto2, punto3, color});
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto3, punto4, color});
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto4, punto5, color});    
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto5, punto6, color});
+        trazos_marcaje->agrega (unir2d::TrazoLinea {punto6, punto1, color});
     }
 
 }
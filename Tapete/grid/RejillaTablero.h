@@ -16,6 +16,14 @@ namespace tapete {
      * Proporciona utilidades para calcular posiciones y vértices de hexágonos, localizar celdas a partir de coordenadas,
      * y marcar/desmarcar celdas con distintos colores y grosores. Permite la gestión visual y lógica de la rejilla
      * sobre la que se desarrolla el juego.
+     *
+     * La rejilla se traza una vez y PresenciaTablero la compone, con el fondo y los muros, en su capa fija. El
+     * marcado guarda los atributos de cada celda (color, marcada, grueso) en un arreglo indexado como
+     * OcupacionTablero, y marcar o desmarcar una celda solo cambia el color de las líneas de su ranura. Las ranuras
+     * no se trazan para todo el tablero al preparar la rejilla: unir2d::Trazos dibuja todas sus líneas, también
+     * las transparentes, y unas 15.000 líneas por fotograma costaban más que el marcado que ahorraban. Se trazan
+     * al marcar cada celda por primera vez y se compactan cuando sobran, de modo que el coste por fotograma sigue
+     * a las celdas marcadas.
      */
     class RejillaTablero {
     public:
@@ -58,7 +66,8 @@ namespace tapete {
         static Vector verticeHexagono(Coord centro, int minuto);
 
         /*!
-         * \brief Localiza la celda más cercana a un punto dado.
+         * \brief Localiza la celda que contiene un punto dado, con reglas::TableroReglas::localizaCelda.
+         *        Los puntos del margen dan una celda del borde.
          * \param punto Punto de referencia.
          * \param localizada Coordenada de la celda localizada (salida).
          */
@@ -79,12 +88,26 @@ namespace tapete {
          */
         void marcaCelda(Coord posicion, Color color, bool grueso);
 
+        /*!
+         * \brief Marca un conjunto de celdas con el mismo color y grosor.
+         * \param posiciones Coordenadas de las celdas.
+         * \param color Color de marcado.
+         * \param grueso Si el marcado es grueso.
+         */
+        void marcaCeldas(const std::vector<Coord> &posiciones, Color color, bool grueso);
+
         /*!
          * \brief Desmarca una celda.
          * \param posicion Coordenada de la celda.
          */
         void desmarcaCelda(Coord posicion);
 
+        /*!
+         * \brief Desmarca un conjunto de celdas; las que no están marcadas se ignoran.
+         * \param posiciones Coordenadas de las celdas.
+         */
+        void desmarcaCeldas(const std::vector<Coord> &posiciones);
+
         /*!
          * \brief Desmarca todas las celdas.
          */
@@ -106,19 +129,53 @@ namespace tapete {
          */
         unir2d::Trazos *trazos_rejilla{};
 
+        /*!
+         * \brief Líneas de la ranura de una celda: seis del hexágono y seis más para el marcado grueso.
+         */
+        static constexpr int lineasRanura = 12;
+        /*!
+         * \brief Ranuras sin marcar que se toleran, además de tantas como celdas marcadas, antes de
+         * compactar trazos_marcaje.
+         */
+        static constexpr int ranurasLibres = 64;
+
         /*!
          * \struct MarcajeCelda
-         * \brief Estructura para almacenar información de marcado de celdas.
+         * \brief Atributos de marcado de una celda.
          */
         struct MarcajeCelda {
-            Coord posicion;
             Color color;
+            bool  marcada;
             bool  grueso;
         };
         /*!
-         * \brief Vector de celdas marcadas.
+         * \brief Marcado de cada celda; se indexa con OcupacionTablero::indiceCelda.
+         */
+        std::array<MarcajeCelda, filas * columnas> marcaje_celdas{};
+        /*!
+         * \brief Ranura de cada celda en trazos_marcaje, o -1 si la celda no tiene.
+         *
+         * La ranura se traza la primera vez que se marca la celda y se conserva al desmarcarla, con las
+         * líneas transparentes; volver a marcarla o cambiar su color o su grosor solo cambia el color
+         * de sus líneas.
+         */
+        std::array<int, filas * columnas> ranura_celda{};
+        /*!
+         * \brief Celda (índice) de cada ranura de trazos_marcaje.
+         */
+        std::vector<int> celdas_ranura{};
+        /*!
+         * \brief Celdas marcadas, sin orden; con posicion_marcada se quitan en tiempo constante.
          */
-        std::vector<MarcajeCelda> marcaje_celdas{};
+        std::vector<Coord> celdas_marcadas{};
+        /*!
+         * \brief Posición de cada celda en celdas_marcadas, o -1 si no está marcada.
+         */
+        std::array<int, filas * columnas> posicion_marcada{};
+        /*!
+         * \brief Celdas cuyo marcado ha cambiado desde el último refresco; puede haber repetidas.
+         */
+        std::vector<int> celdas_cambiadas{};
 
         /*!
          * \brief Trazos gráficos para el marcado.
@@ -152,22 +209,48 @@ namespace tapete {
         void libera();
 
         /*!
-         * \brief Busca una celda marcada en el vector de marcaje.
-         * \param posicion Coordenada de la celda.
-         * \return Iterador al elemento encontrado o marcaje_celdas.end().
+         * \brief Anota que ha cambiado el marcado de una celda.
+         * \param indice Índice de la celda.
          */
-        std::vector<MarcajeCelda>::iterator buscaMarcaCelda(Coord posicion);
+        void cambiaMarcaje(int indice);
 
         /*!
-         * \brief Refresca el marcado de celdas en pantalla.
+         * \brief Refresca el marcado de celdas en pantalla: cambia el color de las ranuras de las
+         * celdas que han cambiado y traza las de las celdas que se marcan por primera vez. Si quedan
+         * demasiadas ranuras sin marcar, vuelve a trazar solo las de las celdas marcadas.
          */
         void refrescaMarcaje();
 
         /*!
-         * \brief Traza un hexágono en pantalla según el marcaje.
+         * \brief Traza la ranura de una celda al final de los trazos de marcado.
+         * \param indice Índice de la celda.
+         */
+        void agregaRanura(int indice);
+
+        /*!
+         * \brief Vuelve a trazar los trazos de marcado con una ranura por cada celda marcada.
+         */
+        void compactaRanuras();
+
+        /*!
+         * \brief Pone a las líneas de la ranura de una celda el color de su marcado.
+         * \param indice Índice de la celda.
+         */
+        void coloreaRanura(int indice);
+
+        /*!
+         * \brief Color de una línea de una ranura: el del marcado, o transparente si no se ve.
+         * \param marcaje Información de marcado de la celda.
+         * \param gruesa Si la línea es del marcado grueso.
+         */
+        static Color colorLinea(const MarcajeCelda &marcaje, bool gruesa);
+
+        /*!
+         * \brief Agrega las líneas de la ranura de una celda a los trazos de marcado.
+         * \param posicion Coordenada de la celda.
          * \param marcaje Información de marcado de la celda.
          */
-        void trazaHexagono(const MarcajeCelda &marcaje);
+        void trazaHexagono(Coord posicion, const MarcajeCelda &marcaje);
 
 
         friend class ActorTablero;
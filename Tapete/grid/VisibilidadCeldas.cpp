@@ -0,0 +1,41 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   VisibilidadCeldas.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete {
+
+    bool VisibilidadCeldas::vigente (Coord celda_origen, unsigned int version_ocupacion) const {
+        return calculado_                                    &&
+               this->celda_origen      == celda_origen       &&
+               this->version_ocupacion == version_ocupacion;
+    }
+
+    void VisibilidadCeldas::calcula (JuegoMesaBase * juego, Coord celda_origen) {
+        const OcupacionTablero & ocupacion = juego->tablero ()->ocupacion ();
+        this->celda_origen      = celda_origen;
+        this->version_ocupacion = ocupacion.version ();
+        calculado_              = true;
+        ocupacion.tablero ().celdasVisibles (
+                CapturaReglas::celda (celda_origen), ocupacion.planoCamino (), celdas_visibles);
+    }
+
+    bool VisibilidadCeldas::visible (Coord celda) const {
+        aserta (calculado_,            "mapa de visibilidad no calculado");
+        aserta (celda != celda_origen, "segmento de camino nulo");
+        int indc = OcupacionTablero::indiceCelda (celda);
+        if (indc < 0) {
+            return false;
+        }
+        return celdas_visibles.test (indc);
+    }
+
+    void VisibilidadCeldas::aserta (bool expresion, const string & mensaje) {
+        if (expresion) {
+            return;
+        }
+        throw std::logic_error (mensaje);
+    }
+
+}
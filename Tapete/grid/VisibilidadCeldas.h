@@ -0,0 +1,61 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  VisibilidadCeldas.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace tapete {
+
+
+    class JuegoMesaBase;
+
+
+    /*
+     * \class VisibilidadCeldas
+     * \brief Mapa de las celdas del tablero visibles desde una celda de origen.
+     *
+     * Una celda es visible cuando CalculoCaminos::segmentoValido acepta el segmento desde el origen,
+     * es decir, cuando todas las celdas intermedias del recorrido están libres. El mapa lo calcula
+     * reglas::TableroReglas::celdasVisibles para todo el tablero: un avance por cada dirección exacta
+     * y un recorrido por cada una de las demás celdas alcanzables. Se conserva mientras no cambien el
+     * origen ni la ocupación, de modo que las consultas posteriores cuestan una lectura de bit.
+     */
+    class VisibilidadCeldas {
+    public:
+        /*!
+         * \brief Comprueba si el mapa corresponde a los datos indicados.
+         * \param celda_origen Celda de origen.
+         * \param version_ocupacion Versión actual del mapa de ocupación.
+         */
+        bool vigente (Coord celda_origen, unsigned int version_ocupacion) const;
+
+        /*!
+         * \brief Calcula el mapa de visibilidad.
+         * \param juego Puntero al juego.
+         * \param celda_origen Celda de origen.
+         */
+        void calcula (JuegoMesaBase * juego, Coord celda_origen);
+
+        /*!
+         * \brief Comprueba si una celda del tablero es visible desde el origen.
+         * \param celda Celda del tablero distinta del origen.
+         * \return true si es visible, false en caso contrario.
+         */
+        bool visible (Coord celda) const;
+
+    private:
+
+        bool         calculado_ {};
+        Coord        celda_origen {};
+        unsigned int version_ocupacion {};
+
+        reglas::TableroReglas::PlanoCeldas celdas_visibles {};
+
+        static void aserta (bool expresion, const string & mensaje);
+
+    };
+
+
+}
@@ -48,6 +48,13 @@ namespace tapete {
         return lado_equipo_actual;
     }
 
+    LadoTablero ModoJuegoBase::ladoMueve () const {
+        if (atacante_ != nullptr) {
+            return atacante_->ladoTablero ();
+        }
+        return lado_equipo_actual;
+    }
+
     const std::vector <ActorPersonaje * > & ModoJuegoBase::factoresEquipos () const {
         return factores_equipos;
     }
@@ -90,6 +97,20 @@ namespace tapete {
         return area_celdas;
     }
 
+    int ModoJuegoBase::puntosAccionRonda (const ActorPersonaje * personaje) {
+        const std::wstring & nombre = personaje->nombre ();
+        if (nombre == L"Dorian" || nombre == L"Buenavida") {
+            return 8;
+        }
+        if (nombre == L"Balthazar" || nombre == L"Luciana") {
+            return 12;
+        }
+        if (nombre == L"Edward" || nombre == L"Victoria") {
+            return 14;
+        }
+        return ActorPersonaje::maximoPuntosAccion;
+    }
+
     bool ModoJuegoBase::cuentaPersonajesIgual () {
         int lado_izqrd = 0;
         int lado_derch = 0;
@@ -106,9 +127,9 @@ namespace tapete {
     void ModoJuegoBase::iniciaRondas () {
         iniciaPersonajes ();
         restauraPersonajes ();
-        ronda_  = 1;
-        turno_  = 1;
-        jugada_ = 1;
+        cambiaContador (ronda_,  1, ClavePartida::Rasgo::ronda);
+        cambiaContador (turno_,  1, ClavePartida::Rasgo::turno);
+        cambiaContador (jugada_, 1, ClavePartida::Rasgo::jugada);
         if (trazar_avance) {
             std::cout << std::endl;
             std::cout << "Ronda = "  << ronda_  << "  ";
@@ -118,7 +139,7 @@ namespace tapete {
     }
 
     void ModoJuegoBase::avanzaJugada () {
-        jugada_ ++;
+        cambiaContador (jugada_, jugada_ + 1, ClavePartida::Rasgo::jugada);
         if (trazar_avance) {
             std::cout << std::endl;
             std::cout << "Ronda = "  << ronda_  << "  ";
@@ -128,8 +149,8 @@ namespace tapete {
     }
 
     void ModoJuegoBase::avanzaTurno () {
-        turno_ ++;
-        jugada_ = 1;
+        cambiaContador (turno_,  turno_ + 1, ClavePartida::Rasgo::turno);
+        cambiaContador (jugada_, 1,          ClavePartida::Rasgo::jugada);
         if (trazar_avance) {
             std::cout << std::endl;
             std::cout << "Ronda = "  << ronda_  << "  ";
@@ -140,9 +161,9 @@ namespace tapete {
 
     void ModoJuegoBase::avanzaRonda () {
         restauraPersonajes ();
-        ronda_ ++;
-        turno_ = 1;
-        jugada_ = 1;
+        cambiaContador (ronda_,  ronda_ + 1, ClavePartida::Rasgo::ronda);
+        cambiaContador (turno_,  1,          ClavePartida::Rasgo::turno);
+        cambiaContador (jugada_, 1,          ClavePartida::Rasgo::jugada);
         if (trazar_avance) {
             std::cout << std::endl;
             std::cout << "Ronda = "  << ronda_  << "  ";
@@ -203,7 +224,9 @@ namespace tapete {
 
         aserta (atacante_ == nullptr, "asignaEquipoActual", "atacante asignado");
 
+        LadoTablero lado_mueve = ladoMueve ();
         lado_equipo_actual = lado_tablero;
+        avisaLadoMueve (lado_mueve);
     }
 
     void ModoJuegoBase::estableceFactoresEquipos () {
@@ -304,9 +327,11 @@ namespace tapete {
                                       "estableceAtacante", "personaje no elegido en su lado");
         aserta (atacante_ == nullptr, "estableceAtacante", "atacante asignado");
 
+        LadoTablero lado_mueve = ladoMueve ();
         atacante_        = personajeElegido (lado_tablero);
+        avisaLadoMueve (lado_mueve);
         modo_accion      = ModoAccionPersonaje::Nulo;
-        etapas_camino    .clear ();
+        vaciaEtapasCamino ();
         habilidad_accion = nullptr;
         oponente_        = nullptr; 
         area_celdas      .clear ();
@@ -333,7 +358,7 @@ namespace tapete {
         area_celdas      .clear ();
         oponente_        = nullptr; 
         habilidad_accion = nullptr;
-        etapas_camino    .clear ();
+        vaciaEtapasCamino ();
         modo_accion      = ModoAccionPersonaje::Nulo; 
 
         PresenciaActuante & presnc_opone = juego_->tablero ()->presencia (opuesto (atacante_->ladoTablero ()));
@@ -343,7 +368,9 @@ namespace tapete {
         presnc_ataca.oculta ();
         juego_->tablero ()->rejilla ().desmarcaCeldas ();
 
+        LadoTablero lado_mueve = ladoMueve ();
         atacante_ = nullptr;
+        avisaLadoMueve (lado_mueve);
     }
 
     void ModoJuegoBase::reiniciaAtacante () {
@@ -352,7 +379,7 @@ namespace tapete {
         area_celdas      .clear ();
         oponente_        = nullptr; 
         habilidad_accion = nullptr;
-        etapas_camino    .clear ();
+        vaciaEtapasCamino ();
         modo_accion      = ModoAccionPersonaje::Nulo; 
 
         PresenciaActuante & presnc_opone = juego_->tablero ()->presencia (opuesto (atacante_->ladoTablero ()));
@@ -428,7 +455,8 @@ namespace tapete {
         aserta (modo_accion == ModoAccionPersonaje::Desplazamiento,
                                                 "iniciaCamino", "modo de acción inválido");
 
-        etapas_camino.push_back (atacante_->sitioFicha ());
+        agregaEtapa (atacante_->sitioFicha ());
+        marcaAlcanceCamino ();
         juego_->tablero ()->vistaCamino ().arrancaCamino ();
     }
 
@@ -440,25 +468,44 @@ namespace tapete {
         aserta (modo_accion == ModoAccionPersonaje::Desplazamiento,
                                                 "validaEtapaCamino", "modo de acción inválido");
 
-        if (! CalculoCaminos::celdaEnTablero (proxima_celda)) {
-            etapa_valida = false;
-            return;
+        actualizaAlcanceMovimiento ();
+        alcance_movimiento.consulta (proxima_celda, etapa_valida, puntos_en_juego);
+        assert (! etapa_valida || puntos_en_juego == puntosEnJuegoCamino (proxima_celda));
+    }
+
+    bool ModoJuegoBase::calculaCaminoOptimo (
+            Coord celda_destino, std::vector <Coord> & etapas, int & puntos_en_juego) {
+
+        aserta (atacante_ != nullptr,           "calculaCaminoOptimo", "atacante no asignado");
+        aserta (atacante_->puntosAccion () > 0, "calculaCaminoOptimo", "atacante agotado");
+
+        Coord celda_origen = atacante_->sitioFicha ();
+        if (etapas_camino.size () > 0) {
+            celda_origen = etapas_camino.back ();
         }
-        if (CalculoCaminos::celdaOcupada (juego_, proxima_celda)) {
-            etapa_valida = false;
-            return;
+        if (! buscador_caminos.busca (juego_, celda_origen, celda_destino, etapas)) {
+            return false;
         }
-        if (! CalculoCaminos::etapaValidaCamino (juego_, proxima_celda)) {
-            etapa_valida = false;
-            return;
+        // se acumula etapa a etapa, como en 'agregaEtapa', para que el redondeo sea el mismo
+        reglas::DistanciaCamino distancia_optima = distancia_camino;
+        if (distancia_optima.vacio ()) {
+            distancia_optima.agrega (CapturaReglas::celda (celda_origen));
         }
-
-        puntos_en_juego = puntosEnJuegoCamino (proxima_celda);
-        if (puntos_en_juego > atacante_->puntosAccion ()) {
-            etapa_valida = false;
-            return;
+        for (int indc = 1; indc < etapas.size (); ++ indc) {
+            distancia_optima.agrega (CapturaReglas::celda (etapas [indc]));
         }
-        etapa_valida = true;
+        puntos_en_juego = distancia_optima.puntos (puntosAccionDeDesplaza ());
+        return true;
+    }
+
+    const std::vector <Coord> & ModoJuegoBase::celdasAlcanceCamino () {
+
+        aserta (atacante_ != nullptr,           "celdasAlcanceCamino", "atacante no asignado");
+        aserta (modo_accion == ModoAccionPersonaje::Desplazamiento,
+                                                "celdasAlcanceCamino", "modo de acción inválido");
+
+        actualizaAlcanceMovimiento ();
+        return alcance_movimiento.celdasAlcanzables ();
     }
 
     void ModoJuegoBase::marcaCeldaCamino (Coord proxima_celda, bool etapa_valida) {
@@ -489,7 +536,8 @@ namespace tapete {
         aserta (modo_accion == ModoAccionPersonaje::Desplazamiento,
                                                 "agregaEtapaCamino", "modo de acción inválido");
 
-        etapas_camino.push_back (proxima_celda);
+        agregaEtapa (proxima_celda);
+        marcaAlcanceCamino ();
         juego_->tablero ()->vistaCamino ().fijaCeldaEtapa ();
 
         atacante_->ponPuntosAccionEnJuego (puntos_en_juego);
@@ -508,7 +556,7 @@ namespace tapete {
         juego_->tablero ()->rejilla ().desmarcaCelda (atacante_->sitioFicha ());
         Coord nuevo_sitio = etapas_camino.back ();
         atacante_->ponSitioFicha (nuevo_sitio);
-        etapas_camino.clear ();
+        vaciaEtapasCamino ();
         juego_->tablero ()->vistaCamino ().vaciaCamino ();
         juego_->tablero ()->rejilla ().marcaCelda (atacante_->sitioFicha (), ModoJuegoBase::color_atacante, false);
         atacante_->ponPuntosAccion (atacante_->puntosAccion () - atacante_->puntosAccionEnJuego ());
@@ -533,7 +581,7 @@ namespace tapete {
         aserta (modo_accion == ModoAccionPersonaje::Desplazamiento,
                                                 "anulaCamino", "modo de acción inválido");
 
-        etapas_camino.clear ();
+        vaciaEtapasCamino ();
         juego_->tablero ()->vistaCamino ().vaciaCamino ();
         atacante_->ponPuntosAccionEnJuego (0);
         LadoTablero lado_atacante = atacante_->ladoTablero ();
@@ -542,7 +590,13 @@ namespace tapete {
 
     void ModoJuegoBase::alea100 () {
 
+        valor_aleatorio_100 = static_cast <int> (juego_->azar ().cosmetico ().entero (100));
+    }
+
+    void ModoJuegoBase::tiraAleatorio100 () {
+
         valor_aleatorio_100 = azarosa (100);
+        muestraAleatorio100 ();
     }
 
     void ModoJuegoBase::muestraAleatorio100 () {
@@ -698,15 +752,13 @@ void ModoJuegoBase::validaHabilidadSimple (bool & uso_valido, int & puntos_en_ju
 
         puntos_en_juego = habilidad_accion->coste ();
 
-        float distn = distanciaCeldas (oponente_->sitioFicha (), atacante_->sitioFicha ()); 
-        if (distn > habilidad_accion->alcance ()) {
+        if (! enAlcanceHabilidad (oponente_->sitioFicha ())) {
             acceso_valido = false;
             return;
         }
 
         if (habilidadAccion ()->tipoAcceso () == AccesoHabilidad::directo) {
-            if (! CalculoCaminos::segmentoValido (
-                    juego_, atacante_->sitioFicha (), oponente_->sitioFicha ())) {
+            if (! accesoDirecto (oponente_->sitioFicha ())) {
                 acceso_valido = false;
                 return;
             }
@@ -829,25 +881,15 @@ void ModoJuegoBase::validaHabilidadSimple (bool & uso_valido, int & puntos_en_ju
 
         puntos_en_juego = habilidad_accion->coste ();
 
-        Coord celda_area = area_celdas [0] [0];
+        Coord celda_area = area_celdas [0];
 
-        if (! CalculoCaminos::celdaEnTablero (celda_area)) {
-            acceso_valido = false;
-            return;
-        }
-        if (CalculoCaminos::celdaEnMuro (juego_, celda_area)) {
-            acceso_valido = false;
-            return;
-        }
-
-        float distn = distanciaCeldas (celda_area, atacante_->sitioFicha ()); 
-        if (distn > habilidad_accion->alcance ()) {
+        if (! enAlcanceHabilidad (celda_area)) {
             acceso_valido = false;
             return;
         }
 
         if (habilidadAccion ()->tipoAcceso () == AccesoHabilidad::directo) {
-            if (! CalculoCaminos::segmentoValido (juego_, atacante_->sitioFicha (), celda_area)) {
+            if (! accesoDirecto (celda_area)) {
                 acceso_valido = false;
                 return;
             }
@@ -869,7 +911,7 @@ void ModoJuegoBase::validaHabilidadSimple (bool & uso_valido, int & puntos_en_ju
             VistaCaminoCeldas & vista_camino = juego_->tablero ()->vistaCamino ();
             vista_camino.marcaCeldaInicio (atacante_->sitioFicha ());
             vista_camino.arrancaCamino ();
-            Coord celda_area = area_celdas [0] [0];
+            Coord celda_area = area_celdas [0];
             vista_camino.marcaCeldaEtapa (celda_area, acceso_valido, atacante_->sitioFicha ());
         }
 
@@ -899,11 +941,10 @@ void ModoJuegoBase::validaHabilidadSimple (bool & uso_valido, int & puntos_en_ju
 
         asertaHabilidadArea ("atacaArea", true);
 
-        std::vector <ActorPersonaje *> lista_oponentes {};
-        personajesAreaCeldas (lista_oponentes);
+        personajesAreaCeldas (oponentes_area);
 
         juego_->sistemaAtaque ().calcula (
-                atacante_, habilidad_accion, lista_oponentes, valor_aleatorio_100);
+                atacante_, habilidad_accion, oponentes_area, valor_aleatorio_100);
 
         desmarcaCeldasArea ();
         if (habilidadAccion ()->tipoAcceso () == AccesoHabilidad::directo) {
@@ -1004,14 +1045,16 @@ void ModoJuegoBase::validaHabilidadSimple (bool & uso_valido, int & puntos_en_ju
     }
 
     void ModoJuegoBase::anulaTotalmente () {
+        LadoTablero lado_mueve = ladoMueve ();
         lado_equipo_inicial = LadoTablero::nulo;
         lado_equipo_actual  = LadoTablero::nulo;
         factores_equipos.clear ();
         personaje_elegido_izqrd = nullptr;
         personaje_elegido_derch = nullptr;
         atacante_ = nullptr;
+        avisaLadoMueve (lado_mueve);
         modo_accion = ModoAccionPersonaje::Nulo;
-        etapas_camino.clear ();
+        vaciaEtapasCamino ();
         juego_->tablero ()->vistaCamino ().vaciaCamino ();
         habilidad_accion = nullptr;
         oponente_ = nullptr;
@@ -1019,63 +1062,101 @@ void ModoJuegoBase::validaHabilidadSimple (bool & uso_valido, int & puntos_en_ju
     }
 
     int ModoJuegoBase::azarosa (unsigned int contador) {
-	    std::random_device semilla {};
-        std::mt19937 generador {semilla ()};
-	    std::uniform_int_distribution <unsigned int> distrb {0, contador - 1};
-        return distrb (generador);
+        return static_cast <int> (juego_->azar ().partida ().entero (contador));
     }
 
-    int ModoJuegoBase::puntosEnJuegoCamino (Coord proxima_celda) const {
-        float distn = 0.0f;
-        for (int indc = 0; indc < etapas_camino.size (); ++ indc) {
-            Coord previa = etapas_camino [indc];
-            Coord etapa;
-            if (indc == etapas_camino.size () - 1) {
-                etapa = proxima_celda;
-            } else {
-                etapa = etapas_camino [indc + 1];
-            }
-            distn += unir2d::norma (
-                    RejillaTablero::centroHexagono (etapa) -
-                    RejillaTablero::centroHexagono (previa) );
+    void ModoJuegoBase::cambiaContador (int & contador, int valor, ClavePartida::Rasgo rasgo) {
+        int anterior = contador;
+        contador = valor;
+        juego_->clavePartida ().cambia (rasgo, 0, anterior, contador);
+    }
+
+    void ModoJuegoBase::avisaLadoMueve (LadoTablero anterior) {
+        juego_->clavePartida ().cambia (
+                ClavePartida::Rasgo::ladoMueve, 0, static_cast <int> (anterior), static_cast <int> (ladoMueve ()) );
+    }
+
+    void ModoJuegoBase::agregaEtapa (Coord celda) {
+        distancia_camino.agrega (CapturaReglas::celda (celda));
+        etapas_camino.push_back (celda);
+        juego_->tablero ()->ocupacion ().ponEtapaCamino (celda);
+    }
+
+    void ModoJuegoBase::vaciaEtapasCamino () {
+        desmarcaAlcanceCamino ();
+        etapas_camino.clear ();
+        distancia_camino.vacia ();
+        juego_->tablero ()->ocupacion ().vaciaCamino ();
+    }
+
+    void ModoJuegoBase::actualizaAlcanceMovimiento () {
+        Coord celda_origen = etapas_camino.back ();
+        int   punts_accion = atacante_->puntosAccion ();
+        unsigned int version = juego_->tablero ()->ocupacion ().version ();
+        if (alcance_movimiento.vigente (celda_origen, distancia_camino.longitud (), punts_accion, version)) {
+            return;
         }
-        int punts = static_cast <int> (std::round (distn / puntosAccionDeDesplaza ()));
-        return punts;
+        alcance_movimiento.calcula (juego_, distancia_camino, punts_accion, puntosAccionDeDesplaza ());
     }
 
-    float ModoJuegoBase::distanciaCeldas (Coord celda_origen, Coord celda_destino) const {
-        float distn = unir2d::norma (
-                RejillaTablero::centroHexagono (celda_destino) -
-                RejillaTablero::centroHexagono (celda_origen)   );
-        constexpr float unidad = static_cast <float> (RejillaTablero::ladoHexagono) * RejillaTablero::seno60_exacto * 2;
-        return distn / unidad;
+    void ModoJuegoBase::marcaAlcanceCamino () {
+        desmarcaAlcanceCamino ();
+        celdas_alcance = celdasAlcanceCamino ();
+        juego_->tablero ()->rejilla ().marcaCeldas (celdas_alcance, ModoJuegoBase::color_alcance, false);
+    }
+
+    void ModoJuegoBase::desmarcaAlcanceCamino () {
+        if (celdas_alcance.empty ()) {
+            return;
+        }
+        juego_->tablero ()->rejilla ().desmarcaCeldas (celdas_alcance);
+        celdas_alcance.clear ();
+    }
+
+    bool ModoJuegoBase::enAlcanceHabilidad (Coord celda_objetivo) const {
+        reglas::HabilidadReglas habilidad;
+        CapturaReglas::capturaHabilidad (habilidad_accion, habilidad);
+        return reglas::ReglasJuego::enAlcance (
+                juego_->tablero ()->ocupacion ().tablero (), habilidad,
+                CapturaReglas::celda (atacante_->sitioFicha ()), CapturaReglas::celda (celda_objetivo));
+    }
+
+    bool ModoJuegoBase::accesoDirecto (Coord celda) {
+        Coord celda_origen = atacante_->sitioFicha ();
+        unsigned int version = juego_->tablero ()->ocupacion ().version ();
+        if (! visibilidad_celdas.vigente (celda_origen, version)) {
+            visibilidad_celdas.calcula (juego_, celda_origen);
+        }
+        return visibilidad_celdas.visible (celda);
+    }
+
+    int ModoJuegoBase::puntosEnJuegoCamino (Coord proxima_celda) const {
+        // 'distancia_camino' acumula las etapas en el mismo orden en que antes se sumaban aquí,
+        // por lo que el redondeo coincide con el de recorrer todo el camino
+        return distancia_camino.puntosHasta (CapturaReglas::celda (proxima_celda), puntosAccionDeDesplaza ());
     }
 
     void ModoJuegoBase::marcaCeldasArea () {
-        for (int indc_radio = 0; indc_radio < area_celdas.size (); ++ indc_radio) {
-            for (Coord celda : area_celdas [indc_radio]) {
-                juego_->tablero ()->rejilla ().marcaCelda (celda, ModoJuegoBase::color_objetivo, true);
-            }
+        for (Coord celda : area_celdas) {
+            juego_->tablero ()->rejilla ().marcaCelda (celda, ModoJuegoBase::color_objetivo, true);
         }
     }
 
     void ModoJuegoBase::desmarcaCeldasArea () {
-        for (int indc_radio = 0; indc_radio < area_celdas.size (); ++ indc_radio) {
-            for (Coord celda : area_celdas [indc_radio]) {
-                juego_->tablero ()->rejilla ().desmarcaCelda (celda);
-            }
+        for (Coord celda : area_celdas) {
+            juego_->tablero ()->rejilla ().desmarcaCelda (celda);
         }
     }
 
     void ModoJuegoBase::personajesAreaCeldas (
             std::vector <ActorPersonaje *> & lista_oponentes) const {
-        for (int indc_radio = 0; indc_radio < area_celdas.size (); ++ indc_radio) {
-            for (Coord celda : area_celdas [indc_radio]) {
-                for (ActorPersonaje * persj : juego_->personajes ()) {
-                    if (persj->sitioFicha () == celda) {
-                        lista_oponentes.push_back (persj);
-                    }
-                }
+        // el plano de ocupación sabe qué personaje hay en cada celda: una consulta por celda
+        const OcupacionTablero & ocupacion = juego_->tablero ()->ocupacion ();
+        lista_oponentes.clear ();
+        for (Coord celda : area_celdas) {
+            ActorPersonaje * persj = ocupacion.personaje (celda);
+            if (persj != nullptr) {
+                lista_oponentes.push_back (persj);
             }
         }
     }
@@ -1090,20 +1171,7 @@ void ModoJuegoBase::validaHabilidadSimple (bool & uso_valido, int & puntos_en_ju
     void ModoJuegoBase::restauraPersonajes() {
         for (ActorPersonaje* persj : juego_->personajes()) {
 
-            const std::wstring nombre = persj->nombre();
-            if (nombre == L"Dorian" || nombre == L"Buenavida") {
-                persj->ponPuntosAccion(8);
-            }
-            else if (nombre == L"Balthazar" || nombre == L"Luciana") {
-                persj->ponPuntosAccion(12);
-            }
-            else if (nombre == L"Edward" || nombre == L"Victoria") {
-                persj->ponPuntosAccion(14);
-            }
-            else {
-
-                persj->ponPuntosAccion(ActorPersonaje::maximoPuntosAccion);
-            }
+            persj->ponPuntosAccion(puntosAccionRonda(persj));
 
             if (persj->vitalidad() > 0) {
                 persj->presencia().aclaraRetrato();
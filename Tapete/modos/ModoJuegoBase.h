@@ -68,6 +68,11 @@ namespace tapete {
          */
         LadoTablero ladoEquipoActual  () const;
 
+        /*!
+         * \brief Devuelve el lado que mueve: el del atacante o, si no hay, el del equipo actual.
+         */
+        LadoTablero ladoMueve () const;
+
         /*!
          * \brief Devuelve la lista de factores de los equipos.
          */
@@ -114,6 +119,12 @@ namespace tapete {
          */
         const AreaCentradaCeldas & areaCeldas () const;
 
+        /*!
+         * \brief Devuelve los puntos de acción con los que un personaje empieza cada ronda.
+         * \param personaje Personaje.
+         */
+        static int puntosAccionRonda (const ActorPersonaje * personaje);
+
         /*!
          * \brief Devuelve el texto del informe de depuración.
          */
@@ -259,6 +270,23 @@ namespace tapete {
          */
         void validaEtapaCamino   (Coord proxima_celda, bool & etapa_valida, int & puntos_en_juego);
 
+        /*!
+         * \brief Calcula el camino más corto desde la última etapa hasta una celda.
+         * \param celda_destino Celda de llegada.
+         * \param etapas Etapas del camino calculado, empezando por la última etapa actual.
+         * \param puntos_en_juego Puntos en juego del camino completo.
+         * \return true si existe un camino, false en caso contrario.
+         */
+        bool calculaCaminoOptimo (Coord celda_destino, std::vector <Coord> & etapas, int & puntos_en_juego);
+
+        /*!
+         * \brief Devuelve las celdas que pueden ser la próxima etapa del camino.
+         *
+         * Mientras se marca el camino, estas celdas se muestran en la rejilla y se actualizan al
+         * agregar cada etapa.
+         */
+        const std::vector <Coord> & celdasAlcanceCamino ();
+
         /*!
          * \brief Marca una celda del camino.
          * \param proxima_celda Próxima celda.
@@ -290,10 +318,17 @@ namespace tapete {
         void anulaCamino ();
 
         /*!
-         * \brief Genera un valor aleatorio entre 0 y 100.
+         * \brief Genera un valor aleatorio entre 0 y 99 para la animación del cálculo.
+         *
+         * Usa la secuencia cosmética, porque se llama una vez por fotograma.
          */
         void alea100 ();
 
+        /*!
+         * \brief Tira el valor aleatorio entre 0 y 99 que decide la habilidad y lo muestra.
+         */
+        void tiraAleatorio100 ();
+
         /*!
          * \brief Muestra el valor aleatorio generado.
          */
@@ -555,11 +590,17 @@ namespace tapete {
 
         ActorPersonaje * atacante_ {};
 
-        ModoAccionPersonaje  modo_accion {};
-        std::vector <Coord>  etapas_camino {};
-        Habilidad *          habilidad_accion {};        
-        ActorPersonaje *     oponente_ {};
-        AreaCentradaCeldas   area_celdas {};
+        ModoAccionPersonaje     modo_accion {};
+        std::vector <Coord>     etapas_camino {};
+        reglas::DistanciaCamino distancia_camino {};
+        BuscadorCaminos         buscador_caminos {};
+        AlcanceMovimiento       alcance_movimiento {};
+        std::vector <Coord>     celdas_alcance {};
+        VisibilidadCeldas       visibilidad_celdas {};
+        Habilidad *             habilidad_accion {};        
+        ActorPersonaje *        oponente_ {};
+        AreaCentradaCeldas      area_celdas {};
+        std::vector <ActorPersonaje *> oponentes_area {};
 
         int valor_aleatorio_100 {};
 
@@ -568,12 +609,23 @@ namespace tapete {
         inline static Color color_elegido  = Color::Blanco;
         inline static Color color_atacante = Color::Amarillo;
         inline static Color color_objetivo = Color::Marron;
+        inline static Color color_alcance  = Color::Gris;
+
+
+        int azarosa (unsigned int contador);
 
+        void cambiaContador (int & contador, int valor, ClavePartida::Rasgo rasgo);
+        void avisaLadoMueve (LadoTablero anterior);
 
-        static int azarosa (unsigned int contador);
+        void agregaEtapa (Coord celda);
+        void vaciaEtapasCamino ();
+        void actualizaAlcanceMovimiento ();
+        void marcaAlcanceCamino ();
+        void desmarcaAlcanceCamino ();
+        bool enAlcanceHabilidad (Coord celda_objetivo) const;
+        bool accesoDirecto (Coord celda);
 
-        int   puntosEnJuegoCamino   (Coord proxima_celda) const;
-        float distanciaCeldas (Coord celda_origen, Coord celda_destino) const;
+        int  puntosEnJuegoCamino (Coord proxima_celda) const;
 
         void marcaCeldasArea ();
         void desmarcaCeldasArea ();
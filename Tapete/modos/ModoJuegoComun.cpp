@@ -561,13 +561,12 @@ namespace tapete
         }
     }
 
-    void ModoJuegoComun::calculaHabilidadOponente(unir2d::Tiempo &tiempo)
+    void ModoJuegoComun::calculaHabilidadOponente(double segundos)
     {
         try
         {
             validaEstado({EstadoJuegoComun::oponenteHabilidadCalculando});
 
-            double segundos = tiempo.segundos();
             if (segundos < segundos_calculo)
             {
                 ModoJuegoBase::alea100();
@@ -576,6 +575,7 @@ namespace tapete
             else
             {
                 ModoJuegoBase::terminaTiempoCalculo();
+                ModoJuegoBase::tiraAleatorio100();
                 ModoJuegoBase::atacaOponente();
             }
 
@@ -670,7 +670,7 @@ namespace tapete
             }
             if (!areaCeldas().empty())
             {
-                Coord celda_area = areaCeldas()[0][0];
+                Coord celda_area = areaCeldas()[0];
                 if (celda_area == celda)
                 {
                     return;
@@ -742,13 +742,12 @@ namespace tapete
         }
     }
 
-    void ModoJuegoComun::calculaHabilidadArea(unir2d::Tiempo &tiempo)
+    void ModoJuegoComun::calculaHabilidadArea(double segundos)
     {
         try
         {
             validaEstado({EstadoJuegoComun::areaHabilidadCalculando});
 
-            double segundos = tiempo.segundos();
             if (segundos < segundos_calculo)
             {
                 ModoJuegoBase::alea100();
@@ -757,6 +756,7 @@ namespace tapete
             else
             {
                 ModoJuegoBase::terminaTiempoCalculo();
+                ModoJuegoBase::tiraAleatorio100();
                 ModoJuegoBase::atacaArea();
             }
 
@@ -163,9 +163,9 @@ public:
 
     /*!
      * \brief Calcula una habilidad de oponente (asincrónica).
-     * \param tiempo Referencia al tiempo de cálculo.
+     * \param segundos Tiempo transcurrido desde que empezó el cálculo.
      */
-    void calculaHabilidadOponente(unir2d::Tiempo &tiempo);
+    void calculaHabilidadOponente(double segundos);
 
     /*!
      * \brief Revierte una habilidad de oponente.
@@ -191,9 +191,9 @@ public:
 
     /*!
      * \brief Calcula una habilidad de área (asincrónica).
-     * \param tiempo Referencia al tiempo de cálculo.
+     * \param segundos Tiempo transcurrido desde que empezó el cálculo.
      */
-    void calculaHabilidadArea(unir2d::Tiempo &tiempo);
+    void calculaHabilidadArea(double segundos);
 
     /*!
      * \brief Revierte una habilidad de área.
@@ -11,13 +11,24 @@ using Region = unir2d::Region;
 using Color = unir2d::Color;
 
 #include <sstream>
+#include <bitset>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <type_traits>
+#include <unordered_map>
+
+#include <reglas.h>
 
 #include "core/LadoTablero.h"
 #include "combate/tipos/TipoEstadistica.h"
 #include "combate/habilidades/Habilidad.h"
 #include "ui/CuadroIndica.h"
+#include "ui/AtlasEstampas.h"
+#include "ui/CapaFija.h"
 
 #include "utils/Excepciones.h"
+#include "utils/GeneradorAzar.h"
 
 #include "ui/PresenciaPersonaje.h"
 #include "grid/CalculoCaminos.h"
@@ -25,6 +36,10 @@ using Color = unir2d::Color;
 
 #include "ui/PresenciaTablero.h"
 #include "grid/RejillaTablero.h"
+#include "grid/OcupacionTablero.h"
+#include "grid/BuscadorCaminos.h"
+#include "grid/AlcanceMovimiento.h"
+#include "grid/VisibilidadCeldas.h"
 #include "ui/PresenciaHabilidades.h"
 #include "ui/PresenciaActuante.h"
 #include "ui/VistaCaminoCeldas.h"
@@ -37,8 +52,15 @@ using Color = unir2d::Color;
 
 #include "combate/sistema/GradoEfectividad.h"
 #include "combate/sistema/SistemaAtaque.h"
+#include "combate/sistema/TablaEstadisticas.h"
 #include "ui/EscritorAyuda.h"
+#include "core/ClavePartida.h"
 #include "modos/ModoJuegoBase.h"
+#include "core/CapturaReglas.h"
+#include "core/DiarioPartida.h"
+#include "core/PrecargaActivos.h"
+#include "core/AlmacenTexturas.h"
+#include "core/JugadorAutomatico.h"
 
 #include "eventos/SucesosJuegoComun.h"
 #include "estados/EstadoJuegoComun.h"
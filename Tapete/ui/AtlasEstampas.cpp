@@ -0,0 +1,110 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   AtlasEstampas.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete
+{
+
+    AtlasEstampas::AtlasEstampas(Vector tamano_estampa, int columnas)
+        : tamano_estampa{tamano_estampa}, columnas{columnas}
+    {
+        aserta(columnas > 0, "el atlas necesita al menos una columna");
+    }
+
+    AtlasEstampas::~AtlasEstampas()
+    {
+        delete textura;
+        textura = nullptr;
+    }
+
+    int AtlasEstampas::agrega(const string &archivo)
+    {
+        auto encontrado = std::find(archivos.begin(), archivos.end(), archivo);
+        if (encontrado != archivos.end())
+        {
+            return static_cast<int>(encontrado - archivos.begin());
+        }
+        aserta(textura == nullptr, "el atlas ya está construido");
+        archivos.push_back(archivo);
+        return static_cast<int>(archivos.size()) - 1;
+    }
+
+    void AtlasEstampas::construye(AlmacenTexturas &texturas)
+    {
+        aserta(textura == nullptr, "el atlas ya está construido");
+        aserta(!archivos.empty(), "el atlas no tiene archivos");
+        int cuenta = static_cast<int>(archivos.size());
+        columnas_atlas = std::min(columnas, cuenta);
+        filas = (cuenta + columnas_atlas - 1) / columnas_atlas;
+
+        textura = new unir2d::Textura{};
+        textura->crea(Vector{tamano_estampa.x() * columnas_atlas, tamano_estampa.y() * filas});
+
+        for (int indc = 0; indc < cuenta; ++indc)
+        {
+            unir2d::Textura *origen = texturas.toma(archivos[indc]);
+            unir2d::Imagen *imagen = new unir2d::Imagen{};
+            imagen->asigna(origen);
+            imagen->ponPosicion(Vector{(indc % columnas_atlas) * tamano_estampa.x(),
+                                       (indc / columnas_atlas) * tamano_estampa.y()});
+            textura->dibuja(imagen);
+            delete imagen;
+            imagen = nullptr;
+            texturas.suelta(origen);
+        }
+    }
+
+    bool AtlasEstampas::construido() const
+    {
+        return textura != nullptr;
+    }
+
+    bool AtlasEstampas::enUso() const
+    {
+        return textura != nullptr && textura->cuentaUsos() > 0;
+    }
+
+    void AtlasEstampas::asigna(unir2d::Imagen *imagen, int indice) const
+    {
+        aserta(textura != nullptr, "el atlas no está construido");
+        aserta(0 <= indice && indice < static_cast<int>(archivos.size()), "estampa fuera del atlas");
+        imagen->asigna(textura);
+        imagen->defineEstampas(filas, columnas_atlas);
+        imagen->seleccionaEstampa(indice / columnas_atlas + 1, indice % columnas_atlas + 1);
+    }
+
+    int AtlasEstampas::cuentaEstampas() const
+    {
+        return static_cast<int>(archivos.size());
+    }
+
+    void AtlasEstampas::libera()
+    {
+        if (textura != nullptr)
+        {
+            aserta(textura->cuentaUsos() == 0, "recursos cautivos");
+            delete textura;
+            textura = nullptr;
+        }
+        archivos.clear();
+        filas = 0;
+        columnas_atlas = 0;
+    }
+
+    void AtlasEstampas::informa(std::ostream &salida, const string &nombre) const
+    {
+        salida << "Atlas " << nombre << ": " << archivos.size() << " archivos en una textura" << std::endl;
+    }
+
+    void AtlasEstampas::aserta(bool expresion, const string &mensaje)
+    {
+        if (expresion)
+        {
+            return;
+        }
+        throw std::logic_error(mensaje);
+    }
+
+}
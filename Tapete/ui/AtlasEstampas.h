@@ -0,0 +1,99 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  AtlasEstampas.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+namespace tapete
+{
+
+    class AlmacenTexturas;
+
+    /*
+     * \class AtlasEstampas
+     * \brief Reúne varias imágenes del mismo tamaño en una sola textura, como estampas de una rejilla.
+     *
+     * Se agregan los archivos, que se numeran en orden y sin repetir, y al construir el atlas se
+     * dibujan en una textura creada con una estampa por archivo, por filas. Las imágenes que lo usan
+     * se asignan con asigna, que define las estampas y selecciona la del archivo. Así todas dibujan
+     * con la misma textura en lugar de cambiar de textura en cada una.
+     *
+     * Las estampas tienen el tamaño indicado al construir; un archivo más grande se recorta.
+     */
+    class AtlasEstampas
+    {
+    public:
+        /*!
+         * \brief Constructor.
+         * \param tamano_estampa Tamaño de cada estampa, en píxeles.
+         * \param columnas Estampas por fila.
+         */
+        AtlasEstampas(Vector tamano_estampa, int columnas);
+
+        /*!
+         * \brief Destructor.
+         */
+        ~AtlasEstampas();
+
+        AtlasEstampas(const AtlasEstampas &) = delete;
+        AtlasEstampas &operator=(const AtlasEstampas &) = delete;
+
+        /*!
+         * \brief Agrega un archivo al atlas; los archivos nuevos, solo antes de construirlo.
+         * \param archivo Ruta del archivo.
+         * \return Índice de la estampa del archivo; el mismo si ya estaba agregado.
+         */
+        int agrega(const string &archivo);
+
+        /*!
+         * \brief Crea la textura del atlas y dibuja en ella los archivos agregados.
+         * \param texturas Almacén del que se toman las texturas de los archivos mientras se dibujan.
+         */
+        void construye(AlmacenTexturas &texturas);
+
+        /*!
+         * \brief Indica si el atlas está construido.
+         */
+        bool construido() const;
+
+        /*!
+         * \brief Indica si alguna imagen usa la textura del atlas.
+         */
+        bool enUso() const;
+
+        /*!
+         * \brief Asigna a una imagen la textura del atlas y selecciona la estampa de un archivo.
+         * \param imagen Imagen.
+         * \param indice Índice de la estampa, devuelto por agrega.
+         */
+        void asigna(unir2d::Imagen *imagen, int indice) const;
+
+        /*!
+         * \brief Devuelve el número de estampas, que son los archivos que ya no tienen textura propia.
+         */
+        int cuentaEstampas() const;
+
+        /*!
+         * \brief Borra la textura del atlas y olvida los archivos.
+         */
+        void libera();
+
+        /*!
+         * \brief Escribe cuántos archivos se dibujan con la textura del atlas.
+         * \param salida Flujo de salida.
+         * \param nombre Nombre del atlas en el informe.
+         */
+        void informa(std::ostream &salida, const string &nombre) const;
+
+    private:
+        Vector tamano_estampa;
+        int columnas;
+        std::vector<string> archivos{};
+        unir2d::Textura *textura{};
+        int filas{};
+        int columnas_atlas{};
+
+        static void aserta(bool expresion, const string &mensaje);
+    };
+
+}
@@ -0,0 +1,66 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   CapaFija.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+namespace tapete
+{
+
+    CapaFija::CapaFija(Vector tamano) : tamano{tamano}
+    {
+    }
+
+    CapaFija::~CapaFija()
+    {
+        delete imagen;
+        imagen = nullptr;
+        delete textura;
+        textura = nullptr;
+    }
+
+    void CapaFija::agrega(unir2d::Dibujo *dibujo)
+    {
+        aserta(dibujo != nullptr, "dibujo nulo");
+        dibujos.push_back(dibujo);
+    }
+
+    unir2d::Imagen *CapaFija::prepara()
+    {
+        aserta(textura == nullptr, "la capa ya está preparada");
+        textura = new unir2d::Textura{};
+        textura->crea(tamano);
+        imagen = new unir2d::Imagen{};
+        imagen->asigna(textura);
+        imagen->ponPosicion(Vector{0, 0});
+        return imagen;
+    }
+
+    void CapaFija::compone()
+    {
+        aserta(textura != nullptr, "la capa no está preparada");
+        for (unir2d::Dibujo *dibujo : dibujos)
+        {
+            textura->dibuja(dibujo);
+        }
+    }
+
+    void CapaFija::libera()
+    {
+        delete imagen;
+        imagen = nullptr;
+        delete textura;
+        textura = nullptr;
+        dibujos.clear();
+    }
+
+    void CapaFija::aserta(bool expresion, const string &mensaje)
+    {
+        if (expresion)
+        {
+            return;
+        }
+        throw std::logic_error(mensaje);
+    }
+
+}
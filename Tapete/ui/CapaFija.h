@@ -0,0 +1,69 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  CapaFija.h
+// versión:  2.1  (Abril-2025)
+
+#pragma once
+
+namespace tapete
+{
+
+    /*
+     * \class CapaFija
+     * \brief Compone en una textura los dibujos que no cambian durante la partida.
+     *
+     * Se agregan los dibujos en orden, del fondo al frente, y en lugar de ellos el actor dibuja la
+     * imagen de la capa. Al componerla se dibujan todos en la textura, y después cada fotograma
+     * solo cuesta dibujar esa imagen. Los dibujos agregados no deben agregarse también al actor;
+     * siguen perteneciendo a quien los creó, que los libera después de liberar la capa.
+     *
+     * Si un dibujo agregado cambia, hay que volver a componer la capa para que se vea el cambio.
+     */
+    class CapaFija
+    {
+    public:
+        /*!
+         * \brief Constructor.
+         * \param tamano Tamaño de la capa, en píxeles, desde la posición del actor.
+         */
+        explicit CapaFija(Vector tamano);
+
+        /*!
+         * \brief Destructor.
+         */
+        ~CapaFija();
+
+        CapaFija(const CapaFija &) = delete;
+        CapaFija &operator=(const CapaFija &) = delete;
+
+        /*!
+         * \brief Agrega un dibujo encima de los ya agregados.
+         * \param dibujo Dibujo, con la posición relativa al actor.
+         */
+        void agrega(unir2d::Dibujo *dibujo);
+
+        /*!
+         * \brief Crea la textura y la imagen de la capa, que aún no se ha compuesto.
+         * \return Imagen que el actor debe dibujar en lugar de los dibujos agregados.
+         */
+        unir2d::Imagen *prepara();
+
+        /*!
+         * \brief Dibuja en la textura de la capa todos los dibujos agregados.
+         */
+        void compone();
+
+        /*!
+         * \brief Borra la imagen y la textura de la capa y olvida los dibujos agregados.
+         */
+        void libera();
+
+    private:
+        Vector tamano;
+        std::vector<unir2d::Dibujo *> dibujos{};
+        unir2d::Textura *textura{};
+        unir2d::Imagen *imagen{};
+
+        static void aserta(bool expresion, const string &mensaje);
+    };
+
+}
@@ -1,4 +1,4 @@
-// proyecto: Grupal/Tapete
+﻿// proyecto: Grupal/Tapete
 // archivo   ModoJuegoBase.cpp
 // versión:  2.1  (Abril-2025)
 
@@ -296,6 +296,26 @@ namespace tapete
         listado.escribe(std::format(L"    · Vitalidad resultante:  {}  (vitalidad - daño)",
                                     registro.vitalidad_final));
         listado.saltaLinea();
+
+        const SistemaAtaque::PronosticoAtaque pronostico = sistema.pronostica(registro);
+        listado.escribe(L"    · Pronóstico para cualquier valor aleatorio:");
+        for (size_t indc = 0; indc < sistema.efectividades().size(); ++indc)
+        {
+            if (pronostico.probabilidad_efectividad[indc] > 0.0f)
+            {
+                listado.escribe(std::format(L"          {}:  {:.0f}%",
+                                            sistema.efectividades()[indc]->nombre(),
+                                            pronostico.probabilidad_efectividad[indc] * 100.0f));
+            }
+        }
+        if (pronostico.probabilidad_fallo > 0.0f)
+        {
+            listado.escribe(std::format(L"          sin efectividad:  {:.0f}%",
+                                        pronostico.probabilidad_fallo * 100.0f));
+        }
+        listado.escribe(std::format(L"    · Daño esperado:  {:.1f}   probabilidad de derribo:  {:.0f}%",
+                                    pronostico.dano_esperado, pronostico.probabilidad_derriba * 100.0f));
+        listado.saltaLinea();
     }
 
     void EscritorAyuda::escribeCuracion(
@@ -34,6 +34,11 @@ private:
     bool conSonido;                    /*!< Indica si la animación tiene sonido asociado. */
     string pathSonido;                 /*!< Ruta del archivo de sonido. */
     Sonido* ptr_sonido;                /*!< Puntero al objeto de sonido. */
+    Rectangulo* barra_fondo = nullptr; /*!< Fondo de la barra de progreso de la precarga. */
+    Rectangulo* barra_leida = nullptr; /*!< Parte de la barra que corresponde a los archivos leídos. */
+
+    static constexpr float margenBarra = 20;   /*!< Margen de la barra con los bordes de la ventana. */
+    static constexpr float alturaBarra = 6;    /*!< Altura de la barra de progreso. */
 
     /*!
      * \brief Inicializa la animación y recursos asociados.
@@ -51,6 +56,11 @@ private:
      */
     void actualiza(double tiempo_seg) override;
 
+    /*!
+     * \brief Devuelve la posición de la barra de progreso, relativa a la imagen, al pie de la ventana.
+     */
+    Vector posicionBarra() const;
+
 public:
     /*!
      * \brief Constructor de la clase IntroJuegoImagen.
@@ -65,6 +75,13 @@ public:
      */
     IntroJuegoImagen(const string pathArchivo, float posicionInicialX = 0,
         float posicionInicialY = 0, float velocidadDesplazamientoArriba = 0, int numeroDeFotogramasColumnas = 0, int numeroDeFotogramasFilas = 0, bool bucle = false, string pathSonido = "");
+
+    /*!
+     * \brief Muestra el progreso de la precarga con una barra al pie de la ventana; la oculta al terminar.
+     * \param leidos Archivos ya leídos.
+     * \param total Archivos que hay que leer.
+     */
+    void muestraProgreso(int leidos, int total);
 };
 
 
@@ -109,6 +126,10 @@ inline void IntroJuegoImagen::inicia() {
 
 inline void IntroJuegoImagen::termina() {
     extraeDibujos();
+    delete barra_leida;
+    barra_leida = nullptr;
+    delete barra_fondo;
+    barra_fondo = nullptr;
     delete imagen;
     delete textura;
     if (conSonido) {
@@ -116,6 +137,32 @@ inline void IntroJuegoImagen::termina() {
     }
 }
 
+inline void IntroJuegoImagen::muestraProgreso(int leidos, int total) {
+    float ancho = tapete::PresenciaTablero::tamanoTablero.x() - 2 * margenBarra;
+    if (barra_fondo == nullptr) {
+        barra_fondo = new Rectangulo(ancho, alturaBarra);
+        barra_fondo->ponColor(Color{ 40, 40, 40 });
+        agregaDibujo(barra_fondo);
+        barra_leida = new Rectangulo(0, alturaBarra);
+        barra_leida->ponColor(Color{ 0, 255, 180 });
+        agregaDibujo(barra_leida);
+    }
+    bool visible = total > 0 && leidos < total;
+    barra_fondo->ponVisible(visible);
+    barra_leida->ponVisible(visible);
+    barra_fondo->ponPosicion(posicionBarra());
+    barra_leida->ponPosicion(posicionBarra());
+    if (visible) {
+        barra_leida->ponBase(ancho * leidos / total);
+    }
+}
+
+inline Vector IntroJuegoImagen::posicionBarra() const {
+    // los dibujos se sitúan respecto al actor, que se desplaza con la imagen
+    return Vector{ margenBarra, tapete::PresenciaTablero::tamanoTablero.y() - margenBarra - alturaBarra }
+           - Vector{ posicion_x, posicion_y };
+}
+
 inline void IntroJuegoImagen::actualiza(double tiempo_seg) {
     
     // si se trata de imagen con fotogramas tilesheet, congela el último fotograma hasta que finalize el tiempo
@@ -144,6 +191,10 @@ inline void IntroJuegoImagen::actualiza(double tiempo_seg) {
     {
         posicion_y -= velocidadDesplazamientoArriba;
         ponPosicion(Vector{ posicion_x, posicion_y });
+        if (barra_fondo != nullptr) {
+            barra_fondo->ponPosicion(posicionBarra());
+            barra_leida->ponPosicion(posicionBarra());
+        }
     }
 }
 
@@ -35,33 +35,21 @@ namespace tapete
     {
         delete imagen_barra_vida;
         imagen_barra_vida = nullptr;
-        if (textura_barras_vida->cuentaUsos() == 0)
-        {
-            delete textura_barras_vida;
-            textura_barras_vida = nullptr;
-        }
+        actor_tablero->juego->texturas().suelta(textura_barras_vida);
 
         for (int indc = 0; indc < cuentaHabilidades; ++indc)
         {
             delete imagen_marco_habilidad[indc];
             imagen_marco_habilidad[indc] = nullptr;
         }
-        if (textura_marco_habilidad->cuentaUsos() == 0)
-        {
-            delete textura_marco_habilidad;
-            textura_marco_habilidad = nullptr;
-        }
+        actor_tablero->juego->texturas().suelta(textura_marco_habilidad);
 
         for (int indc = 0; indc < cuentaPuntosAccion; ++indc)
         {
             delete imagen_luces_punto_accion[indc];
             imagen_luces_punto_accion[indc] = nullptr;
         }
-        if (textura_luces_punto_accion->cuentaUsos() == 0)
-        {
-            delete textura_luces_punto_accion;
-            textura_luces_punto_accion = nullptr;
-        }
+        actor_tablero->juego->texturas().suelta(textura_luces_punto_accion);
 
         delete imagen_marca_retrato;
         imagen_marca_retrato = nullptr;
@@ -70,19 +58,11 @@ namespace tapete
             delete imagen_marca_habilidad[indc];
             imagen_marca_habilidad[indc] = nullptr;
         }
-        if (textura_marca != nullptr && textura_marca->cuentaUsos() == 0)
-        {
-            delete textura_marca;
-            textura_marca = nullptr;
-        }
+        actor_tablero->juego->texturas().suelta(textura_marca);
 
         delete imagen_marco_personaje;
         imagen_marco_personaje = nullptr;
-        if (textura_marco_personaje != nullptr && textura_marco_personaje->cuentaUsos() == 0)
-        {
-            delete textura_marco_personaje;
-            textura_marco_personaje = nullptr;
-        }
+        actor_tablero->juego->texturas().suelta(textura_marco_personaje);
     }
 
     void PresenciaActuante::preparaPaneles()
@@ -112,11 +92,8 @@ namespace tapete
 
     void PresenciaActuante::preparaPersonaje()
     {
-        if (textura_marco_personaje == nullptr)
-        {
-            textura_marco_personaje = new unir2d::Textura{};
-            textura_marco_personaje->carga(JuegoMesaBase::carpetaActivos() + "marco_personaje.png");
-        }
+        textura_marco_personaje = actor_tablero->juego->texturas().toma(
+            JuegoMesaBase::carpetaActivos() + "marco_personaje.png");
 
         imagen_marco_personaje = new unir2d::Imagen{};
         imagen_marco_personaje->asigna(textura_marco_personaje);
@@ -128,11 +105,8 @@ namespace tapete
 
     void PresenciaActuante::preparaHabilidades()
     {
-        if (textura_marco_habilidad == nullptr)
-        {
-            textura_marco_habilidad = new unir2d::Textura{};
-            textura_marco_habilidad->carga(JuegoMesaBase::carpetaActivos() + "marco_habilidad.png");
-        }
+        textura_marco_habilidad = actor_tablero->juego->texturas().toma(
+            JuegoMesaBase::carpetaActivos() + "marco_habilidad.png");
 
         Vector poscn = panel_abajo.posicion() + Vector{81, 34};
         for (int indc = 0; indc < cuentaHabilidades; ++indc)
@@ -152,12 +126,8 @@ namespace tapete
 
     void PresenciaActuante::preparaPuntosAccion()
     {
-
-        if (textura_luces_punto_accion == nullptr)
-        {
-            textura_luces_punto_accion = new unir2d::Textura{};
-            textura_luces_punto_accion->carga(JuegoMesaBase::carpetaActivos() + "piloto_colores.png");
-        }
+        textura_luces_punto_accion = actor_tablero->juego->texturas().toma(
+            JuegoMesaBase::carpetaActivos() + "piloto_colores.png");
 
         Vector poscn = panel_abajo.posicion() + Vector{74, 0};
         for (int indc = 0; indc < cuentaPuntosAccion; ++indc)
@@ -178,11 +148,8 @@ namespace tapete
 
     void PresenciaActuante::preparaBarraVida()
     {
-        if (textura_barras_vida == nullptr)
-        {
-            textura_barras_vida = new unir2d::Textura{};
-            textura_barras_vida->carga(JuegoMesaBase::carpetaActivos() + "barras_larga_vida.png");
-        }
+        textura_barras_vida = actor_tablero->juego->texturas().toma(
+            JuegoMesaBase::carpetaActivos() + "barras_larga_vida.png");
         imagen_barra_vida = new unir2d::Imagen{};
         imagen_barra_vida->asigna(textura_barras_vida);
         imagen_barra_vida->defineEstampas(cuentaBarrasVida, 1);
@@ -194,11 +161,8 @@ namespace tapete
 
     void PresenciaActuante::preparaMarcas()
     {
-        if (textura_marca == nullptr)
-        {
-            textura_marca = new unir2d::Textura{};
-            textura_marca->carga(JuegoMesaBase::carpetaActivos() + "marca_amarilla_corta.png");
-        }
+        textura_marca = actor_tablero->juego->texturas().toma(
+            JuegoMesaBase::carpetaActivos() + "marca_amarilla_corta.png");
 
         imagen_marca_retrato = new unir2d::Imagen{};
         imagen_marca_retrato->asigna(textura_marca);
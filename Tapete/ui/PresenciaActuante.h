@@ -80,19 +80,19 @@ namespace tapete
         Region panel_retrato;                                    ///< Región del retrato del personaje
         std::array<Region, cuentaHabilidades> paneles_habilidad; ///< Regiones de paneles de habilidades
 
-        inline static unir2d::Textura *textura_marco_personaje{}; ///< Textura marco de retrato
+        unir2d::Textura *textura_marco_personaje{};               ///< Textura marco de retrato
         unir2d::Imagen *imagen_marco_personaje{};                 ///< Imagen del marco de retrato
 
-        inline static unir2d::Textura *textura_marco_habilidad{};                 ///< Textura de marco de habilidad
+        unir2d::Textura *textura_marco_habilidad{};                               ///< Textura de marco de habilidad
         std::array<unir2d::Imagen *, cuentaHabilidades> imagen_marco_habilidad{}; ///< Imágenes de marcos de habilidades
 
-        inline static unir2d::Textura *textura_luces_punto_accion{};                  ///< Textura de luces de PA
+        unir2d::Textura *textura_luces_punto_accion{};                                ///< Textura de luces de PA
         std::array<unir2d::Imagen *, cuentaPuntosAccion> imagen_luces_punto_accion{}; ///< Luz por cada PA
 
-        inline static unir2d::Textura *textura_barras_vida{}; ///< Textura de barra de vida
+        unir2d::Textura *textura_barras_vida{};               ///< Textura de barra de vida
         unir2d::Imagen *imagen_barra_vida{};                  ///< Imagen actual de barra de vida
 
-        inline static unir2d::Textura *textura_marca{};                           ///< Textura para marcar retrato y habilidades
+        unir2d::Textura *textura_marca{};                                         ///< Textura para marcar retrato y habilidades
         unir2d::Imagen *imagen_marca_retrato{};                                   ///< Imagen de marca sobre retrato
         std::array<unir2d::Imagen *, cuentaHabilidades> imagen_marca_habilidad{}; ///< Imágenes de marcas de habilidades
 
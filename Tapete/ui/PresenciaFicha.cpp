@@ -18,16 +18,15 @@ namespace tapete
             actor_base->extraeDibujo(imagen_ficha);
 
         delete imagen_ficha;
-        delete textura_ficha;
-
         imagen_ficha = nullptr;
-        textura_ficha = nullptr;
+        if (texturas_)
+            texturas_->suelta(textura_ficha);
     }
 
-    void PresenciaFicha::ponArchivoFicha(const std::string &archivo)
+    void PresenciaFicha::ponArchivoFicha(AlmacenTexturas &texturas, const std::string &archivo)
     {
-        textura_ficha = new unir2d::Textura();
-        textura_ficha->carga(archivo);
+        texturas_ = &texturas;
+        textura_ficha = texturas.toma(archivo);
         imagen_ficha = new unir2d::Imagen();
         imagen_ficha->asigna(textura_ficha);
         actor_base->agregaDibujo(imagen_ficha); // registro en el motor :contentReference[oaicite:6]{index=6}:contentReference[oaicite:7]{index=7}
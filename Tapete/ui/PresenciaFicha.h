@@ -8,6 +8,8 @@
 
 namespace tapete {
 
+    class AlmacenTexturas;
+
     /*!
      * \class PresenciaFicha
      * \brief Gestiona la visualización y manipulación de la ficha de un personaje en el tablero.
@@ -30,9 +32,10 @@ namespace tapete {
 
         /*!
          * \brief Establece el archivo de textura de la ficha.
+         * \param texturas Almacén del que se toma la textura; debe durar tanto como la ficha.
          * \param archivo Ruta del archivo de textura.
          */
-        void ponArchivoFicha(const std::string& archivo);
+        void ponArchivoFicha(AlmacenTexturas& texturas, const std::string& archivo);
 
         /*!
          * \brief Establece el centro de la ficha.
@@ -59,6 +62,7 @@ namespace tapete {
 
     private:
         unir2d::ActorBase* actor_base{};   /*!< Puntero al actor base asociado. */
+        AlmacenTexturas* texturas_{};      /*!< Almacén del que se ha tomado la textura. */
         unir2d::Textura* textura_ficha{};  /*!< Puntero a la textura de la ficha. */
         unir2d::Imagen* imagen_ficha{};    /*!< Puntero a la imagen de la ficha. */
     };
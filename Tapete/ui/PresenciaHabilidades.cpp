@@ -29,16 +29,18 @@ namespace tapete
 
     void PresenciaHabilidades::prepara()
     {
-        texturas_fondos.resize(actor_tablero->juego->habilidades().size());
-        texturas_habilidades.resize(actor_tablero->juego->habilidades().size());
-        for (int indc = 0; indc < texturas_habilidades.size(); ++indc)
+        estampas_fondos.resize(actor_tablero->juego->habilidades().size());
+        estampas_habilidades.resize(actor_tablero->juego->habilidades().size());
+        for (int indc = 0; indc < estampas_habilidades.size(); ++indc)
         {
             Habilidad *habld = actor_tablero->juego->habilidades()[indc];
-            texturas_fondos[indc] = new unir2d::Textura{};
-            texturas_habilidades[indc] = new unir2d::Textura{};
-            texturas_fondos[indc]->carga(habld->archivoFondoImagen());
-            texturas_habilidades[indc]->carga(habld->archivoImagen());
+            estampas_fondos[indc] = atlas.agrega(habld->archivoFondoImagen());
+            estampas_habilidades[indc] = atlas.agrega(habld->archivoImagen());
         }
+        atlas.construye(actor_tablero->juego->texturas());
+#ifdef _DEBUG
+        atlas.informa(std::cout, "habilidades");
+#endif
         imagenes_fondos.resize(actor_tablero->juego->personajes().size());
         imagenes_habilidades.resize(actor_tablero->juego->personajes().size());
         for (int indc_persj = 0; indc_persj < imagenes_habilidades.size(); ++indc_persj)
@@ -51,8 +53,8 @@ namespace tapete
                 Habilidad *habld = persj->habilidades()[indc_habld];
                 imagenes_fondos[indc_persj][indc_habld] = new unir2d::Imagen{};
                 imagenes_habilidades[indc_persj][indc_habld] = new unir2d::Imagen{};
-                imagenes_fondos[indc_persj][indc_habld]->asigna(texturas_fondos[habld->indice()]);
-                imagenes_habilidades[indc_persj][indc_habld]->asigna(texturas_habilidades[habld->indice()]);
+                atlas.asigna(imagenes_fondos[indc_persj][indc_habld], estampas_fondos[habld->indice()]);
+                atlas.asigna(imagenes_habilidades[indc_persj][indc_habld], estampas_habilidades[habld->indice()]);
                 imagenes_fondos[indc_persj][indc_habld]->ponVisible(false);
                 imagenes_habilidades[indc_persj][indc_habld]->ponVisible(false);
                 actor_tablero->agregaDibujo(imagenes_fondos[indc_persj][indc_habld]);
@@ -60,7 +62,7 @@ namespace tapete
             }
         }
         sonidos_habilidades.resize(actor_tablero->juego->habilidades().size());
-        for (int indc = 0; indc < texturas_habilidades.size(); ++indc)
+        for (int indc = 0; indc < sonidos_habilidades.size(); ++indc)
         {
             Habilidad *habld = actor_tablero->juego->habilidades()[indc];
             sonidos_habilidades[indc] = new unir2d::Sonido{};
@@ -88,15 +90,9 @@ namespace tapete
         }
         imagenes_habilidades.clear();
         imagenes_fondos.clear();
-        for (int indc = 0; indc < texturas_habilidades.size(); ++indc)
-        {
-            aserta(texturas_habilidades[indc]->cuentaUsos() == 0, "recursos cautivos");
-            aserta(texturas_fondos[indc]->cuentaUsos() == 0, "recursos cautivos");
-            delete texturas_habilidades[indc];
-            delete texturas_fondos[indc];
-        }
-        texturas_habilidades.clear();
-        texturas_fondos.clear();
+        atlas.libera();
+        estampas_habilidades.clear();
+        estampas_fondos.clear();
     }
 
     void PresenciaHabilidades::aserta(bool expresion, const string &mensaje)
@@ -37,14 +37,24 @@ private:
     ActorTablero *actor_tablero;
 
     /*!
-     * \brief Vector de texturas de las habilidades.
+     * \brief Tamaño de las imágenes de las habilidades y de sus fondos.
      */
-    std::vector <unir2d::Textura *> texturas_habilidades {};
+    static constexpr Vector tamanoImagen {50, 50};
 
     /*!
-     * \brief Vector de texturas de los fondos de habilidades.
+     * \brief Atlas con las imágenes de las habilidades y sus fondos, que se dibujan con una sola textura.
      */
-    std::vector <unir2d::Textura *> texturas_fondos {};
+    AtlasEstampas atlas {tamanoImagen, 8};
+
+    /*!
+     * \brief Estampa del atlas de la imagen de cada habilidad.
+     */
+    std::vector <int> estampas_habilidades {};
+
+    /*!
+     * \brief Estampa del atlas del fondo de cada habilidad.
+     */
+    std::vector <int> estampas_fondos {};
 
     /*!
      * \brief Matriz de imágenes de habilidades por personaje.
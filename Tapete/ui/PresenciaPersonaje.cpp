@@ -20,8 +20,18 @@ namespace tapete
     void PresenciaPersonaje::prepara()
     {
 
-        textura_retrato = new unir2d::Textura();
-        textura_retrato->carga(actor_personaje->archivo_retrato);
+        if (!atlas_retratos.construido())
+        {
+            for (const ActorPersonaje *actor_persj : actor_personaje->juego_->personajes())
+            {
+                atlas_retratos.agrega(actor_persj->archivo_retrato);
+            }
+            atlas_retratos.construye(actor_personaje->juego_->texturas());
+#ifdef _DEBUG
+            atlas_retratos.informa(std::cout, "retratos");
+#endif
+        }
+        estampa_retrato = atlas_retratos.agrega(actor_personaje->archivo_retrato);
 
         preparaPanel(actor_personaje->lado_tablero, actor_personaje->indice_en_equipo);
         preparaTitulo(actor_personaje->juego_->personajes(), actor_personaje);
@@ -39,27 +49,18 @@ namespace tapete
 
         delete imagen_ficha;
         imagen_ficha = nullptr;
-        delete textura_ficha;
-        textura_ficha = nullptr;
+        actor_personaje->juego_->texturas().suelta(textura_ficha);
 
         delete imagen_retrato_actuante;
         imagen_retrato_actuante = nullptr;
 
         delete imagen_barra_vida;
         imagen_barra_vida = nullptr;
-        if (textura_barras_vida->cuentaUsos() == 0)
-        {
-            delete textura_barras_vida;
-            textura_barras_vida = nullptr;
-        }
+        actor_personaje->juego_->texturas().suelta(textura_barras_vida);
 
         delete imagen_marco_retrato;
         imagen_marco_retrato = nullptr;
-        if (textura_marco_retrato->cuentaUsos() == 0)
-        {
-            delete textura_marco_retrato;
-            textura_marco_retrato = nullptr;
-        }
+        actor_personaje->juego_->texturas().suelta(textura_marco_retrato);
         delete imagen_retrato_lateral;
         imagen_retrato_lateral = nullptr;
         delete fondo_retrato;
@@ -73,8 +74,10 @@ namespace tapete
             textura_titulos = nullptr;
         }
 
-        delete textura_retrato;
-        textura_retrato = nullptr;
+        if (!atlas_retratos.enUso())
+        {
+            atlas_retratos.libera();
+        }
         liberaSFXs();
     }
 
@@ -112,8 +115,8 @@ namespace tapete
             textura_titulos = new unir2d::Textura{};
             textura_titulos->crea(Vector{anchr_plnch * colns_plnch, altra_plnch * filas_plnch});
 
-            unir2d::Textura *textr_plnch = new unir2d::Textura{};
-            textr_plnch->carga(JuegoMesaBase::carpetaActivos() + "plancha_titulo.png");
+            AlmacenTexturas &texturas = personaje_actual->juego_->texturas();
+            unir2d::Textura *textr_plnch = texturas.toma(JuegoMesaBase::carpetaActivos() + "plancha_titulo.png");
             unir2d::Imagen *imagn_plnch = new unir2d::Imagen{};
             imagn_plnch->asigna(textr_plnch);
             for (int fila = 0; fila < 6; ++fila)
@@ -126,8 +129,7 @@ namespace tapete
             }
             delete imagn_plnch;
             imagn_plnch = nullptr;
-            delete textr_plnch;
-            textr_plnch = nullptr;
+            texturas.suelta(textr_plnch);
 
             unir2d::Texto *texto_nombr = new unir2d::Texto("timesbi");
             texto_nombr->ponTamano(18);
@@ -181,13 +183,9 @@ namespace tapete
 
         imagen_retrato_lateral = new unir2d::Imagen();
         imagen_retrato_lateral->ponPosicion(panel_lateral.posicion() + Vector{10, 30});
-        imagen_retrato_lateral->asigna(textura_retrato);
+        atlas_retratos.asigna(imagen_retrato_lateral, estampa_retrato);
 
-        if (textura_marco_retrato == nullptr)
-        {
-            textura_marco_retrato = new unir2d::Textura{};
-            textura_marco_retrato->carga(JuegoMesaBase::carpetaActivos() + "marco_75.png");
-        }
+        textura_marco_retrato = actor_personaje->juego_->texturas().toma(JuegoMesaBase::carpetaActivos() + "marco_75.png");
         imagen_marco_retrato = new unir2d::Imagen();
         imagen_marco_retrato->ponPosicion(panel_lateral.posicion() + Vector{0, 20});
         imagen_marco_retrato->asigna(textura_marco_retrato);
@@ -207,11 +205,7 @@ namespace tapete
 
     void PresenciaPersonaje::preparaBarraVida()
     {
-        if (textura_barras_vida == nullptr)
-        {
-            textura_barras_vida = new unir2d::Textura{};
-            textura_barras_vida->carga(JuegoMesaBase::carpetaActivos() + "barras_vida.png");
-        }
+        textura_barras_vida = actor_personaje->juego_->texturas().toma(JuegoMesaBase::carpetaActivos() + "barras_vida.png");
         imagen_barra_vida = new unir2d::Imagen{};
         imagen_barra_vida->asigna(textura_barras_vida);
         imagen_barra_vida->defineEstampas(cuentaBarrasVida, 1);
@@ -225,7 +219,7 @@ namespace tapete
     {
         imagen_retrato_actuante = new unir2d::Imagen();
 
-        imagen_retrato_actuante->asigna(textura_retrato);
+        atlas_retratos.asigna(imagen_retrato_actuante, estampa_retrato);
         imagen_retrato_actuante->ponVisible(false);
 
         actor_personaje->agregaDibujo(imagen_retrato_actuante);
@@ -233,8 +227,7 @@ namespace tapete
 
     void PresenciaPersonaje::preparaFicha()
     {
-        textura_ficha = new unir2d::Textura{};
-        textura_ficha->carga(actor_personaje->archivoFicha());
+        textura_ficha = actor_personaje->juego_->texturas().toma(actor_personaje->archivoFicha());
         imagen_ficha = new unir2d::Imagen{};
         imagen_ficha->asigna(textura_ficha);
 
@@ -59,20 +59,23 @@ namespace tapete {
 
         Region panel_lateral {};          ///< Región lateral donde se dibuja el retrato y la ficha
 
-        unir2d::Textura * textura_retrato {}; ///< Textura base para el retrato lateral
+        static constexpr Vector tamanoRetrato {75, 75}; ///< Tamaño de los retratos
+
+        inline static AtlasEstampas atlas_retratos {tamanoRetrato, 8}; ///< Retratos de todos los personajes
+        int                         estampa_retrato {}; ///< Estampa del retrato en el atlas
 
         inline static unir2d::Textura * textura_titulos {}; ///< Textura para los títulos de grupo
         unir2d::Imagen *                imagen_titulo {};   ///< Imagen que contiene el título de grupo
 
         unir2d::Rectangulo *            fondo_retrato {};    ///< Rectángulo de fondo tras el retrato
         unir2d::Imagen *                imagen_retrato_lateral {}; ///< Imagen del retrato lateral
-        inline static unir2d::Textura * textura_marco_retrato {};   ///< Textura del marco que rodea el retrato
+        unir2d::Textura *               textura_marco_retrato {};   ///< Textura del marco que rodea el retrato
         unir2d::Imagen *                imagen_marco_retrato {};   ///< Imagen del marco de retrato
 
         unir2d::Textura *               textura_ficha {};    ///< Textura para la ficha circular
         unir2d::Imagen *                imagen_ficha {};     ///< Imagen de la ficha circular
 
-        inline static unir2d::Textura * textura_barras_vida {}; ///< Textura para la barra de vida
+        unir2d::Textura *               textura_barras_vida {}; ///< Textura para la barra de vida
         unir2d::Imagen *                imagen_barra_vida {}; ///< Imagen que muestra la barra de vida actual
 
         unir2d::Imagen *                imagen_retrato_actuante {}; ///< Retrato del personaje en HUD de activa
@@ -20,6 +20,7 @@ namespace tapete
     {
         preparaBaldosas();
         preparaMuros();
+        preparaCapaFija();
         preparaPaneles();
         preparaMonitor();
         preparaDisplay();
@@ -29,18 +30,23 @@ namespace tapete
 
     void PresenciaTablero::reprepara()
     {
-        actor_tablero->agregaDibujo(malla_muros);
-
-        actor_tablero->agregaDibujo(imagen_panel_vertcl_izqrd);
-        actor_tablero->agregaDibujo(imagen_panel_vertcl_derch);
-        actor_tablero->agregaDibujo(imagen_panel_abajo_izqrd);
-        actor_tablero->agregaDibujo(imagen_panel_abajo_derch);
-        actor_tablero->agregaDibujo(imagen_bandera_izqrd);
-        actor_tablero->agregaDibujo(imagen_escudo_izqrd);
-        actor_tablero->agregaDibujo(imagen_bandera_derch);
-        actor_tablero->agregaDibujo(imagen_escudo_derch);
-
-        actor_tablero->agregaDibujo(imagen_fondo_monitor);
+        // lo que no cambia durante la partida se compone en la capa fija, en el orden en que se veía
+        capa_fija.agrega(baldosas_fondo);
+        capa_fija.agrega(actor_tablero->rejilla_tablero.trazos_rejilla);
+        capa_fija.agrega(malla_muros);
+
+        capa_fija.agrega(imagen_panel_vertcl_izqrd);
+        capa_fija.agrega(imagen_panel_vertcl_derch);
+        capa_fija.agrega(imagen_panel_abajo_izqrd);
+        capa_fija.agrega(imagen_panel_abajo_derch);
+        capa_fija.agrega(imagen_bandera_izqrd);
+        capa_fija.agrega(imagen_escudo_izqrd);
+        capa_fija.agrega(imagen_bandera_derch);
+        capa_fija.agrega(imagen_escudo_derch);
+
+        capa_fija.agrega(imagen_fondo_monitor);
+        capa_fija.compone();
+
         for (int indc = 0; indc < lineas_texto_monitor; ++indc)
         {
             actor_tablero->agregaDibujo(texto_monitor[indc]);
@@ -49,6 +55,7 @@ namespace tapete
 
     void PresenciaTablero::libera()
     {
+        liberaCapaFija();
         liberaPaneles();
         liberaMuros();
         liberaBaldosas();
@@ -74,21 +81,17 @@ namespace tapete
         baldosas_fondo->defineSuperficie(filas_superf, colns_superf);
         std::vector<uint32_t> mapeo{};
         mapeo.resize(static_cast<int>(filas_superf * colns_superf));
-        std::random_device semilla{};
-        std::mt19937 generador{semilla()};
-        std::uniform_int_distribution<unsigned int> distrb_filas{0, filas_estamp - 1};
-        std::uniform_int_distribution<unsigned int> distrb_colns{0, colns_estamp - 1};
+        GeneradorAzar &generador = actor_tablero->juego->azar().cosmetico();
         for (int f_s = 0; f_s < filas_superf; ++f_s)
         {
             for (int c_s = 0; c_s < colns_superf; ++c_s)
             {
-                int f_e = (int)distrb_filas(generador);
-                int c_e = (int)distrb_colns(generador);
+                int f_e = (int)generador.entero(filas_estamp);
+                int c_e = (int)generador.entero(colns_estamp);
                 mapeo[f_s * colns_superf + c_s] = f_e * colns_estamp + c_e;
             }
         }
         baldosas_fondo->mapea(mapeo);
-        actor_tablero->agregaDibujo(baldosas_fondo);
     }
 
     void PresenciaTablero::liberaBaldosas()
@@ -127,6 +130,18 @@ namespace tapete
         textura_muros = nullptr;
     }
 
+    void PresenciaTablero::preparaCapaFija()
+    {
+        imagen_capa_fija = capa_fija.prepara();
+        actor_tablero->agregaDibujo(imagen_capa_fija);
+    }
+
+    void PresenciaTablero::liberaCapaFija()
+    {
+        capa_fija.libera();
+        imagen_capa_fija = nullptr;
+    }
+
     void PresenciaTablero::calculaEstampasMuros(
         const std::vector<Coord> &posiciones_rejilla,
         IndicesEstampas &indices_estampas)
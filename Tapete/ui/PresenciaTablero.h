@@ -98,6 +98,10 @@ private:
     unir2d::Textura* textura_muros{};               ///< Textura de muros
     unir2d::Malla* malla_muros{};                   ///< Malla de muros en el tablero
 
+    // Capa con el fondo, la rejilla, los muros y los paneles, compuesta en una textura
+    CapaFija capa_fija{tamanoTablero};              ///< Dibujos que no cambian durante la partida
+    unir2d::Imagen* imagen_capa_fija{};             ///< Imagen de la capa fija, propiedad de la capa
+
     // Paneles izquierdo y derecho
     unir2d::Textura* textura_panel_vertcl{};        ///< Textura genérica de panel vertical
     unir2d::Imagen* imagen_panel_vertcl_izqrd{};    ///< Imagen del panel vertical izquierdo
@@ -167,7 +171,7 @@ private:
     /** @name Ciclo de vida de recursos */
     ///@{
     void prepara();      ///< Carga texturas, mallas y paneles
-    void reprepara();    ///< Vuelve a preparar recursos tras un reinicio
+    void reprepara();    ///< Compone la capa fija, con la rejilla ya preparada, y agrega los textos
     void libera();       ///< Libera texturas, mallas, imágenes y sonidos
     ///@}
 
@@ -175,6 +179,7 @@ private:
     ///@{
     void preparaBaldosas();  ///< Inicializa y configura las baldosas de fondo
     void preparaMuros();     ///< Crea y configura la malla de muros
+    void preparaCapaFija();  ///< Crea la capa fija y agrega su imagen debajo de los demás dibujos
     void preparaPaneles();   ///< Carga imágenes de los paneles
     void preparaMonitor();   ///< Configura el monitor de texto
     void preparaDisplay();   ///< Configura el display de PA
@@ -186,6 +191,7 @@ private:
     ///@{
     void liberaBaldosas();   ///< Libera recursos de baldosas
     void liberaMuros();      ///< Libera malla y texturas de muros
+    void liberaCapaFija();   ///< Libera la imagen y la textura de la capa fija
     void liberaPaneles();    ///< Libera texturas e imágenes de paneles
     void liberaMonitor();    ///< Libera recursos del monitor
     void liberaDisplay();    ///< Libera recursos del display
@@ -0,0 +1,114 @@
+﻿// proyecto: Grupal/Tapete
+// archivo   GeneradorAzar.cpp
+// versión:  2.1  (Abril-2025)
+
+#include "tapete.h"
+
+#include <random>
+
+namespace tapete {
+
+    namespace {
+
+        uint64_t rota (uint64_t valor, int bits) {
+            return (valor << bits) | (valor >> (64 - bits));
+        }
+
+        // splitmix64: reparte los bits de la semilla por todo el estado, que nunca queda a cero
+        uint64_t mezcla (uint64_t & valor) {
+            uint64_t z = (valor += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+    }
+
+    GeneradorAzar::GeneradorAzar (uint64_t semilla) {
+        siembra (semilla);
+    }
+
+    void GeneradorAzar::siembra (uint64_t semilla) {
+        for (uint64_t & parte : estado) {
+            parte = mezcla (semilla);
+        }
+    }
+
+    GeneradorAzar::result_type GeneradorAzar::operator () () {
+        uint64_t resultado = rota (estado [1] * 5, 7) * 9;
+        uint64_t t = estado [1] << 17;
+        estado [2] ^= estado [0];
+        estado [3] ^= estado [1];
+        estado [1] ^= estado [2];
+        estado [0] ^= estado [3];
+        estado [2] ^= t;
+        estado [3] = rota (estado [3], 45);
+        return resultado;
+    }
+
+    uint32_t GeneradorAzar::entero (uint32_t contador) {
+        aserta (contador > 0, "entero: contador nulo");
+        // método de Lemire: multiplica en lugar de dividir y rechaza el sesgo en raras ocasiones
+        uint64_t producto = ((* this) () >> 32) * contador;
+        uint32_t resto = static_cast <uint32_t> (producto);
+        if (resto < contador) {
+            uint32_t umbral = (0u - contador) % contador;
+            while (resto < umbral) {
+                producto = ((* this) () >> 32) * contador;
+                resto = static_cast <uint32_t> (producto);
+            }
+        }
+        return static_cast <uint32_t> (producto >> 32);
+    }
+
+    void GeneradorAzar::salta () {
+        static constexpr std::array <uint64_t, 4> salto {
+                0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+                0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+        std::array <uint64_t, 4> nuevo {};
+        for (uint64_t palabra : salto) {
+            for (int bit = 0; bit < 64; ++ bit) {
+                if (palabra & (uint64_t {1} << bit)) {
+                    for (int indc = 0; indc < 4; ++ indc) {
+                        nuevo [indc] ^= estado [indc];
+                    }
+                }
+                (* this) ();
+            }
+        }
+        estado = nuevo;
+    }
+
+    void GeneradorAzar::aserta (bool expresion, const string & mensaje) {
+        if (expresion) {
+            return;
+        }
+        throw std::logic_error (mensaje);
+    }
+
+
+    AzarJuego::AzarJuego () {
+        std::random_device entropia {};
+        siembra ((static_cast <uint64_t> (entropia ()) << 32) | entropia ());
+    }
+
+    void AzarJuego::siembra (uint64_t semilla) {
+        semilla_ = semilla;
+        partida_.siembra (semilla);
+        cosmetico_ = partida_;
+        cosmetico_.salta ();
+    }
+
+    uint64_t AzarJuego::semilla () const {
+        return semilla_;
+    }
+
+    GeneradorAzar & AzarJuego::partida () {
+        return partida_;
+    }
+
+    GeneradorAzar & AzarJuego::cosmetico () {
+        return cosmetico_;
+    }
+
+}
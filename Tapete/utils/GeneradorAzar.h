@@ -0,0 +1,112 @@
+﻿// proyecto: Grupal/Tapete
+// archivo:  GeneradorAzar.h
+// versión:  2.1  (Abril-2025)
+
+
+#pragma once
+
+
+namespace tapete {
+
+
+    /*
+     * \class GeneradorAzar
+     * \brief Generador de números aleatorios xoshiro256**.
+     *
+     * Tiene 32 bytes de estado y cada número cuesta unas pocas operaciones, así que se puede usar
+     * en cada fotograma. Cumple los requisitos de UniformRandomBitGenerator; para sacar enteros en
+     * un intervalo conviene usar entero, que da la misma secuencia en todas las plataformas.
+     */
+    class GeneradorAzar {
+    public:
+
+        using result_type = uint64_t;
+
+        static constexpr result_type min () { return 0; }
+        static constexpr result_type max () { return UINT64_MAX; }
+
+        /*!
+         * \brief Constructor.
+         * \param semilla Semilla del generador.
+         */
+        explicit GeneradorAzar (uint64_t semilla = 0);
+
+        /*!
+         * \brief Reinicia el generador con una semilla.
+         * \param semilla Semilla del generador.
+         */
+        void siembra (uint64_t semilla);
+
+        /*!
+         * \brief Devuelve el siguiente número de 64 bits.
+         */
+        result_type operator () ();
+
+        /*!
+         * \brief Devuelve un entero uniforme entre 0 y contador - 1.
+         * \param contador Número de valores posibles; debe ser mayor que cero.
+         */
+        uint32_t entero (uint32_t contador);
+
+        /*!
+         * \brief Avanza el generador 2^128 números, para obtener una secuencia que no se solapa.
+         */
+        void salta ();
+
+    private:
+
+        std::array <uint64_t, 4> estado {};
+
+        static void aserta (bool expresion, const string & mensaje);
+
+    };
+
+
+    /*
+     * \class AzarJuego
+     * \brief Servicio de números aleatorios del juego.
+     *
+     * Separa dos secuencias derivadas de la misma semilla: la de la partida (dados de las
+     * habilidades, desempates de iniciativa, muros y tesoros) y la cosmética (baldosas del fondo y
+     * números de la animación del cálculo). Lo cosmético puede consumir tantos números como
+     * fotogramas haya sin alterar la partida, que con la misma semilla se repite igual.
+     */
+    class AzarJuego {
+    public:
+
+        /*!
+         * \brief Constructor; toma la semilla de la fuente de entropía del sistema.
+         */
+        AzarJuego ();
+
+        /*!
+         * \brief Reinicia las dos secuencias con una semilla.
+         * \param semilla Semilla del juego.
+         */
+        void siembra (uint64_t semilla);
+
+        /*!
+         * \brief Devuelve la semilla con la que se iniciaron las secuencias.
+         */
+        uint64_t semilla () const;
+
+        /*!
+         * \brief Devuelve el generador de la partida.
+         */
+        GeneradorAzar & partida ();
+
+        /*!
+         * \brief Devuelve el generador de los efectos cosméticos.
+         */
+        GeneradorAzar & cosmetico ();
+
+    private:
+
+        uint64_t      semilla_ {};
+        GeneradorAzar partida_ {};
+        GeneradorAzar cosmetico_ {};
+
+    };
+
+
+}